@@ -0,0 +1,121 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn stream capture and replay
+ * @file capture.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+#ifndef MAVCONN__CAPTURE_HPP_
+#define MAVCONN__CAPTURE_HPP_
+
+#include <mavconn/interface.hpp>
+#include <mavconn/msgbuffer.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+namespace mavconn
+{
+
+//! Capture file magic ("MAVCAP01")
+static constexpr char CAPTURE_MAGIC[8] = {'M', 'A', 'V', 'C', 'A', 'P', '0', '1'};
+
+//! One capture record: header followed by @p len framed bytes.
+struct CaptureRecord
+{
+  uint64_t stamp_ns;   //!< steady_clock at frame completion
+  uint16_t len;        //!< framed bytes following this header
+} __attribute__((packed));
+
+/**
+ * @brief Append-only rotating capture writer.
+ *
+ * Appends raw framed bytes with nanosecond timestamps; when the file
+ * exceeds the rotate limit it is renamed to <path>.1 and restarted,
+ * so long captures keep bounded disk usage. Writes happen on the
+ * connection io thread (see MAVConnInterface::enable_capture()).
+ */
+class CaptureWriter
+{
+public:
+  //! Default rotation threshold [bytes]
+  static constexpr size_t DEFAULT_ROTATE_SIZE = 64 * 1024 * 1024;
+
+  CaptureWriter(const std::string & path, size_t rotate_size = DEFAULT_ROTATE_SIZE);
+  ~CaptureWriter();
+
+  CaptureWriter(const CaptureWriter &) = delete;
+
+  void append(uint64_t stamp_ns, const uint8_t * frame, size_t len);
+
+private:
+  void open_file();
+  void rotate();
+
+  std::string path;
+  size_t rotate_size;
+  size_t written;
+  FILE * file;
+};
+
+/**
+ * @brief Capture replay interface
+ *
+ * Plays a capture file back into the receive callbacks with the
+ * original timing (or at Nx speed), giving a repeatable benchmark
+ * input for dispatch and routing work.
+ *
+ * URL: replay:///path/to/capture[?speed=N]
+ */
+class MAVConnReplay : public MAVConnInterface,
+  public std::enable_shared_from_this<MAVConnReplay>
+{
+public:
+  MAVConnReplay(
+    uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
+    std::string path = "", double speed = 1.0);
+
+  virtual ~MAVConnReplay();
+
+  void close() override;
+
+  // Tx side is a sink: replayed links have no live peer
+  void send_message(const mavlink::mavlink_message_t * message) override;
+  void send_message(const mavlink::Message & message, const uint8_t source_compid) override;
+  void send_bytes(const uint8_t * bytes, size_t length) override;
+
+  inline bool is_open() override
+  {
+    return !should_exit;
+  }
+
+private:
+  std::string path;
+  double speed;
+  FILE * file;
+
+  std::atomic<bool> should_exit;
+  std::thread replay_thread;
+  std::recursive_mutex mutex;
+  std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
+
+  void replay_loop();
+};
+
+}  // namespace mavconn
+
+#endif  // MAVCONN__CAPTURE_HPP_
@@ -24,7 +24,10 @@
 #define MAVCONN__INTERFACE_HPP_
 
 #include <mavconn/mavlink_dialect.hpp>
+#include <mavconn/msgbuffer_pool.hpp>
+#include <mavconn/stats.hpp>
 
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -42,6 +45,8 @@
 
 namespace mavconn
 {
+class CaptureWriter;
+
 using steady_clock = std::chrono::steady_clock;
 using lock_guard = std::lock_guard<std::recursive_mutex>;
 
@@ -114,6 +119,8 @@ private:
 public:
   using ReceivedCb = std::function<void (const mavlink::mavlink_message_t * message,
       const Framing framing)>;
+  using ReceivedBytesCb = std::function<void (const mavlink::mavlink_message_t * message,
+      const Framing framing, const uint8_t * frame, const size_t frame_len)>;
   using ClosedCb = std::function<void (void)>;
   using Ptr = std::shared_ptr<MAVConnInterface>;
   using ConstPtr = std::shared_ptr<MAVConnInterface const>;
@@ -133,6 +140,8 @@ public:
    */
   explicit MAVConnInterface(uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE);
 
+  virtual ~MAVConnInterface();
+
   /**
    * @brief Close connection.
    */
@@ -183,6 +192,24 @@ public:
    */
   virtual void send_bytes(const uint8_t * bytes, size_t length) = 0;
 
+  /**
+   * @brief Send several messages as one batch.
+   *
+   * Transports enqueue the whole batch under a single lock
+   * acquisition and wake the io thread once, so back-to-back
+   * emitters (RTCM fragments, trajectories, HIL) stop paying a
+   * lock + wakeup per message. Pairs with the sendmmsg Tx batching
+   * on UDP. Default implementation falls back to per-message send.
+   *
+   * @throws std::length_error  On exceeding Tx queue limit
+   */
+  virtual void send_messages(const mavlink::mavlink_message_t * msgs, size_t count)
+  {
+    for (size_t i = 0; i < count; i++) {
+      send_message(&msgs[i]);
+    }
+  }
+
   /**
    * @brief Send message and ignore possible drop due to Tx queue limit
    */
@@ -208,11 +235,53 @@ public:
 
   //! Message receive callback
   ReceivedCb message_received_cb;
+  /**
+   * Message receive callback with the original framed bytes.
+   *
+   * @p frame points into the rx buffer and is only valid for the
+   * duration of the call; it allows forwarding without a
+   * decode/re-encode round trip. @p frame is nullptr when the frame
+   * spanned two reads (caller must fall back to re-serialization).
+   */
+  ReceivedBytesCb message_received_bytes_cb;
   //! Port closed notification callback
   ClosedCb port_closed_cb;
+  //! Port opened notification callback (transports with async connect)
+  ClosedCb port_opened_cb;
 
   virtual mavlink::mavlink_status_t get_status();
   virtual IOStat get_iostat();
+
+  /**
+   * @brief Lock-free statistics snapshot: message/byte counters plus
+   * Tx residency and Rx dispatch latency histograms.
+   */
+  ConnStats get_stats();
+
+  /**
+   * @brief Capture received frames to @p path.
+   *
+   * Appends raw framed bytes with nanosecond timestamps to a
+   * rotating capture file; play it back with replay:// (see
+   * MAVConnReplay). Capture starts immediately.
+   *
+   * @throws DeviceError when the file cannot be created
+   */
+  void enable_capture(const std::string & path);
+
+  /**
+   * @brief Kernel receive timestamp of the last datagram [ns since epoch].
+   *
+   * Captured via SO_TIMESTAMPNS where the transport supports it
+   * (UDP on Linux); 0 when unavailable. Valid for the duration of
+   * the receive callbacks, removes userspace scheduling jitter from
+   * timesync RTT measurements.
+   */
+  uint64_t get_last_rx_stamp_ns()
+  {
+    return last_rx_stamp_ns;
+  }
+
   virtual bool is_open() = 0;
 
   inline uint8_t get_system_id()
@@ -238,6 +307,97 @@ public:
   void set_protocol_version(Protocol pver);
   Protocol get_protocol_version();
 
+  /**
+   * @brief Enable MAVLink2 message signing on this link.
+   *
+   * Outgoing messages are signed and incoming signatures verified
+   * in-process (Framing::bad_signature on mismatch), removing the
+   * external signing gateway hop. The per-link signing state (key,
+   * link id, monotonic timestamp, stream window cache) lives on the
+   * connection and feeds the library's finalize/parse path directly.
+   *
+   * @warning Only locally-originated typed messages — those sent via
+   * send_message(const mavlink::Message &, ...) — pass through the
+   * finalize path and get signed. Pre-serialized frames sent via
+   * send_message(const mavlink_message_t *), send_messages() and
+   * send_bytes() (the paths the router uses to forward traffic) are
+   * transmitted as-is: a forwarded frame carries only the signature
+   * its origin gave it. Signing a gateway's downlink therefore
+   * requires the FCU-side link itself to sign.
+   *
+   * @param[in] secret_key         32 byte key
+   * @param[in] key_len            must be 32
+   * @param[in] initial_timestamp  signing timestamp to resume from
+   * @return false on bad key length
+   */
+  bool setup_signing(
+    const uint8_t * secret_key, size_t key_len,
+    uint64_t initial_timestamp = 0);
+
+  //! @brief Disable signing; link returns to unsigned operation.
+  void disable_signing();
+
+  //! @brief Current signing timestamp (persist across restarts), 0 if unsigned.
+  uint64_t get_signing_timestamp();
+
+  /**
+   * @brief Pin the connection io thread to @p cpu.
+   *
+   * Also settable via the ?io_cpu= URL option. Default
+   * implementation (shared-pool or external io) refuses.
+   */
+  virtual bool set_io_thread_affinity(int cpu)
+  {
+    (void)cpu;
+    return false;
+  }
+
+  /**
+   * @brief Set realtime scheduling for the connection io thread.
+   *
+   * SCHED_FIFO with ?io_prio= via URL. Needs CAP_SYS_NICE.
+   */
+  virtual bool set_io_thread_priority(int policy, int priority)
+  {
+    (void)policy;
+    (void)priority;
+    return false;
+  }
+
+  /**
+   * Set count of Tx buffers retained for reuse by the buffer pool.
+   */
+  void set_tx_pool_depth(size_t depth)
+  {
+    tx_buf_pool.set_depth(depth);
+  }
+
+  /**
+   * @brief Feed link flow-control state from RADIO_STATUS.
+   *
+   * When Tx shaping is active (set_tx_rate_limit()), the effective
+   * rate is scaled down while the radio's buffer runs low
+   * (txbuf < 50%%: half rate, < 25%%: quarter rate), so bulk traffic
+   * backs off before the radio silently drops it.
+   */
+  void update_flow_control(uint8_t txbuf_percent)
+  {
+    remote_txbuf = txbuf_percent;
+  }
+
+  /**
+   * @brief Pace Tx to @p bytes_per_sec with a token bucket.
+   *
+   * For links whose modem buffer is slower than the socket (e.g.
+   * 57600-baud telemetry radios); prevents the Tx queue overflow
+   * throw by shaping at the source. 0 (default) disables shaping.
+   * Honored by transports which implement pacing (currently serial).
+   */
+  void set_tx_rate_limit(size_t bytes_per_sec)
+  {
+    tx_rate_limit = bytes_per_sec;
+  }
+
   /**
    * @brief Construct connection from URL
    *
@@ -273,9 +433,17 @@ protected:
   //! This map merge all dialect mavlink_msg_entry_t structs. Needed for packet parser.
   static std::unordered_map<mavlink::msgid_t, const mavlink::mavlink_msg_entry_t *> message_entries;
 
+  //! Dense direct index over message_entries for the low msgid range:
+  //! mavlink_get_msg_entry() runs for every CRC validation and route
+  //! target extraction, so the hot path is one array load.
+  static std::array<const mavlink::mavlink_msg_entry_t *, 1024> message_entry_index;
+
   //! Channel number used for logging.
   size_t conn_id;
 
+  //! Pool which recycles Tx queue buffers (see MsgBufferPool).
+  MsgBufferPool tx_buf_pool;
+
   inline mavlink::mavlink_status_t * get_status_p()
   {
     return &m_parse_status;
@@ -286,6 +454,20 @@ protected:
     return &m_buffer;
   }
 
+  /**
+   * Lock serializing Tx finalize against Rx verification while
+   * signing is active: both advance the shared signing timestamp
+   * and stream window cache. No-op (no lock taken) when signing
+   * is disabled, so unsigned links pay only a pointer check.
+   */
+  inline std::unique_lock<std::mutex> signing_lock()
+  {
+    if (m_parse_status.signing == nullptr) {
+      return std::unique_lock<std::mutex>();
+    }
+    return std::unique_lock<std::mutex>(m_signing_mutex);
+  }
+
   /**
    * Parse buffer and emit massage_received.
    */
@@ -294,6 +476,35 @@ protected:
   void iostat_tx_add(size_t bytes);
   void iostat_rx_add(size_t bytes);
 
+  //! Account a fully transmitted buffer (Tx residency histogram).
+  void stat_tx_complete(const MsgBuffer & buf);
+
+  //! Kernel rx timestamp of the datagram being parsed, 0 if unknown.
+  std::atomic<uint64_t> last_rx_stamp_ns{0};
+
+  //! Frame capture sink, see enable_capture(). io thread only.
+  std::unique_ptr<CaptureWriter> capture;
+
+  /**
+   * Rx admission hook, called for each framed message before the
+   * receive callbacks. Transports may override it to drop duplicates
+   * (see MAVConnUDP multicast dedup). Default accepts everything.
+   */
+  virtual bool accept_message(const mavlink::mavlink_message_t & msg)
+  {
+    (void)msg;
+    return true;
+  }
+
+  // Token bucket helpers. Called from the io thread only.
+
+  //! Tokens available for sending now, SIZE_MAX when shaping is off.
+  size_t tx_tokens_available();
+  //! Account @p bytes against the bucket (may go into debt).
+  void tx_tokens_consume(size_t bytes);
+  //! Delay until @p bytes tokens will be available.
+  std::chrono::microseconds tx_token_wait(size_t bytes);
+
   void log_recv(const char * pfx, mavlink::mavlink_message_t & msg, Framing framing);
   void log_send(const char * pfx, const mavlink::mavlink_message_t * msg);
   void log_send_obj(const char * pfx, const mavlink::Message & msg);
@@ -305,10 +516,29 @@ private:
   mavlink::mavlink_message_t m_buffer;
   mavlink::mavlink_status_t m_mavlink_status;
 
+  //! MAVLink2 signing state, see setup_signing()
+  mavlink::mavlink_signing_t m_signing;
+  //! per-stream timestamp window cache for incoming verification
+  mavlink::mavlink_signing_streams_t m_signing_streams;
+  //! guards m_signing/m_signing_streams, see signing_lock()
+  std::mutex m_signing_mutex;
+
+  //! Tx shaping rate [B/s], 0 disables (see set_tx_rate_limit())
+  std::atomic<size_t> tx_rate_limit;
+  //! last reported radio Tx buffer fill [%], 255: unknown
+  std::atomic<uint8_t> remote_txbuf;
+  //! Token bucket level, io thread only
+  double tx_tokens;
+  std::chrono::time_point<steady_clock> tx_last_refill;
+
   std::atomic<size_t> tx_total_bytes, rx_total_bytes;
-  std::recursive_mutex iostat_mutex;
-  size_t last_tx_total_bytes, last_rx_total_bytes;
-  std::chrono::time_point<steady_clock> last_iostat;
+  std::atomic<size_t> tx_total_messages, rx_total_messages;
+  LatencyHistogram txq_residency_hist;
+  LatencyHistogram rx_dispatch_hist;
+  // speed-window state: atomics so get_iostat() is a lock-free
+  // snapshot and the 1 Hz diagnostics tick never contends with io
+  std::atomic<size_t> last_tx_total_bytes, last_rx_total_bytes;
+  std::atomic<int64_t> last_iostat_ns;
 
   //! monotonic counter (increment only)
   static std::atomic<size_t> conn_id_counter;
@@ -0,0 +1,99 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn shared io thread pool
+ * @file io_pool.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+#ifndef MAVCONN__IO_POOL_HPP_
+#define MAVCONN__IO_POOL_HPP_
+
+#include <asio.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mavconn
+{
+
+/**
+ * @brief Opt-in process-wide io thread pool.
+ *
+ * By default every connection spins up its own io_service plus a
+ * dedicated io thread; a router with many mostly-idle links then
+ * costs one waking thread per link. When the pool is started (before
+ * the links are opened), all connections share its io_service and
+ * one io thread serves every link.
+ *
+ * The pool runs exactly one thread: the transports consume their Tx
+ * queues lock-free under a single-io-consumer invariant, and a
+ * multi-threaded io_service would need a strand per connection to
+ * keep that sound. Requests for more threads are clamped.
+ */
+class IOServicePool
+{
+public:
+  //! Count of pool io threads (see class note on why it is one).
+  static constexpr size_t DEFAULT_THREAD_COUNT = 1;
+
+  static IOServicePool & instance();
+
+  /**
+   * @brief Start the pool.
+   *
+   * Connections opened after this call run their async io on the
+   * pool. No-op if already started.
+   */
+  void start(size_t thread_count = DEFAULT_THREAD_COUNT);
+
+  /**
+   * @brief Stop the pool and join its threads.
+   *
+   * Must only be called after all connections using the pool
+   * are closed.
+   */
+  void stop();
+
+  //! @brief true when the pool accepts connections.
+  bool is_running();
+
+  /**
+   * @brief Wait until every task queued before this call has run.
+   *
+   * Used by connection close(): the constructors post their first
+   * io task with a bare this, so the object must not be destroyed
+   * until that task has executed. No-op off-pool-state or when
+   * called from the pool thread itself (then a handler holding the
+   * connection alive is already running).
+   */
+  void flush();
+
+  //! @brief Pool io_service; only valid while is_running().
+  asio::io_service & io_service();
+
+private:
+  IOServicePool() = default;
+  IOServicePool(const IOServicePool &) = delete;
+
+  std::unique_ptr<asio::io_service> io_service_ptr;
+  std::unique_ptr<asio::io_service::work> io_work;
+  std::vector<std::thread> threads;
+  std::thread::id pool_thread_id;
+  std::recursive_mutex mutex;
+};
+
+}  // namespace mavconn
+
+#endif  // MAVCONN__IO_POOL_HPP_
@@ -21,6 +21,7 @@
 
 #include <mavconn/mavlink_dialect.hpp>
 #include <cassert>
+#include <chrono>
 
 namespace mavconn
 {
@@ -35,11 +36,14 @@ struct MsgBuffer
   uint8_t data[MAX_SIZE];
   ssize_t len;
   ssize_t pos;
+  //! construction (enqueue) time, for Tx residency stats
+  std::chrono::time_point<std::chrono::steady_clock> stamp;
 
   MsgBuffer()
   : data{},
     len(0),
-    pos(0)
+    pos(0),
+    stamp(std::chrono::steady_clock::now())
   {
   }
 
@@ -47,7 +51,8 @@ struct MsgBuffer
    * @brief Buffer constructor from mavlink_message_t
    */
   explicit MsgBuffer(const mavlink::mavlink_message_t * msg)
-  : pos(0)
+  : pos(0),
+    stamp(std::chrono::steady_clock::now())
   {
     len = mavlink::mavlink_msg_to_send_buffer(data, msg);
     // paranoic check, it must be less than MAVLINK_MAX_PACKET_LEN
@@ -60,7 +65,8 @@ struct MsgBuffer
   MsgBuffer(
     const mavlink::Message & obj, mavlink::mavlink_status_t * status, uint8_t sysid,
     uint8_t compid)
-  : pos(0)
+  : pos(0),
+    stamp(std::chrono::steady_clock::now())
   {
     mavlink::mavlink_message_t msg;
     mavlink::MsgMap map(msg);
@@ -83,7 +89,8 @@ struct MsgBuffer
    */
   MsgBuffer(const uint8_t * bytes, ssize_t nbytes)
   : len(nbytes),
-    pos(0)
+    pos(0),
+    stamp(std::chrono::steady_clock::now())
   {
     assert(0 < nbytes && nbytes < MAX_SIZE);
     std::memcpy(data, bytes, nbytes);
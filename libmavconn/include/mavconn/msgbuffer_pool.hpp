@@ -0,0 +1,143 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn message buffer pool (internal)
+ * @file msgbuffer_pool.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+#ifndef MAVCONN__MSGBUFFER_POOL_HPP_
+#define MAVCONN__MSGBUFFER_POOL_HPP_
+
+#include <mavconn/msgbuffer.hpp>
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mavconn
+{
+
+/**
+ * @brief Fixed-depth freelist pool of MsgBuffer objects.
+ *
+ * send_message() constructs one MsgBuffer per call, which at high
+ * setpoint + telemetry rates costs thousands of heap allocations per
+ * second on each link. The pool recycles buffer storage between the
+ * sender threads and the io thread instead of returning it to the
+ * allocator.
+ *
+ * Allocation falls back to the heap when the freelist is empty,
+ * so the pool never blocks or fails; @p depth only limits how many
+ * buffers are retained for reuse.
+ */
+class MsgBufferPool
+{
+public:
+  //! Default count of retained Tx buffers.
+  static constexpr size_t DEFAULT_POOL_DEPTH = 64;
+
+  //! Deleter which returns buffer storage to the owning pool.
+  struct Deleter
+  {
+    MsgBufferPool * pool;
+
+    void operator()(MsgBuffer * buf) const
+    {
+      pool->dealloc(buf);
+    }
+  };
+
+  //! Pooled buffer handle, usable as drop-in for MsgBuffer value storage.
+  using BufferPtr = std::unique_ptr<MsgBuffer, Deleter>;
+
+  explicit MsgBufferPool(size_t depth_ = DEFAULT_POOL_DEPTH)
+  : depth(depth_)
+  {
+    free_list.reserve(depth);
+  }
+
+  ~MsgBufferPool()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto ptr : free_list) {
+      ::operator delete(ptr);
+    }
+  }
+
+  MsgBufferPool(const MsgBufferPool &) = delete;
+
+  /**
+   * @brief Construct MsgBuffer from pooled storage.
+   *
+   * Arguments are forwarded to any of the MsgBuffer constructors.
+   */
+  template<typename ... Args>
+  BufferPtr alloc(Args && ... args)
+  {
+    void * storage = nullptr;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!free_list.empty()) {
+        storage = free_list.back();
+        free_list.pop_back();
+      }
+    }
+
+    if (storage == nullptr) {
+      storage = ::operator new(sizeof(MsgBuffer));
+    }
+
+    return BufferPtr(
+      new (storage) MsgBuffer(std::forward<Args>(args)...),
+      Deleter{this});
+  }
+
+  /**
+   * @brief Set count of retained buffers.
+   *
+   * Excess free buffers are released to the heap as they return.
+   */
+  void set_depth(size_t depth_)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    depth = depth_;
+  }
+
+private:
+  void dealloc(MsgBuffer * buf)
+  {
+    buf->~MsgBuffer();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (free_list.size() < depth) {
+        free_list.push_back(buf);
+        return;
+      }
+    }
+
+    ::operator delete(buf);
+  }
+
+  size_t depth;
+  std::vector<void *> free_list;
+  std::mutex mutex;
+};
+
+}  // namespace mavconn
+
+#endif  // MAVCONN__MSGBUFFER_POOL_HPP_
@@ -0,0 +1,205 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn priority Tx queue (internal)
+ * @file prio_queue.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+#ifndef MAVCONN__PRIO_QUEUE_HPP_
+#define MAVCONN__PRIO_QUEUE_HPP_
+
+#include <mavconn/mavlink_dialect.hpp>
+#include <mavconn/ringbuffer.hpp>
+
+#include <atomic>
+#include <utility>
+
+namespace mavconn
+{
+
+/**
+ * @brief Multi-class Tx queue with per-band drop policies.
+ *
+ * On a saturated link FIFO queueing lets HEARTBEAT and setpoints sit
+ * behind bulk PARAM_VALUE/LOG_DATA traffic until the overflow throw
+ * drops everything indiscriminately. Here message ids map to three
+ * priority bands and the consumer always drains the highest
+ * non-empty band first:
+ *
+ * - @a control: heartbeat, setpoints, commands — overflow throws
+ *   (sender-visible, as before);
+ * - @a status:  everything not classified otherwise — overflow
+ *   throws;
+ * - @a bulk:    param/mission/ftp/log transfers — overflow drops the
+ *   newest entry silently (those protocols retry), keeping control
+ *   latency bounded under congestion.
+ *
+ * Threading follows RingBuffer: producers are externally serialized,
+ * band selection and pop belong to the consumer (io thread).
+ */
+template<typename T>
+class PrioTxQueue
+{
+public:
+  enum class Band : uint8_t
+  {
+    control = 0,
+    status = 1,
+    bulk = 2,
+  };
+
+  enum class PushResult : uint8_t
+  {
+    ok,            //!< enqueued
+    dropped_bulk,  //!< bulk band full, entry silently dropped
+    overflow,      //!< control/status band full, sender must be told
+  };
+
+  //! @brief Priority band for @p msgid.
+  static Band band_of(mavlink::msgid_t msgid)
+  {
+    switch (msgid) {
+      case 0:     // HEARTBEAT
+      case 69:    // MANUAL_CONTROL
+      case 70:    // RC_CHANNELS_OVERRIDE
+      case 75:    // COMMAND_INT
+      case 76:    // COMMAND_LONG
+      case 77:    // COMMAND_ACK
+      case 81:    // MANUAL_SETPOINT
+      case 82:    // SET_ATTITUDE_TARGET
+      case 84:    // SET_POSITION_TARGET_LOCAL_NED
+      case 86:    // SET_POSITION_TARGET_GLOBAL_INT
+        return Band::control;
+
+      case 20:    // PARAM_REQUEST_READ
+      case 21:    // PARAM_REQUEST_LIST
+      case 22:    // PARAM_VALUE
+      case 23:    // PARAM_SET
+      case 37:    // MISSION_REQUEST_PARTIAL_LIST
+      case 38:    // MISSION_WRITE_PARTIAL_LIST
+      case 39:    // MISSION_ITEM
+      case 40:    // MISSION_REQUEST
+      case 41:    // MISSION_SET_CURRENT
+      case 43:    // MISSION_REQUEST_LIST
+      case 44:    // MISSION_COUNT
+      case 47:    // MISSION_ACK
+      case 51:    // MISSION_REQUEST_INT
+      case 73:    // MISSION_ITEM_INT
+      case 110:   // FILE_TRANSFER_PROTOCOL
+      case 117:   // LOG_REQUEST_LIST
+      case 118:   // LOG_ENTRY
+      case 119:   // LOG_REQUEST_DATA
+      case 120:   // LOG_DATA
+      case 121:   // LOG_ERASE
+      case 122:   // LOG_REQUEST_END
+        return Band::bulk;
+
+      default:
+        return Band::status;
+    }
+  }
+
+  /**
+   * Total @p capacity is split 1/4 control, 1/4 status, 1/2 bulk.
+   */
+  explicit PrioTxQueue(size_t capacity)
+  : control_q(capacity / 4),
+    status_q(capacity / 4),
+    bulk_q(capacity / 2),
+    dropped_bulk_total(0)
+  {
+  }
+
+  PrioTxQueue(const PrioTxQueue &) = delete;
+
+  //! @brief Enqueue element into @p band (producer side).
+  PushResult push(Band band, T && value)
+  {
+    if (band_q(band).push(std::move(value))) {
+      return PushResult::ok;
+    }
+
+    if (band == Band::bulk) {
+      dropped_bulk_total.fetch_add(1, std::memory_order_relaxed);
+      return PushResult::dropped_bulk;
+    }
+
+    return PushResult::overflow;
+  }
+
+  //! @brief Highest-priority non-empty band (consumer side).
+  Band top_band()
+  {
+    if (!control_q.empty()) {
+      return Band::control;
+    }
+    if (!status_q.empty()) {
+      return Band::status;
+    }
+    return Band::bulk;
+  }
+
+  //! @brief Oldest element of @p band, nullptr if empty (consumer side).
+  T * front(Band band)
+  {
+    return band_q(band).front();
+  }
+
+  //! @brief Element at offset @p idx within @p band (consumer side).
+  T * peek(Band band, size_t idx)
+  {
+    return band_q(band).peek(idx);
+  }
+
+  //! @brief Drop the oldest element of @p band (consumer side).
+  void pop(Band band)
+  {
+    band_q(band).pop();
+  }
+
+  size_t band_size(Band band)
+  {
+    return band_q(band).size();
+  }
+
+  bool empty() const
+  {
+    return control_q.empty() && status_q.empty() && bulk_q.empty();
+  }
+
+  //! @brief Count of silently dropped bulk entries.
+  size_t dropped_bulk() const
+  {
+    return dropped_bulk_total.load(std::memory_order_relaxed);
+  }
+
+private:
+  RingBuffer<T> & band_q(Band band)
+  {
+    switch (band) {
+      case Band::control: return control_q;
+      case Band::status: return status_q;
+      default: return bulk_q;
+    }
+  }
+
+  RingBuffer<T> control_q;
+  RingBuffer<T> status_q;
+  RingBuffer<T> bulk_q;
+  std::atomic<size_t> dropped_bulk_total;
+};
+
+}  // namespace mavconn
+
+#endif  // MAVCONN__PRIO_QUEUE_HPP_
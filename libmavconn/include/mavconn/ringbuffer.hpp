@@ -0,0 +1,129 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn Tx ring buffer (internal)
+ * @file ringbuffer.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+#ifndef MAVCONN__RINGBUFFER_HPP_
+#define MAVCONN__RINGBUFFER_HPP_
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace mavconn
+{
+
+/**
+ * @brief Bounded wait-free single-producer/single-consumer ring.
+ *
+ * Replaces the mutex-guarded std::deque Tx queue: the io thread
+ * (consumer) peeks and pops without taking any lock, so senders are
+ * never blocked behind an in-flight write completion. Callers of
+ * push() must be externally serialized (the transports keep their
+ * send-side mutex for that); front()/peek()/pop() belong to the io
+ * thread only.
+ *
+ * One slot is sacrificed to distinguish full from empty.
+ */
+template<typename T>
+class RingBuffer
+{
+public:
+  explicit RingBuffer(size_t capacity)
+  : slots(capacity + 1),
+    head(0),
+    tail(0)
+  {
+  }
+
+  RingBuffer(const RingBuffer &) = delete;
+
+  /**
+   * @brief Enqueue element (producer side).
+   * @return false if the ring is full; element is left untouched.
+   */
+  bool push(T && value)
+  {
+    const auto h = head.load(std::memory_order_relaxed);
+    const auto next = advance(h);
+
+    if (next == tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    slots[h] = std::move(value);
+    head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  //! @brief Oldest element, nullptr if empty (consumer side).
+  T * front()
+  {
+    return peek(0);
+  }
+
+  //! @brief Element at offset @p idx from the oldest (consumer side).
+  T * peek(size_t idx)
+  {
+    if (idx >= size()) {
+      return nullptr;
+    }
+
+    auto t = tail.load(std::memory_order_relaxed);
+    for (; idx > 0; idx--) {
+      t = advance(t);
+    }
+
+    return &slots[t];
+  }
+
+  //! @brief Drop the oldest element (consumer side).
+  void pop()
+  {
+    const auto t = tail.load(std::memory_order_relaxed);
+
+    slots[t] = T{};
+    tail.store(advance(t), std::memory_order_release);
+  }
+
+  bool empty() const
+  {
+    return head.load(std::memory_order_acquire) ==
+           tail.load(std::memory_order_acquire);
+  }
+
+  size_t size() const
+  {
+    const auto h = head.load(std::memory_order_acquire);
+    const auto t = tail.load(std::memory_order_acquire);
+
+    return (h >= t) ? (h - t) : (slots.size() - t + h);
+  }
+
+private:
+  size_t advance(size_t pos) const
+  {
+    return (pos + 1 == slots.size()) ? 0 : pos + 1;
+  }
+
+  std::vector<T> slots;
+  std::atomic<size_t> head;   //!< next slot to write (producer)
+  std::atomic<size_t> tail;   //!< next slot to read (consumer)
+};
+
+}  // namespace mavconn
+
+#endif  // MAVCONN__RINGBUFFER_HPP_
@@ -21,10 +21,12 @@
 
 #include <mavconn/interface.hpp>
 #include <mavconn/msgbuffer.hpp>
+#include <mavconn/msgbuffer_pool.hpp>
+#include <mavconn/prio_queue.hpp>
+#include <mavconn/thread_utils.hpp>
 
 #include <asio.hpp>
 #include <atomic>
-#include <deque>
 #include <string>
 
 namespace mavconn
@@ -46,9 +48,16 @@ public:
    * @param[in] device    TTY device path
    * @param[in] baudrate  serial baudrate
    */
+  /**
+   * @param[id] low_latency  request the driver's low-latency mode
+   *   (ASYNC_LOW_LATENCY: FTDI latency timer drops from up to 16 ms
+   *   to 1 ms). On by default, ?low_latency=0 disables it for
+   *   adapters that misbehave.
+   */
   MAVConnSerial(
     uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
-    std::string device = DEFAULT_DEVICE, unsigned baudrate = DEFAULT_BAUDRATE, bool hwflow = false);
+    std::string device = DEFAULT_DEVICE, unsigned baudrate = DEFAULT_BAUDRATE,
+    bool hwflow = false, bool low_latency = true);
   virtual ~MAVConnSerial();
 
   void close() override;
@@ -56,19 +65,46 @@ public:
   void send_message(const mavlink::mavlink_message_t * message) override;
   void send_message(const mavlink::Message & message, const uint8_t source_compid) override;
   void send_bytes(const uint8_t * bytes, size_t length) override;
+  void send_messages(const mavlink::mavlink_message_t * msgs, size_t count) override;
 
   inline bool is_open() override
   {
     return serial_dev.is_open();
   }
 
+  bool set_io_thread_affinity(int cpu) override
+  {
+    if (!io_thread.joinable()) {
+      return false;
+    }
+    return utils::set_thread_affinity(io_thread.native_handle(), cpu);
+  }
+
+  bool set_io_thread_priority(int policy, int priority) override
+  {
+    if (!io_thread.joinable()) {
+      return false;
+    }
+    return utils::set_thread_priority(io_thread.native_handle(), policy, priority);
+  }
+
 private:
-  asio::io_service io_service;
+  //! Maximum count of buffers coalesced into one gathered write.
+  static constexpr size_t MAX_TX_COALESCE = 16;
+
+  std::unique_ptr<asio::io_service> own_io_service;
+  asio::io_service & io_service;
   std::thread io_thread;
   asio::serial_port serial_dev;
+  asio::steady_timer tx_timer;
 
   std::atomic<bool> tx_in_progress;
-  std::deque<MsgBuffer> tx_q;
+  //! a frame of this band is partially on the wire: byte-stream
+  //! frames must complete before priorities are re-evaluated
+  bool tx_partial = false;
+  PrioTxQueue<MsgBufferPool::BufferPtr>::Band tx_band =
+    PrioTxQueue<MsgBufferPool::BufferPtr>::Band::status;
+  PrioTxQueue<MsgBufferPool::BufferPtr> tx_q;
   std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
   std::recursive_mutex mutex;
 
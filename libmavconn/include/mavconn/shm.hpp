@@ -0,0 +1,115 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn shared memory link class
+ * @file shm.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+#ifndef MAVCONN__SHM_HPP_
+#define MAVCONN__SHM_HPP_
+
+#include <mavconn/interface.hpp>
+#include <mavconn/msgbuffer.hpp>
+#include <mavconn/msgbuffer_pool.hpp>
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace mavconn
+{
+
+/**
+ * @brief Shared memory interface
+ *
+ * Connects exactly two processes on the same host (e.g. router and
+ * UAS) through a pair of lock-free SPSC byte rings in a POSIX shared
+ * memory segment, with futex wakeup for the readers. A hop costs one
+ * memcpy each way instead of a loopback socket round trip.
+ *
+ * URL: shm:///segment-name (the first opener creates the segment,
+ * sides are claimed on open).
+ *
+ * @note Linux only.
+ */
+class MAVConnSHM : public MAVConnInterface,
+  public std::enable_shared_from_this<MAVConnSHM>
+{
+public:
+  static constexpr auto DEFAULT_SEGMENT_NAME = "/mavconn_shm";
+
+  //! Ring capacity [bytes], must be a power of two.
+  static constexpr size_t RING_SIZE = 256 * 1024;
+
+  MAVConnSHM(
+    uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
+    std::string name = DEFAULT_SEGMENT_NAME);
+
+  virtual ~MAVConnSHM();
+
+  void close() override;
+
+  void send_message(const mavlink::mavlink_message_t * message) override;
+  void send_message(const mavlink::Message & message, const uint8_t source_compid) override;
+  void send_bytes(const uint8_t * bytes, size_t length) override;
+
+  inline bool is_open() override
+  {
+    return region != nullptr;
+  }
+
+private:
+  //! One direction of the duplex channel.
+  struct Ring
+  {
+    std::atomic<uint32_t> head;      //!< written bytes (monotonic)
+    std::atomic<uint32_t> tail;      //!< consumed bytes (monotonic)
+    std::atomic<uint32_t> notify;    //!< futex word, bumped on write
+    uint8_t data[RING_SIZE];
+  };
+
+  struct Region
+  {
+    uint32_t magic;
+    std::atomic<uint32_t> init_done;
+    std::atomic<uint32_t> side_claimed[2];
+    Ring rings[2];                   //!< [0]: side0 -> side1, [1]: reverse
+  };
+
+  static constexpr uint32_t REGION_MAGIC = 0x4d43'5348;  // "MCSH"
+
+  std::string name;
+  Region * region;
+  int my_side;
+  bool segment_creator;
+
+  std::atomic<bool> should_exit;
+  std::thread rx_thread;
+  std::recursive_mutex mutex;
+  std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
+
+  Ring & tx_ring();
+  Ring & rx_ring();
+
+  //! @return false when the ring has no room for the record
+  bool ring_write(Ring & ring, const uint8_t * bytes, size_t length);
+  void rx_loop();
+
+  void send_buffer(const MsgBuffer & buf, const char * what);
+};
+
+}  // namespace mavconn
+
+#endif  // MAVCONN__SHM_HPP_
@@ -0,0 +1,108 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn link statistics
+ * @file stats.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#pragma once
+#ifndef MAVCONN__STATS_HPP_
+#define MAVCONN__STATS_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace mavconn
+{
+
+/**
+ * @brief Lock-free latency histogram with log2 buckets.
+ *
+ * Bucket i counts samples in [2^i, 2^(i+1)) microseconds, the last
+ * bucket collects the tail. record() is wait-free so it can sit on
+ * the io thread hot path; snapshot() reads are racy per-bucket but
+ * each counter is individually consistent, which is all monitoring
+ * needs.
+ */
+class LatencyHistogram
+{
+public:
+  //! 2^24 us ~ 16.7 s observable ceiling
+  static constexpr size_t BUCKET_COUNT = 24;
+
+  struct Snapshot
+  {
+    std::array<uint64_t, BUCKET_COUNT> buckets;
+    uint64_t count;     //!< total samples
+    uint64_t sum_us;    //!< sum of samples [us]
+    uint64_t max_us;    //!< largest sample [us]
+  };
+
+  void record(uint64_t us)
+  {
+    size_t bucket = 0;
+    for (uint64_t v = us; v > 1 && bucket < BUCKET_COUNT - 1; v >>= 1) {
+      bucket++;
+    }
+
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum_us.fetch_add(us, std::memory_order_relaxed);
+
+    uint64_t prev_max = max_us.load(std::memory_order_relaxed);
+    while (us > prev_max &&
+      !max_us.compare_exchange_weak(prev_max, us, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  Snapshot snapshot() const
+  {
+    Snapshot s;
+
+    for (size_t i = 0; i < BUCKET_COUNT; i++) {
+      s.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+    }
+    s.count = count.load(std::memory_order_relaxed);
+    s.sum_us = sum_us.load(std::memory_order_relaxed);
+    s.max_us = max_us.load(std::memory_order_relaxed);
+
+    return s;
+  }
+
+private:
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets{};
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> sum_us{0};
+  std::atomic<uint64_t> max_us{0};
+};
+
+/**
+ * @brief Per-channel statistics snapshot (see MAVConnInterface::get_stats()).
+ */
+struct ConnStats
+{
+  size_t tx_total_bytes;
+  size_t rx_total_bytes;
+  size_t tx_total_messages;
+  size_t rx_total_messages;
+  //! Tx queue residency: enqueue until fully written [us]
+  LatencyHistogram::Snapshot txq_residency;
+  //! Rx dispatch: frame complete until callbacks returned [us]
+  LatencyHistogram::Snapshot rx_dispatch;
+};
+
+}  // namespace mavconn
+
+#endif  // MAVCONN__STATS_HPP_
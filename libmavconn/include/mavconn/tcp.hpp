@@ -21,11 +21,13 @@
 
 #include <mavconn/interface.hpp>
 #include <mavconn/msgbuffer.hpp>
+#include <mavconn/msgbuffer_pool.hpp>
+#include <mavconn/prio_queue.hpp>
+#include <mavconn/thread_utils.hpp>
 
 #include <asio.hpp>
 #include <atomic>
 #include <cstring>
-#include <deque>
 #include <list>
 #include <memory>
 #include <string>
@@ -47,6 +49,11 @@ public:
 
   /**
    * Create generic TCP client (connect to the server)
+   *
+   * Resolve and connect run asynchronously on the io thread so
+   * construction returns immediately; port_opened_cb fires once the
+   * connection is established, messages sent before that are queued.
+   *
    * @param[id] server_addr    remote host
    * @param[id] server_port    remote port
    */
@@ -69,25 +76,53 @@ public:
   void send_message(const mavlink::mavlink_message_t * message) override;
   void send_message(const mavlink::Message & message, const uint8_t source_compid) override;
   void send_bytes(const uint8_t * bytes, size_t length) override;
+  void send_messages(const mavlink::mavlink_message_t * msgs, size_t count) override;
 
   inline bool is_open() override
   {
     return socket.is_open();
   }
 
+  bool set_io_thread_affinity(int cpu) override
+  {
+    if (!io_thread.joinable()) {
+      return false;
+    }
+    return utils::set_thread_affinity(io_thread.native_handle(), cpu);
+  }
+
+  bool set_io_thread_priority(int policy, int priority) override
+  {
+    if (!io_thread.joinable()) {
+      return false;
+    }
+    return utils::set_thread_priority(io_thread.native_handle(), policy, priority);
+  }
+
 private:
   friend class MAVConnTCPServer;
-  asio::io_service io_service;
+  std::unique_ptr<asio::io_service> own_io_service;
+  asio::io_service & io_service;
   std::unique_ptr<asio::io_service::work> io_work;
   std::thread io_thread;
 
+  std::string server_host;
+  uint16_t server_port;
+  asio::ip::tcp::resolver resolver;
   asio::ip::tcp::socket socket;
   asio::ip::tcp::endpoint server_ep;
 
   std::atomic<bool> is_destroying;
+  //! resolve/connect still pending: hold back Tx, allow close()
+  std::atomic<bool> conn_in_progress;
 
   std::atomic<bool> tx_in_progress;
-  std::deque<MsgBuffer> tx_q;
+  //! a frame of this band is partially on the wire: byte-stream
+  //! frames must complete before priorities are re-evaluated
+  bool tx_partial = false;
+  PrioTxQueue<MsgBufferPool::BufferPtr>::Band tx_band =
+    PrioTxQueue<MsgBufferPool::BufferPtr>::Band::status;
+  PrioTxQueue<MsgBufferPool::BufferPtr> tx_q;
   std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
   std::recursive_mutex mutex;
 
@@ -96,6 +131,8 @@ private:
    */
   void client_connected(size_t server_channel);
 
+  void do_resolve();
+  void do_connect(asio::ip::tcp::endpoint ep);
   void do_recv();
   void do_send(bool check_tx_state);
 };
@@ -135,7 +172,8 @@ public:
   }
 
 private:
-  asio::io_service io_service;
+  std::unique_ptr<asio::io_service> own_io_service;
+  asio::io_service & io_service;
   std::unique_ptr<asio::io_service::work> io_work;
   std::thread io_thread;
 
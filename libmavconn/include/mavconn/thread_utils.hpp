@@ -21,6 +21,11 @@
 #define MAVCONN__THREAD_UTILS_HPP_
 
 #include <pthread.h>
+#include <sched.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include <cstdio>
 #include <sstream>
@@ -82,6 +87,86 @@ inline const std::string to_string_ss(T & obj)
   return ss.str();
 }
 
+/**
+ * @brief Pin @p thread to one CPU
+ * @return true if success
+ *
+ * @note Only for Linux target
+ */
+inline bool set_thread_affinity(pthread_t thread, int cpu)
+{
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(thread, sizeof(set), &set) == 0;
+#else
+  (void)thread;
+  (void)cpu;
+  return false;
+#endif
+}
+
+//! @brief Pin current thread to one CPU
+inline bool set_this_thread_affinity(int cpu)
+{
+  return set_thread_affinity(pthread_self(), cpu);
+}
+
+/**
+ * @brief Set scheduling policy and priority of @p thread
+ *
+ * @param[in] policy    SCHED_FIFO / SCHED_RR / SCHED_OTHER
+ * @param[in] priority  1..99 for the realtime policies
+ * @return true if success (realtime policies need CAP_SYS_NICE)
+ */
+inline bool set_thread_priority(pthread_t thread, int policy, int priority)
+{
+  sched_param sp {};
+  sp.sched_priority = priority;
+  return pthread_setschedparam(thread, policy, &sp) == 0;
+}
+
+//! @brief Set scheduling policy and priority of current thread
+inline bool set_this_thread_priority(int policy, int priority)
+{
+  return set_thread_priority(pthread_self(), policy, priority);
+}
+
+#if defined(__linux__)
+/**
+ * @brief Put current thread under SCHED_DEADLINE
+ *
+ * glibc exposes no wrapper, so the attr struct and raw syscall are
+ * spelled out here.
+ *
+ * @return true if success (needs CAP_SYS_NICE)
+ */
+inline bool set_this_thread_deadline(
+  uint64_t runtime_us, uint64_t deadline_us, uint64_t period_us)
+{
+  struct sched_attr_
+  {
+    uint32_t size;
+    uint32_t sched_policy;
+    uint64_t sched_flags;
+    int32_t sched_nice;
+    uint32_t sched_priority;
+    uint64_t sched_runtime;
+    uint64_t sched_deadline;
+    uint64_t sched_period;
+  } attr {};
+
+  attr.size = sizeof(attr);
+  attr.sched_policy = 6;        // SCHED_DEADLINE
+  attr.sched_runtime = runtime_us * 1000;
+  attr.sched_deadline = deadline_us * 1000;
+  attr.sched_period = period_us * 1000;
+
+  return syscall(SYS_sched_setattr, 0, &attr, 0) == 0;
+}
+#endif
+
 constexpr size_t operator"" _KiB(unsigned long long sz)      // NOLINT
 {
   return sz * 1024;
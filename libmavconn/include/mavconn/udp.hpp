@@ -21,12 +21,18 @@
 
 #include <mavconn/interface.hpp>
 #include <mavconn/msgbuffer.hpp>
+#include <mavconn/msgbuffer_pool.hpp>
+#include <mavconn/prio_queue.hpp>
+#include <mavconn/thread_utils.hpp>
 
 #include <asio.hpp>
+#include <array>
+#include <chrono>
+#include <unordered_map>
 #include <atomic>
-#include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace mavconn
 {
@@ -48,17 +54,22 @@ public:
   static constexpr auto BROADCAST_REMOTE_HOST = "***i want broadcast***";
   static constexpr auto PERMANENT_BROADCAST_REMOTE_HOST = "***permanent broadcast***";
 
+  //! Maximum count of datagrams pulled by one recvmmsg(2) call.
+  static constexpr size_t MAX_RX_BATCH = 32;
+
   /**
    * @param[id] bind_host    bind host
    * @param[id] bind_port    bind port
    * @param[id] remote_host  remote host (optional)
    * @param[id] remote_port  remote port (optional)
+   * @param[id] rx_batch     datagrams per receive syscall (optional, Linux only)
    */
   MAVConnUDP(
     uint8_t system_id = 1, uint8_t component_id = MAV_COMP_ID_UDP_BRIDGE,
     std::string bind_host = DEFAULT_BIND_HOST, uint16_t bind_port = DEFAULT_BIND_PORT,
     std::string remote_host = DEFAULT_REMOTE_HOST,
-    uint16_t remote_port = DEFAULT_REMOTE_PORT);
+    uint16_t remote_port = DEFAULT_REMOTE_PORT,
+    size_t rx_batch = 1);
 
   virtual ~MAVConnUDP();
 
@@ -67,6 +78,7 @@ public:
   void send_message(const mavlink::mavlink_message_t * message) override;
   void send_message(const mavlink::Message & message, const uint8_t source_compid) override;
   void send_bytes(const uint8_t * bytes, size_t length) override;
+  void send_messages(const mavlink::mavlink_message_t * msgs, size_t count) override;
 
   inline bool is_open() override
   {
@@ -75,12 +87,45 @@ public:
 
   std::string get_remote_endpoint() const;
 
+  bool set_io_thread_affinity(int cpu) override
+  {
+    if (!io_thread.joinable()) {
+      return false;
+    }
+    return utils::set_thread_affinity(io_thread.native_handle(), cpu);
+  }
+
+  bool set_io_thread_priority(int policy, int priority) override
+  {
+    if (!io_thread.joinable()) {
+      return false;
+    }
+    return utils::set_thread_priority(io_thread.native_handle(), policy, priority);
+  }
+
+protected:
+  bool accept_message(const mavlink::mavlink_message_t & msg) override;
+
 private:
-  asio::io_service io_service;
+  std::unique_ptr<asio::io_service> own_io_service;
+  asio::io_service & io_service;
   std::unique_ptr<asio::io_service::work> io_work;
   std::thread io_thread;
   bool permanent_broadcast;
 
+  //! Drop repeated (sysid, compid, seq) within this window (fan-out Rx dedup).
+  static constexpr int64_t RX_DEDUP_WINDOW_MS = 500;
+
+  struct DedupEntry
+  {
+    uint8_t seq;
+    std::chrono::time_point<std::chrono::steady_clock> stamp;
+  };
+
+  //! "last writer" per-source table, io thread only
+  std::unordered_map<uint16_t, DedupEntry> rx_dedup;
+  bool rx_dedup_enabled;
+
   std::atomic<bool> remote_exists;
   asio::ip::udp::socket socket;
   asio::ip::udp::endpoint remote_ep;
@@ -89,12 +134,33 @@ private:
   asio::ip::udp::endpoint bind_ep;
 
   std::atomic<bool> tx_in_progress;
-  std::deque<MsgBuffer> tx_q;
+  PrioTxQueue<MsgBufferPool::BufferPtr> tx_q;
   std::array<uint8_t, MsgBuffer::MAX_SIZE> rx_buf;
+  size_t rx_batch_size;
+  std::vector<std::array<uint8_t, MsgBuffer::MAX_SIZE>> rx_batch_buf;
   std::recursive_mutex mutex;
 
+  //! Maximum count of datagrams dispatched by one sendmmsg(2) call.
+  static constexpr size_t MAX_TX_BATCH = 16;
+
   void do_recvfrom();
   void do_sendto(bool check_tx_state);
+
+#if defined(__linux__)
+  /**
+   * Drain up to MAX_TX_BATCH queued datagrams with a single
+   * non-blocking sendmmsg(2) call.
+   *
+   * @return true if the Tx queue was fully drained.
+   */
+  bool try_sendmmsg(PrioTxQueue<MsgBufferPool::BufferPtr>::Band band);
+
+  /**
+   * Pull up to rx_batch_size datagrams with a single non-blocking
+   * recvmmsg(2) call and run the parser over all of them.
+   */
+  void do_recvmmsg();
+#endif
 };
 
 }  // namespace mavconn
@@ -0,0 +1,226 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn stream capture and replay
+ * @file capture.cpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#include <mavconn/capture.hpp>
+#include <mavconn/console_bridge_compat.hpp>
+#include <mavconn/thread_utils.hpp>
+
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace mavconn
+{
+
+using mavlink::mavlink_message_t;
+
+#define PFX "mavconn: capture"
+#define PFXd PFX "%zu: "
+
+/* -*- CaptureWriter -*- */
+
+CaptureWriter::CaptureWriter(const std::string & path_, size_t rotate_size_)
+: path(path_),
+  rotate_size(rotate_size_),
+  written(0),
+  file(nullptr)
+{
+  open_file();
+  if (file == nullptr) {
+    throw DeviceError("capture: open", errno);
+  }
+}
+
+CaptureWriter::~CaptureWriter()
+{
+  if (file != nullptr) {
+    std::fclose(file);
+  }
+}
+
+void CaptureWriter::open_file()
+{
+  file = std::fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    return;
+  }
+
+  std::fwrite(CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC), 1, file);
+  written = sizeof(CAPTURE_MAGIC);
+}
+
+void CaptureWriter::rotate()
+{
+  std::fclose(file);
+  file = nullptr;
+
+  const auto backup = path + ".1";
+  std::rename(path.c_str(), backup.c_str());
+
+  open_file();
+}
+
+void CaptureWriter::append(uint64_t stamp_ns, const uint8_t * frame, size_t len)
+{
+  if (file == nullptr) {
+    return;
+  }
+
+  if (written >= rotate_size) {
+    rotate();
+    if (file == nullptr) {
+      return;
+    }
+  }
+
+  CaptureRecord rec;
+  rec.stamp_ns = stamp_ns;
+  rec.len = len;
+
+  std::fwrite(&rec, sizeof(rec), 1, file);
+  std::fwrite(frame, 1, len, file);
+  written += sizeof(rec) + len;
+}
+
+/* -*- MAVConnReplay -*- */
+
+MAVConnReplay::MAVConnReplay(
+  uint8_t system_id, uint8_t component_id,
+  std::string path_, double speed_)
+: MAVConnInterface(system_id, component_id),
+  path(path_),
+  speed((speed_ > 0.0) ? speed_ : 1.0),
+  file(nullptr),
+  should_exit(false),
+  rx_buf{}
+{
+  file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    throw DeviceError("replay: open", errno);
+  }
+
+  char magic[sizeof(CAPTURE_MAGIC)];
+  if (std::fread(magic, sizeof(magic), 1, file) != 1 ||
+    std::memcmp(magic, CAPTURE_MAGIC, sizeof(magic)) != 0)
+  {
+    std::fclose(file);
+    throw DeviceError("replay: open", "not a capture file");
+  }
+
+  CONSOLE_BRIDGE_logInform(
+    PFXd "replaying %s at %0.1fx", conn_id, path.c_str(), speed);
+
+  replay_thread = std::thread(
+    [this]() {
+      utils::set_this_thread_name("mreplay%zu", conn_id);
+      replay_loop();
+    });
+}
+
+MAVConnReplay::~MAVConnReplay()
+{
+  close();
+}
+
+void MAVConnReplay::close()
+{
+  lock_guard lock(mutex);
+  if (should_exit) {
+    return;
+  }
+
+  should_exit = true;
+  if (replay_thread.joinable()) {
+    replay_thread.join();
+  }
+
+  if (file != nullptr) {
+    std::fclose(file);
+    file = nullptr;
+  }
+
+  if (port_closed_cb) {
+    port_closed_cb();
+  }
+}
+
+void MAVConnReplay::replay_loop()
+{
+  uint64_t first_stamp_ns = 0;
+  const auto start = steady_clock::now();
+
+  while (!should_exit) {
+    CaptureRecord rec;
+    if (std::fread(&rec, sizeof(rec), 1, file) != 1) {
+      break;    // end of capture
+    }
+
+    if (rec.len > rx_buf.size()) {
+      CONSOLE_BRIDGE_logError(PFXd "corrupt record length %u", conn_id, rec.len);
+      break;
+    }
+
+    if (std::fread(rx_buf.data(), 1, rec.len, file) != rec.len) {
+      break;
+    }
+
+    if (first_stamp_ns == 0) {
+      first_stamp_ns = rec.stamp_ns;
+    }
+
+    // reproduce original inter-frame timing, scaled by speed;
+    // sleep in slices so close() is not blocked by long gaps
+    const auto due = start + std::chrono::nanoseconds(
+      static_cast<int64_t>((rec.stamp_ns - first_stamp_ns) / speed));
+    while (!should_exit && steady_clock::now() < due) {
+      const auto left = due - steady_clock::now();
+      std::this_thread::sleep_for(
+        std::min<std::chrono::nanoseconds>(left, std::chrono::milliseconds(100)));
+    }
+
+    if (should_exit) {
+      break;
+    }
+
+    parse_buffer(PFX, rx_buf.data(), rx_buf.size(), rec.len);
+  }
+
+  CONSOLE_BRIDGE_logInform(PFXd "replay finished", conn_id);
+}
+
+void MAVConnReplay::send_message(const mavlink_message_t * message)
+{
+  assert(message != nullptr);
+  CONSOLE_BRIDGE_logDebug(PFXd "send: replay link is a sink", conn_id);
+}
+
+void MAVConnReplay::send_message(
+  const mavlink::Message & message [[maybe_unused]],
+  const uint8_t source_compid [[maybe_unused]])
+{
+  CONSOLE_BRIDGE_logDebug(PFXd "send: replay link is a sink", conn_id);
+}
+
+void MAVConnReplay::send_bytes(
+  const uint8_t * bytes [[maybe_unused]], size_t length [[maybe_unused]])
+{
+  CONSOLE_BRIDGE_logDebug(PFXd "send: replay link is a sink", conn_id);
+}
+
+}  // namespace mavconn
@@ -15,14 +15,21 @@
  * @{
  */
 
+#include <mavconn/capture.hpp>
 #include <mavconn/console_bridge_compat.hpp>
 #include <mavconn/interface.hpp>
 #include <mavconn/msgbuffer.hpp>
 #include <mavconn/serial.hpp>
+#if defined(__linux__)
+#include <mavconn/shm.hpp>
+#endif
 #include <mavconn/tcp.hpp>
 #include <mavconn/udp.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <set>
 #include <string>
@@ -40,6 +47,8 @@ std::once_flag MAVConnInterface::init_flag;
 std::unordered_map<mavlink::msgid_t,
   const mavlink::mavlink_msg_entry_t *>
 MAVConnInterface::message_entries {};
+std::array<const mavlink::mavlink_msg_entry_t *, 1024>
+MAVConnInterface::message_entry_index {};
 std::atomic<size_t> MAVConnInterface::conn_id_counter {0};
 
 MAVConnInterface::MAVConnInterface(uint8_t system_id, uint8_t component_id)
@@ -48,16 +57,36 @@ MAVConnInterface::MAVConnInterface(uint8_t system_id, uint8_t component_id)
   m_parse_status{},
   m_buffer{},
   m_mavlink_status{},
+  m_signing{},
+  m_signing_streams{},
+  tx_rate_limit(0),
+  remote_txbuf(255),
+  tx_tokens(0.0),
+  tx_last_refill(steady_clock::now()),
   tx_total_bytes(0),
   rx_total_bytes(0),
+  tx_total_messages(0),
+  rx_total_messages(0),
   last_tx_total_bytes(0),
   last_rx_total_bytes(0),
-  last_iostat(steady_clock::now())
+  last_iostat_ns(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+      steady_clock::now().time_since_epoch()).count())
 {
   conn_id = conn_id_counter.fetch_add(1);
   std::call_once(init_flag, init_msg_entry);
 }
 
+MAVConnInterface::~MAVConnInterface()
+{
+}
+
+void MAVConnInterface::enable_capture(const std::string & path)
+{
+  capture.reset(new CaptureWriter(path));
+  CONSOLE_BRIDGE_logInform(PFX "%zu: capturing to %s", conn_id, path.c_str());
+}
+
 mavlink_status_t MAVConnInterface::get_status()
 {
   return m_mavlink_status;
@@ -65,22 +94,23 @@ mavlink_status_t MAVConnInterface::get_status()
 
 MAVConnInterface::IOStat MAVConnInterface::get_iostat()
 {
-  std::lock_guard<std::recursive_mutex> lock(iostat_mutex);
+  // lock-free snapshot: counters are atomic and the speed-window
+  // state advances via exchange, so the diagnostics tick never takes
+  // a lock the io path could contend on
   IOStat stat;
 
   stat.tx_total_bytes = tx_total_bytes;
   stat.rx_total_bytes = rx_total_bytes;
 
-  auto d_tx = stat.tx_total_bytes - last_tx_total_bytes;
-  auto d_rx = stat.rx_total_bytes - last_rx_total_bytes;
-  last_tx_total_bytes = stat.tx_total_bytes;
-  last_rx_total_bytes = stat.rx_total_bytes;
+  auto d_tx = stat.tx_total_bytes - last_tx_total_bytes.exchange(stat.tx_total_bytes);
+  auto d_rx = stat.rx_total_bytes - last_rx_total_bytes.exchange(stat.rx_total_bytes);
 
-  auto now = steady_clock::now();
-  auto dt = now - last_iostat;
-  last_iostat = now;
+  const int64_t now_ns =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+    steady_clock::now().time_since_epoch()).count();
+  const int64_t dt_ns = now_ns - last_iostat_ns.exchange(now_ns);
 
-  float dt_s = std::chrono::duration_cast<std::chrono::seconds>(dt).count();
+  float dt_s = dt_ns / 1e9f;
 
   stat.tx_speed = d_tx / dt_s;
   stat.rx_speed = d_rx / dt_s;
@@ -88,38 +118,201 @@ MAVConnInterface::IOStat MAVConnInterface::get_iostat()
   return stat;
 }
 
+ConnStats MAVConnInterface::get_stats()
+{
+  ConnStats stats;
+
+  stats.tx_total_bytes = tx_total_bytes;
+  stats.rx_total_bytes = rx_total_bytes;
+  stats.tx_total_messages = tx_total_messages;
+  stats.rx_total_messages = rx_total_messages;
+  stats.txq_residency = txq_residency_hist.snapshot();
+  stats.rx_dispatch = rx_dispatch_hist.snapshot();
+
+  return stats;
+}
+
+void MAVConnInterface::stat_tx_complete(const MsgBuffer & buf)
+{
+  tx_total_messages.fetch_add(1, std::memory_order_relaxed);
+  txq_residency_hist.record(
+    std::chrono::duration_cast<std::chrono::microseconds>(
+      steady_clock::now() - buf.stamp).count());
+}
+
 void MAVConnInterface::iostat_tx_add(size_t bytes)
 {
   tx_total_bytes += bytes;
 }
 
+size_t MAVConnInterface::tx_tokens_available()
+{
+  size_t rate = tx_rate_limit;
+  if (rate == 0) {
+    return std::numeric_limits<size_t>::max();
+  }
+
+  // radio flow control: back off while the modem buffer runs low
+  const uint8_t txbuf = remote_txbuf.load(std::memory_order_relaxed);
+  if (txbuf < 25) {
+    rate /= 4;
+  } else if (txbuf < 50) {
+    rate /= 2;
+  }
+
+  const auto now = steady_clock::now();
+  const double dt = std::chrono::duration<double>(now - tx_last_refill).count();
+  tx_last_refill = now;
+
+  // allow 100 ms of burst, but never less than one packet
+  const double burst = std::max<double>(MAX_PACKET_SIZE, rate / 10.0);
+  tx_tokens = std::min(burst, tx_tokens + dt * rate);
+
+  return (tx_tokens <= 0.0) ? 0 : static_cast<size_t>(tx_tokens);
+}
+
+void MAVConnInterface::tx_tokens_consume(size_t bytes)
+{
+  if (tx_rate_limit != 0) {
+    tx_tokens -= static_cast<double>(bytes);
+  }
+}
+
+std::chrono::microseconds MAVConnInterface::tx_token_wait(size_t bytes)
+{
+  const size_t rate = tx_rate_limit;
+  if (rate == 0) {
+    return std::chrono::microseconds(0);
+  }
+
+  const double need = static_cast<double>(bytes) - tx_tokens;
+  if (need <= 0.0) {
+    return std::chrono::microseconds(0);
+  }
+
+  return std::chrono::microseconds(static_cast<int64_t>(need / rate * 1e6) + 1);
+}
+
 void MAVConnInterface::iostat_rx_add(size_t bytes)
 {
   rx_total_bytes += bytes;
 }
 
+/**
+ * Length of @p msg as it appeared on the wire.
+ *
+ * Relies on msg.len being the (v2: zero-truncated) payload length
+ * that was actually received.
+ */
+static size_t frame_wire_length(const mavlink::mavlink_message_t & msg)
+{
+  if (msg.magic == MAVLINK_STX) {
+    size_t len = msg.len + MAVLINK_NUM_NON_PAYLOAD_BYTES;
+    if (msg.incompat_flags & MAVLINK_IFLAG_SIGNED) {
+      len += MAVLINK_SIGNATURE_BLOCK_LEN;
+    }
+    return len;
+  }
+
+  // v1.0: STX + 5 byte header + payload + CRC
+  return msg.len + 8;
+}
+
+/**
+ * Position of the next frame start candidate.
+ *
+ * memchr() is vectorized by libc, so resync after corruption scans
+ * the buffer in SIMD-register chunks instead of feeding garbage
+ * byte-by-byte through the parser state machine.
+ */
+static const uint8_t * find_stx_candidate(const uint8_t * buf, size_t len)
+{
+  auto v2 = static_cast<const uint8_t *>(std::memchr(buf, MAVLINK_STX, len));
+  auto v1 = static_cast<const uint8_t *>(std::memchr(buf, MAVLINK_STX_MAVLINK1, len));
+
+  if (v2 == nullptr) {
+    return v1;
+  }
+  if (v1 == nullptr) {
+    return v2;
+  }
+
+  return std::min(v1, v2);
+}
+
 void MAVConnInterface::parse_buffer(
   const char * pfx, uint8_t * buf, const size_t bufsize,
   size_t bytes_received)
 {
   mavlink::mavlink_message_t message;
+  const uint8_t * const buf_begin = buf;
 
   assert(bufsize >= bytes_received);
 
   iostat_rx_add(bytes_received);
-  for (; bytes_received > 0; bytes_received--) {
+  while (bytes_received > 0) {
+    if (m_parse_status.parse_state <= mavlink::MAVLINK_PARSE_STATE_IDLE) {
+      // between frames: jump straight to the next STX candidate
+      auto stx = find_stx_candidate(buf, bytes_received);
+      if (stx == nullptr) {
+        return;
+      }
+
+      bytes_received -= stx - buf;
+      buf = const_cast<uint8_t *>(stx);
+    }
+
+    bytes_received--;
     auto c = *buf++;
 
-    auto msg_received = static_cast<Framing>(mavlink::mavlink_frame_char_buffer(
-        &m_buffer, &m_parse_status, c,
-        &message, &m_mavlink_status));
+    Framing msg_received;
+    {
+      // signature verification updates the signing timestamp and
+      // stream cache shared with the Tx finalize path
+      auto slock = signing_lock();
+      msg_received = static_cast<Framing>(mavlink::mavlink_frame_char_buffer(
+          &m_buffer, &m_parse_status, c,
+          &message, &m_mavlink_status));
+    }
 
     if (msg_received != Framing::incomplete) {
       log_recv(pfx, message, msg_received);
 
+      if (!accept_message(message)) {
+        continue;
+      }
+
+      const auto t_dispatch = steady_clock::now();
+
+      if (message_received_bytes_cb || capture) {
+        // frame ends at the byte just consumed; it is only
+        // addressable when it began inside this buffer
+        const size_t end_offset = buf - buf_begin;
+        const size_t wire_len = frame_wire_length(message);
+        const uint8_t * frame =
+          (wire_len <= end_offset) ? (buf_begin + (end_offset - wire_len)) : nullptr;
+
+        if (capture && frame != nullptr) {
+          capture->append(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+              steady_clock::now().time_since_epoch()).count(),
+            frame, wire_len);
+        }
+
+        if (message_received_bytes_cb) {
+          message_received_bytes_cb(
+            &message, msg_received, frame, (frame != nullptr) ? wire_len : 0);
+        }
+      }
+
       if (message_received_cb) {
         message_received_cb(&message, msg_received);
       }
+
+      rx_total_messages.fetch_add(1, std::memory_order_relaxed);
+      rx_dispatch_hist.record(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+          steady_clock::now() - t_dispatch).count());
     }
   }
 }
@@ -183,6 +376,57 @@ void MAVConnInterface::send_message_ignore_drop(const mavlink::Message & msg, ui
   }
 }
 
+bool MAVConnInterface::setup_signing(
+  const uint8_t * secret_key, size_t key_len,
+  uint64_t initial_timestamp)
+{
+  if (key_len != sizeof(m_signing.secret_key)) {
+    CONSOLE_BRIDGE_logError(PFX "%zu: signing: bad key length %zu", conn_id, key_len);
+    return false;
+  }
+
+  std::lock_guard<std::mutex> slock(m_signing_mutex);
+
+  std::memcpy(m_signing.secret_key, secret_key, key_len);
+  m_signing.link_id = conn_id & 0xff;
+  m_signing.timestamp = initial_timestamp;
+  m_signing.flags = MAVLINK_SIGNING_FLAG_SIGN_OUTGOING;
+  m_signing.accept_unsigned_callback = nullptr;
+
+  // finalize path signs outgoing, parse path verifies incoming
+  m_mavlink_status.signing = &m_signing;
+  m_mavlink_status.signing_streams = &m_signing_streams;
+  m_parse_status.signing = &m_signing;
+  m_parse_status.signing_streams = &m_signing_streams;
+
+  CONSOLE_BRIDGE_logInform(
+    PFX "%zu: MAVLink2 signing enabled "
+    "(typed sends only, forwarded frames pass through as-is)", conn_id);
+  return true;
+}
+
+void MAVConnInterface::disable_signing()
+{
+  std::lock_guard<std::mutex> slock(m_signing_mutex);
+
+  m_mavlink_status.signing = nullptr;
+  m_mavlink_status.signing_streams = nullptr;
+  m_parse_status.signing = nullptr;
+  m_parse_status.signing_streams = nullptr;
+
+  std::memset(m_signing.secret_key, 0, sizeof(m_signing.secret_key));
+}
+
+uint64_t MAVConnInterface::get_signing_timestamp()
+{
+  if (m_mavlink_status.signing == nullptr) {
+    return 0;
+  }
+
+  std::lock_guard<std::mutex> slock(m_signing_mutex);
+  return m_signing.timestamp;
+}
+
 void MAVConnInterface::set_protocol_version(Protocol pver)
 {
   if (pver == Protocol::V10) {
@@ -237,39 +481,80 @@ static void url_parse_host(
 }
 
 /**
- * Parse ?ids=sid,cid
+ * Parse ?ids=sid,cid&rx_batch=n&rate_limit=bps&speed=x
+ *
+ * @p rx_batch and @p rate_limit are only accepted when the caller
+ * supplies a slot for them (UDP resp. serial links), else reported
+ * as unknown.
  */
-static void url_parse_query(const std::string & query, uint8_t & sysid, uint8_t & compid)
+static void url_parse_query(
+  const std::string & query, uint8_t & sysid, uint8_t & compid,
+  size_t * rx_batch = nullptr, size_t * rate_limit = nullptr,
+  double * speed = nullptr,
+  int * io_cpu = nullptr, int * io_prio = nullptr,
+  bool * low_latency = nullptr)
 {
-  const std::string ids_end("ids=");
-  std::string sys, comp;
-
   if (query.empty()) {
     return;
   }
 
-  auto ids_it = std::search(
-    query.begin(), query.end(),
-    ids_end.begin(), ids_end.end());
-  if (ids_it == query.end()) {
-    CONSOLE_BRIDGE_logWarn(PFX "URL: unknown query arguments");
-    return;
-  }
+  std::istringstream iss(query);
+  std::string kv;
+  while (std::getline(iss, kv, '&')) {
+    auto eq_it = std::find(kv.begin(), kv.end(), '=');
+    if (eq_it == kv.end()) {
+      CONSOLE_BRIDGE_logWarn(PFX "URL: unknown query arguments");
+      continue;
+    }
 
-  std::advance(ids_it, ids_end.length());
-  auto comma_it = std::find(ids_it, query.end(), ',');
-  if (comma_it == query.end()) {
-    CONSOLE_BRIDGE_logError(PFX "URL: no comma in ids= query");
-    return;
-  }
+    std::string key(kv.begin(), eq_it);
+    std::string value(eq_it + 1, kv.end());
+
+    if (key == "ids") {
+      auto comma_it = std::find(value.begin(), value.end(), ',');
+      if (comma_it == value.end()) {
+        CONSOLE_BRIDGE_logError(PFX "URL: no comma in ids= query");
+        continue;
+      }
 
-  sys.assign(ids_it, comma_it);
-  comp.assign(comma_it + 1, query.end());
+      sysid = std::stoi(std::string(value.begin(), comma_it));
+      compid = std::stoi(std::string(comma_it + 1, value.end()));
+
+      CONSOLE_BRIDGE_logDebug(PFX "URL: found system/component id = [%u, %u]", sysid, compid);
+    } else if (key == "rx_batch" && rx_batch != nullptr) {
+      *rx_batch = std::stoi(value);
+      CONSOLE_BRIDGE_logDebug(PFX "URL: found rx_batch = %zu", *rx_batch);
+    } else if (key == "rate_limit" && rate_limit != nullptr) {
+      *rate_limit = std::stoul(value);
+      CONSOLE_BRIDGE_logDebug(PFX "URL: found rate_limit = %zu", *rate_limit);
+    } else if (key == "speed" && speed != nullptr) {
+      *speed = std::stod(value);
+      CONSOLE_BRIDGE_logDebug(PFX "URL: found speed = %f", *speed);
+    } else if (key == "io_cpu" && io_cpu != nullptr) {
+      *io_cpu = std::stoi(value);
+      CONSOLE_BRIDGE_logDebug(PFX "URL: found io_cpu = %d", *io_cpu);
+    } else if (key == "io_prio" && io_prio != nullptr) {
+      *io_prio = std::stoi(value);
+      CONSOLE_BRIDGE_logDebug(PFX "URL: found io_prio = %d", *io_prio);
+    } else if (key == "low_latency" && low_latency != nullptr) {
+      *low_latency = std::stoi(value) != 0;
+      CONSOLE_BRIDGE_logDebug(PFX "URL: found low_latency = %d", *low_latency);
+    } else {
+      CONSOLE_BRIDGE_logWarn(PFX "URL: unknown query arguments");
+    }
+  }
+}
 
-  sysid = std::stoi(sys);
-  compid = std::stoi(comp);
 
-  CONSOLE_BRIDGE_logDebug(PFX "URL: found system/component id = [%u, %u]", sysid, compid);
+//! apply ?io_cpu= / ?io_prio= tuning to a fresh connection
+static void apply_io_thread_tuning(MAVConnInterface::Ptr ptr, int io_cpu, int io_prio)
+{
+  if (io_cpu >= 0 && !ptr->set_io_thread_affinity(io_cpu)) {
+    CONSOLE_BRIDGE_logWarn(PFX "URL: io thread affinity failed");
+  }
+  if (io_prio > 0 && !ptr->set_io_thread_priority(SCHED_FIFO, io_prio)) {
+    CONSOLE_BRIDGE_logWarn(PFX "URL: io thread priority failed (CAP_SYS_NICE?)");
+  }
 }
 
 static MAVConnInterface::Ptr url_parse_serial(
@@ -278,16 +563,24 @@ static MAVConnInterface::Ptr url_parse_serial(
 {
   std::string file_path;
   int baudrate;
+  size_t rate_limit = 0;
+  int io_cpu = -1, io_prio = 0;
+  bool low_latency = true;
 
   // /dev/ttyACM0:57600
   url_parse_host(
     path, file_path, baudrate, MAVConnSerial::DEFAULT_DEVICE,
     MAVConnSerial::DEFAULT_BAUDRATE);
-  url_parse_query(query, system_id, component_id);
+  url_parse_query(
+    query, system_id, component_id, nullptr, &rate_limit, nullptr,
+    &io_cpu, &io_prio, &low_latency);
 
-  return std::make_shared<MAVConnSerial>(
+  auto ptr = std::make_shared<MAVConnSerial>(
     system_id, component_id,
-    file_path, baudrate, hwflow);
+    file_path, baudrate, hwflow, low_latency);
+  ptr->set_tx_rate_limit(rate_limit);
+  apply_io_thread_tuning(ptr, io_cpu, io_prio);
+  return ptr;
 }
 
 static MAVConnInterface::Ptr url_parse_udp(
@@ -297,6 +590,8 @@ static MAVConnInterface::Ptr url_parse_udp(
   std::string bind_pair, remote_pair;
   std::string bind_host, remote_host;
   int bind_port, remote_port;
+  size_t rx_batch = 1;
+  int io_cpu = -1, io_prio = 0;
 
   auto sep_it = std::find(hosts.begin(), hosts.end(), '@');
   if (sep_it == hosts.end()) {
@@ -312,7 +607,7 @@ static MAVConnInterface::Ptr url_parse_udp(
   url_parse_host(
     remote_pair, remote_host, remote_port, MAVConnUDP::DEFAULT_REMOTE_HOST,
     MAVConnUDP::DEFAULT_REMOTE_PORT);
-  url_parse_query(query, system_id, component_id);
+  url_parse_query(query, system_id, component_id, &rx_batch, nullptr, nullptr, &io_cpu, &io_prio);
 
   if (is_udpb) {
     remote_host =
@@ -320,10 +615,39 @@ static MAVConnInterface::Ptr url_parse_udp(
       BROADCAST_REMOTE_HOST;
   }
 
-  return std::make_shared<MAVConnUDP>(
+  auto ptr = std::make_shared<MAVConnUDP>(
     system_id, component_id,
     bind_host, bind_port,
-    remote_host, remote_port);
+    remote_host, remote_port,
+    rx_batch);
+  apply_io_thread_tuning(ptr, io_cpu, io_prio);
+  return ptr;
+}
+
+#if defined(__linux__)
+static MAVConnInterface::Ptr url_parse_shm(
+  const std::string & path, const std::string & query,
+  uint8_t system_id, uint8_t component_id)
+{
+  // shm:///segment-name
+  std::string name = path.empty() ? MAVConnSHM::DEFAULT_SEGMENT_NAME : path;
+
+  url_parse_query(query, system_id, component_id);
+
+  return std::make_shared<MAVConnSHM>(system_id, component_id, name);
+}
+#endif
+
+static MAVConnInterface::Ptr url_parse_replay(
+  const std::string & path, const std::string & query,
+  uint8_t system_id, uint8_t component_id)
+{
+  // replay:///path/to/capture?speed=2
+  double speed = 1.0;
+
+  url_parse_query(query, system_id, component_id, nullptr, nullptr, &speed);
+
+  return std::make_shared<MAVConnReplay>(system_id, component_id, path, speed);
 }
 
 static MAVConnInterface::Ptr url_parse_tcp_client(
@@ -332,14 +656,17 @@ static MAVConnInterface::Ptr url_parse_tcp_client(
 {
   std::string server_host;
   int server_port;
+  int io_cpu = -1, io_prio = 0;
 
   // tcp://localhost:5760
   url_parse_host(host, server_host, server_port, "localhost", 5760);
-  url_parse_query(query, system_id, component_id);
+  url_parse_query(query, system_id, component_id, nullptr, nullptr, nullptr, &io_cpu, &io_prio);
 
-  return std::make_shared<MAVConnTCPClient>(
+  auto ptr = std::make_shared<MAVConnTCPClient>(
     system_id, component_id,
     server_host, server_port);
+  apply_io_thread_tuning(ptr, io_cpu, io_prio);
+  return ptr;
 }
 
 static MAVConnInterface::Ptr url_parse_tcp_server(
@@ -419,6 +746,14 @@ MAVConnInterface::Ptr MAVConnInterface::open_url(
     return url_parse_tcp_client(host, query, system_id, component_id);
   } else if (proto == "tcp-l") {
     return url_parse_tcp_server(host, query, system_id, component_id);
+  } else if (proto == "replay") {
+    return url_parse_replay(path, query, system_id, component_id);
+  } else if (proto == "shm") {
+#if defined(__linux__)
+    return url_parse_shm(path, query, system_id, component_id);
+#else
+    throw DeviceError("url", "shm transport is only available on Linux");
+#endif
   } else if (proto == "serial") {
     return url_parse_serial(path, query, system_id, component_id, false);
   } else if (proto == "serial-hwfc") {
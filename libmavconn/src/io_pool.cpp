@@ -0,0 +1,116 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn shared io thread pool
+ * @file io_pool.cpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#include <mavconn/console_bridge_compat.hpp>
+#include <mavconn/io_pool.hpp>
+#include <mavconn/thread_utils.hpp>
+
+#include <future>
+
+namespace mavconn
+{
+
+#define PFX "mavconn: io_pool: "
+
+using lock_guard = std::lock_guard<std::recursive_mutex>;
+
+IOServicePool & IOServicePool::instance()
+{
+  static IOServicePool pool;
+  return pool;
+}
+
+void IOServicePool::start(size_t thread_count)
+{
+  lock_guard lock(mutex);
+
+  if (io_service_ptr) {
+    CONSOLE_BRIDGE_logWarn(PFX "already started");
+    return;
+  }
+
+  if (thread_count != 1) {
+    // transports consume their Tx queues under a single-io-consumer
+    // invariant; more threads would need a strand per connection
+    CONSOLE_BRIDGE_logWarn(PFX "clamping to one io thread (requested %zu)", thread_count);
+    thread_count = 1;
+  }
+
+  CONSOLE_BRIDGE_logInform(PFX "starting io thread");
+
+  io_service_ptr.reset(new asio::io_service(1));
+  io_work.reset(new asio::io_service::work(*io_service_ptr));
+
+  threads.emplace_back(
+    [this]() {
+      utils::set_this_thread_name("mpool0");
+      pool_thread_id = std::this_thread::get_id();
+      io_service_ptr->run();
+    });
+}
+
+void IOServicePool::stop()
+{
+  lock_guard lock(mutex);
+
+  if (!io_service_ptr) {
+    return;
+  }
+
+  io_work.reset();
+  io_service_ptr->stop();
+
+  for (auto & thd : threads) {
+    if (thd.joinable()) {
+      thd.join();
+    }
+  }
+
+  threads.clear();
+  io_service_ptr.reset();
+}
+
+void IOServicePool::flush()
+{
+  asio::io_service * io = nullptr;
+
+  {
+    lock_guard lock(mutex);
+    if (!io_service_ptr || std::this_thread::get_id() == pool_thread_id) {
+      return;
+    }
+    io = io_service_ptr.get();
+  }
+
+  std::promise<void> done;
+  io->post([&done]() {done.set_value();});
+  done.get_future().wait();
+}
+
+bool IOServicePool::is_running()
+{
+  lock_guard lock(mutex);
+  return io_service_ptr != nullptr;
+}
+
+asio::io_service & IOServicePool::io_service()
+{
+  lock_guard lock(mutex);
+  return *io_service_ptr;
+}
+
+}  // namespace mavconn
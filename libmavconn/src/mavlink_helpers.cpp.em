@@ -54,6 +54,12 @@ void MAVConnInterface::init_msg_entry()
 
   @[for dialect in MAVLINK_V20_DIALECTS]for (auto &e : mavlink::@dialect::MESSAGE_ENTRIES) @(' ' * (20 - len(dialect))) load("@dialect", e);
   @[end for]
+  // dense direct index for the hot lookup path
+  for (auto &kv : message_entries) {
+    if (kv.first < message_entry_index.size()) {
+      message_entry_index[kv.first] = kv.second;
+    }
+  }
 }
 
 std::vector<std::string> MAVConnInterface::get_known_dialects()
@@ -70,6 +76,10 @@ std::vector<std::string> MAVConnInterface::get_known_dialects()
  */
 const mavlink::mavlink_msg_entry_t* mavlink::mavlink_get_msg_entry(uint32_t msgid)
 {
+  // common msgids resolve with a single array load
+  if (msgid < MAVConnInterface::message_entry_index.size())
+    return MAVConnInterface::message_entry_index[msgid];
+
   auto it = MAVConnInterface::message_entries.find(msgid);
   if (it != MAVConnInterface::message_entries.end())
     return it->second;
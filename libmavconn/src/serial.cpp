@@ -20,11 +20,14 @@
 #endif
 
 #include <mavconn/console_bridge_compat.hpp>
+#include <mavconn/io_pool.hpp>
 #include <mavconn/serial.hpp>
 #include <mavconn/thread_utils.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <string>
+#include <vector>
 
 namespace mavconn
 {
@@ -34,17 +37,21 @@ using asio::io_service;
 using mavlink::mavlink_message_t;
 using std::error_code;
 
+using TxQ = PrioTxQueue<MsgBufferPool::BufferPtr>;
+
 #define PFX "mavconn: serial"
 #define PFXd PFX "%zu: "
 
 MAVConnSerial::MAVConnSerial(
   uint8_t system_id, uint8_t component_id,
-  std::string device, unsigned baudrate, bool hwflow)
+  std::string device, unsigned baudrate, bool hwflow, bool low_latency)
 : MAVConnInterface(system_id, component_id),
-  io_service(),
+  own_io_service(IOServicePool::instance().is_running() ? nullptr : new asio::io_service()),
+  io_service(own_io_service ? *own_io_service : IOServicePool::instance().io_service()),
   serial_dev(io_service),
+  tx_timer(io_service),
   tx_in_progress(false),
-  tx_q{},
+  tx_q(MAX_TXQ_SIZE),
   rx_buf{}
 {
   using SPB = asio::serial_port_base;
@@ -93,8 +100,9 @@ MAVConnSerial::MAVConnSerial(
 #endif
 
 #if defined(__linux__)
-    // Enable low latency mode on Linux
-    {
+    // Enable low latency mode on Linux (e.g. FTDI latency timer
+    // 16 ms -> 1 ms); opt-out for drivers that misbehave with it
+    if (low_latency) {
       int fd = serial_dev.native_handle();
 
       struct serial_struct ser_info;
@@ -104,6 +112,8 @@ MAVConnSerial::MAVConnSerial(
 
       ioctl(fd, TIOCSSERIAL, &ser_info);
     }
+#else
+    (void)low_latency;
 #endif
   } catch (asio::system_error & err) {
     throw DeviceError("serial", err);
@@ -114,12 +124,14 @@ MAVConnSerial::MAVConnSerial(
   // give some work to io_service before start
   io_service.post(std::bind(&MAVConnSerial::do_read, this));
 
-  // run io_service for async io
-  io_thread = std::thread(
-    [this]() {
-      utils::set_this_thread_name("mserial%zu", conn_id);
-      io_service.run();
-    });
+  // run io_service for async io (shared pool runs it for us)
+  if (own_io_service) {
+    io_thread = std::thread(
+      [this]() {
+        utils::set_this_thread_name("mserial%zu", conn_id);
+        io_service.run();
+      });
+  }
 }
 
 MAVConnSerial::~MAVConnSerial()
@@ -129,21 +141,35 @@ MAVConnSerial::~MAVConnSerial()
 
 void MAVConnSerial::close()
 {
-  lock_guard lock(mutex);
-  if (!is_open()) {
-    return;
-  }
+  {
+    lock_guard lock(mutex);
+    if (!is_open()) {
+      return;
+    }
 
-  serial_dev.cancel();
-  serial_dev.close();
+    serial_dev.cancel();
+    serial_dev.close();
+    tx_timer.cancel();
 
-  io_service.stop();
+    if (own_io_service) {
+      io_service.stop();
 
-  if (io_thread.joinable()) {
-    io_thread.join();
+      if (io_thread.joinable()) {
+        io_thread.join();
+      }
+
+      io_service.reset();
+    }
   }
 
-  io_service.reset();
+  if (!own_io_service) {
+    // Shared pool: quiesce tasks queued with a bare this before the
+    // object may be destroyed (completion handlers hold shared_ptr).
+    // Must run with the connection mutex released — the pool thread
+    // may be blocked on it inside a send path, and the sentinel has
+    // to get a chance to execute.
+    IOServicePool::instance().flush();
+  }
 
   if (port_closed_cb) {
     port_closed_cb();
@@ -160,11 +186,11 @@ void MAVConnSerial::send_bytes(const uint8_t * bytes, size_t length)
   {
     lock_guard lock(mutex);
 
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    if (tx_q.push(TxQ::Band::status, tx_buf_pool.alloc(bytes, length)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnSerial::send_bytes: TX queue overflow");
     }
-
-    tx_q.emplace_back(bytes, length);
   }
   io_service.post(std::bind(&MAVConnSerial::do_write, shared_from_this(), true));
 }
@@ -183,11 +209,11 @@ void MAVConnSerial::send_message(const mavlink_message_t * message)
   {
     lock_guard lock(mutex);
 
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    if (tx_q.push(TxQ::band_of(message->msgid), tx_buf_pool.alloc(message)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnSerial::send_message: TX queue overflow");
     }
-
-    tx_q.emplace_back(message);
   }
   io_service.post(std::bind(&MAVConnSerial::do_write, shared_from_this(), true));
 }
@@ -203,12 +229,41 @@ void MAVConnSerial::send_message(const mavlink::Message & message, const uint8_t
 
   {
     lock_guard lock(mutex);
-
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    // finalize signs the frame: hold the signing state against
+    // concurrent Rx verification on the io thread
+    auto slock = signing_lock();
+
+    if (tx_q.push(
+        TxQ::band_of(message.get_message_info().id),
+        tx_buf_pool.alloc(message, get_status_p(), sys_id, source_compid)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnSerial::send_message: TX queue overflow");
     }
+  }
+  io_service.post(std::bind(&MAVConnSerial::do_write, shared_from_this(), true));
+}
+
+
+void MAVConnSerial::send_messages(const mavlink_message_t * msgs, size_t count)
+{
+  if (!is_open()) {
+    CONSOLE_BRIDGE_logError(PFXd "send: channel closed!", conn_id);
+    return;
+  }
+
+  {
+    lock_guard lock(mutex);
 
-    tx_q.emplace_back(message, get_status_p(), sys_id, source_compid);
+    for (size_t i = 0; i < count; i++) {
+      log_send(PFX, &msgs[i]);
+
+      if (tx_q.push(TxQ::band_of(msgs[i].msgid), tx_buf_pool.alloc(&msgs[i])) ==
+        TxQ::PushResult::overflow)
+      {
+        throw std::length_error("MAVConnSerial::send_messages: TX queue overflow");
+      }
+    }
   }
   io_service.post(std::bind(&MAVConnSerial::do_write, shared_from_this(), true));
 }
@@ -236,19 +291,56 @@ void MAVConnSerial::do_write(bool check_tx_state)
     return;
   }
 
-  lock_guard lock(mutex);
-  if (tx_q.empty()) {
+  // NOTE: only the io thread consumes tx_q, no lock needed.
+  // A partially written frame latches its band: re-evaluating
+  // priorities mid-frame would interleave another frame's bytes
+  // into it and corrupt the stream.
+  const auto band = tx_partial ? tx_band : tx_q.top_band();
+  auto * bufp = tx_q.front(band);
+  if (bufp == nullptr) {
     return;
   }
+  tx_band = band;
 
   tx_in_progress = true;
   auto sthis = shared_from_this();
-  auto & buf_ref = tx_q.front();
-  serial_dev.async_write_some(
-    buffer(buf_ref.dpos(), buf_ref.nbytes()),
-    [sthis, &buf_ref](error_code error, size_t bytes_transferred) {
-      assert(ssize_t(bytes_transferred) <= buf_ref.len);
 
+  // token-bucket shaping: wait for the bucket to cover the head buffer
+  const size_t budget = tx_tokens_available();
+  const size_t head_nbytes = (*bufp)->nbytes();
+  if (budget < head_nbytes) {
+    tx_timer.expires_from_now(tx_token_wait(head_nbytes));
+    tx_timer.async_wait(
+      [sthis](error_code error) {
+        sthis->tx_in_progress = false;
+        if (!error) {
+          sthis->do_write(true);
+        }
+      });
+    return;
+  }
+
+  // coalesce queued buffers of the band into one gathered write
+  std::vector<asio::const_buffer> iov;
+  size_t nbuf = tx_q.band_size(band);
+  if (nbuf > MAX_TX_COALESCE) {
+    nbuf = MAX_TX_COALESCE;
+  }
+  size_t batched = 0;
+  for (size_t i = 0; i < nbuf && batched < budget; i++) {
+    auto & buf_ref = **tx_q.peek(band, i);
+
+    if (i > 0 && batched + buf_ref.nbytes() > budget) {
+      break;
+    }
+
+    iov.emplace_back(buf_ref.dpos(), buf_ref.nbytes());
+    batched += buf_ref.nbytes();
+  }
+
+  serial_dev.async_write_some(
+    iov,
+    [sthis, band](error_code error, size_t bytes_transferred) {
       if (error) {
         CONSOLE_BRIDGE_logError(PFXd "write: %s", sthis->conn_id, error.message().c_str());
         sthis->close();
@@ -256,17 +348,25 @@ void MAVConnSerial::do_write(bool check_tx_state)
       }
 
       sthis->iostat_tx_add(bytes_transferred);
-      lock_guard lock(sthis->mutex);
-
-      if (sthis->tx_q.empty()) {
-        sthis->tx_in_progress = false;
-        return;
+      sthis->tx_tokens_consume(bytes_transferred);
+
+      // advance through the coalesced buffers
+      size_t remaining = bytes_transferred;
+      while (remaining > 0) {
+        auto & buf_ref = **sthis->tx_q.front(band);
+        const size_t taken = std::min(remaining, size_t(buf_ref.nbytes()));
+
+        buf_ref.pos += taken;
+        remaining -= taken;
+        if (buf_ref.nbytes() == 0) {
+          sthis->stat_tx_complete(buf_ref);
+          sthis->tx_q.pop(band);
+        }
       }
 
-      buf_ref.pos += bytes_transferred;
-      if (buf_ref.nbytes() == 0) {
-        sthis->tx_q.pop_front();
-      }
+      // latch the band until the head frame fully left the wire
+      auto * headp = sthis->tx_q.front(band);
+      sthis->tx_partial = (headp != nullptr) && ((*headp)->pos > 0);
 
       if (!sthis->tx_q.empty()) {
         sthis->do_write(false);
@@ -0,0 +1,294 @@
+//
+// libmavconn
+// Copyright 2021 Vladimir Ermakov, All rights reserved.
+//
+// This file is part of the mavros package and subject to the license terms
+// in the top-level LICENSE file of the mavros repository.
+// https://github.com/mavlink/mavros/tree/master/LICENSE.md
+//
+/**
+ * @brief MAVConn shared memory link class
+ * @file shm.cpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup mavconn
+ * @{
+ */
+
+#if defined(__linux__)
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <mavconn/console_bridge_compat.hpp>
+#include <mavconn/shm.hpp>
+#include <mavconn/thread_utils.hpp>
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+namespace mavconn
+{
+
+using mavlink::mavlink_message_t;
+
+#define PFX "mavconn: shm"
+#define PFXd PFX "%zu: "
+
+static int futex(std::atomic<uint32_t> * uaddr, int op, uint32_t val)
+{
+  return syscall(
+    SYS_futex, reinterpret_cast<uint32_t *>(uaddr), op, val,
+    nullptr, nullptr, 0);
+}
+
+static void futex_wake(std::atomic<uint32_t> * uaddr)
+{
+  futex(uaddr, FUTEX_WAKE, INT32_MAX);
+}
+
+static void futex_wait(std::atomic<uint32_t> * uaddr, uint32_t old_value)
+{
+  futex(uaddr, FUTEX_WAIT, old_value);
+}
+
+MAVConnSHM::MAVConnSHM(
+  uint8_t system_id, uint8_t component_id,
+  std::string name_)
+: MAVConnInterface(system_id, component_id),
+  name(name_),
+  region(nullptr),
+  my_side(-1),
+  segment_creator(false),
+  should_exit(false),
+  rx_buf{}
+{
+  int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd >= 0) {
+    segment_creator = true;
+    if (::ftruncate(fd, sizeof(Region)) != 0) {
+      ::close(fd);
+      ::shm_unlink(name.c_str());
+      throw DeviceError("shm: ftruncate", errno);
+    }
+  } else if (errno == EEXIST) {
+    fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+  }
+  if (fd < 0) {
+    throw DeviceError("shm: open", errno);
+  }
+
+  void * mem = ::mmap(
+    nullptr, sizeof(Region), PROT_READ | PROT_WRITE,
+    MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mem == MAP_FAILED) {
+    if (segment_creator) {
+      ::shm_unlink(name.c_str());
+    }
+    throw DeviceError("shm: mmap", errno);
+  }
+
+  region = static_cast<Region *>(mem);
+
+  if (segment_creator) {
+    // zero-filled by ftruncate; stamp and publish
+    region->magic = REGION_MAGIC;
+    region->init_done.store(1, std::memory_order_release);
+  } else {
+    // wait for the creator to finish initialization
+    for (int retry = 0; region->init_done.load(std::memory_order_acquire) == 0; retry++) {
+      if (retry > 1000) {
+        ::munmap(mem, sizeof(Region));
+        throw DeviceError("shm: init", "segment initialization timed out");
+      }
+      ::usleep(1000);
+    }
+
+    if (region->magic != REGION_MAGIC) {
+      ::munmap(mem, sizeof(Region));
+      throw DeviceError("shm: init", "segment magic mismatch");
+    }
+  }
+
+  for (int side = 0; side < 2; side++) {
+    if (region->side_claimed[side].exchange(1) == 0) {
+      my_side = side;
+      break;
+    }
+  }
+  if (my_side < 0) {
+    ::munmap(mem, sizeof(Region));
+    region = nullptr;
+    throw DeviceError("shm: claim", "both segment sides already in use");
+  }
+
+  CONSOLE_BRIDGE_logInform(
+    PFXd "segment %s, side %d%s", conn_id, name.c_str(), my_side,
+    segment_creator ? " (created)" : "");
+
+  rx_thread = std::thread(
+    [this]() {
+      utils::set_this_thread_name("mshm%zu", conn_id);
+      rx_loop();
+    });
+}
+
+MAVConnSHM::~MAVConnSHM()
+{
+  close();
+}
+
+void MAVConnSHM::close()
+{
+  lock_guard lock(mutex);
+  if (!is_open()) {
+    return;
+  }
+
+  should_exit = true;
+
+  // wake our reader (waits on the peer's tx ring notify word)
+  rx_ring().notify.fetch_add(1, std::memory_order_release);
+  futex_wake(&rx_ring().notify);
+
+  if (rx_thread.joinable()) {
+    rx_thread.join();
+  }
+
+  region->side_claimed[my_side].store(0);
+
+  ::munmap(region, sizeof(Region));
+  region = nullptr;
+
+  if (segment_creator) {
+    ::shm_unlink(name.c_str());
+  }
+
+  if (port_closed_cb) {
+    port_closed_cb();
+  }
+}
+
+MAVConnSHM::Ring & MAVConnSHM::tx_ring()
+{
+  return region->rings[my_side];
+}
+
+MAVConnSHM::Ring & MAVConnSHM::rx_ring()
+{
+  return region->rings[my_side ^ 1];
+}
+
+bool MAVConnSHM::ring_write(Ring & ring, const uint8_t * bytes, size_t length)
+{
+  const uint32_t head = ring.head.load(std::memory_order_relaxed);
+  const uint32_t tail = ring.tail.load(std::memory_order_acquire);
+  const size_t record_len = length + 2;
+
+  if (RING_SIZE - (head - tail) < record_len) {
+    return false;
+  }
+
+  // uint16 length prefix, then payload; indices wrap by mask
+  ring.data[head & (RING_SIZE - 1)] = length & 0xff;
+  ring.data[(head + 1) & (RING_SIZE - 1)] = (length >> 8) & 0xff;
+  for (size_t i = 0; i < length; i++) {
+    ring.data[(head + 2 + i) & (RING_SIZE - 1)] = bytes[i];
+  }
+
+  ring.head.store(head + record_len, std::memory_order_release);
+  ring.notify.fetch_add(1, std::memory_order_release);
+  futex_wake(&ring.notify);
+
+  return true;
+}
+
+void MAVConnSHM::rx_loop()
+{
+  auto & ring = rx_ring();
+
+  while (!should_exit) {
+    const uint32_t seen = ring.notify.load(std::memory_order_acquire);
+    const uint32_t head = ring.head.load(std::memory_order_acquire);
+    uint32_t tail = ring.tail.load(std::memory_order_relaxed);
+
+    if (head == tail) {
+      futex_wait(&ring.notify, seen);
+      continue;
+    }
+
+    while (tail != head) {
+      const size_t length = ring.data[tail & (RING_SIZE - 1)] |
+        (ring.data[(tail + 1) & (RING_SIZE - 1)] << 8);
+
+      if (length > rx_buf.size()) {
+        CONSOLE_BRIDGE_logError(PFXd "corrupt record length %zu", conn_id, length);
+        ring.tail.store(head, std::memory_order_release);
+        break;
+      }
+
+      for (size_t i = 0; i < length; i++) {
+        rx_buf[i] = ring.data[(tail + 2 + i) & (RING_SIZE - 1)];
+      }
+
+      tail += length + 2;
+      ring.tail.store(tail, std::memory_order_release);
+
+      parse_buffer(PFX, rx_buf.data(), rx_buf.size(), length);
+    }
+  }
+}
+
+void MAVConnSHM::send_buffer(const MsgBuffer & buf, const char * what)
+{
+  if (!is_open()) {
+    CONSOLE_BRIDGE_logError(PFXd "send: channel closed!", conn_id);
+    return;
+  }
+
+  lock_guard lock(mutex);
+
+  if (!ring_write(tx_ring(), buf.data, buf.len)) {
+    throw std::length_error(what);
+  }
+
+  iostat_tx_add(buf.len);
+  stat_tx_complete(buf);
+}
+
+void MAVConnSHM::send_bytes(const uint8_t * bytes, size_t length)
+{
+  send_buffer(MsgBuffer(bytes, length), "MAVConnSHM::send_bytes: ring overflow");
+}
+
+void MAVConnSHM::send_message(const mavlink_message_t * message)
+{
+  assert(message != nullptr);
+
+  log_send(PFX, message);
+  send_buffer(MsgBuffer(message), "MAVConnSHM::send_message: ring overflow");
+}
+
+void MAVConnSHM::send_message(const mavlink::Message & message, const uint8_t source_compid)
+{
+  log_send_obj(PFX, message);
+
+  // serialize under the lock: get_status_p() seq counter is shared
+  // (and finalize signs the frame — hold the signing state too)
+  lock_guard lock(mutex);
+  auto slock = signing_lock();
+  send_buffer(
+    MsgBuffer(message, get_status_p(), sys_id, source_compid),
+    "MAVConnSHM::send_message: ring overflow");
+}
+
+}  // namespace mavconn
+
+#endif  // defined(__linux__)
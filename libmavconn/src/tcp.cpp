@@ -16,6 +16,7 @@
  */
 
 #include <mavconn/console_bridge_compat.hpp>
+#include <mavconn/io_pool.hpp>
 #include <mavconn/tcp.hpp>
 #include <mavconn/thread_utils.hpp>
 
@@ -42,6 +43,8 @@ using mavlink::mavlink_message_t;
 using mavlink::mavlink_status_t;
 using utils::to_string_ss;
 
+using TxQ = PrioTxQueue<MsgBufferPool::BufferPtr>;
+
 #define PFX "mavconn: tcp"
 #define PFXd PFX "%zu: "
 
@@ -83,49 +86,53 @@ static bool resolve_address_tcp(
 
 MAVConnTCPClient::MAVConnTCPClient(
   uint8_t system_id, uint8_t component_id,
-  std::string server_host, uint16_t server_port)
+  std::string server_host_, uint16_t server_port_)
 : MAVConnInterface(system_id, component_id),
-  io_service(),
-  io_work(new io_service::work(io_service)),
+  own_io_service(IOServicePool::instance().is_running() ? nullptr : new asio::io_service()),
+  io_service(own_io_service ? *own_io_service : IOServicePool::instance().io_service()),
+  io_work(own_io_service ? new asio::io_service::work(io_service) : nullptr),
+  server_host(server_host_),
+  server_port(server_port_),
+  resolver(io_service),
   socket(io_service),
   is_destroying(false),
+  conn_in_progress(true),
   tx_in_progress(false),
-  tx_q{},
+  tx_q(MAX_TXQ_SIZE),
   rx_buf{}
 {
-  if (!resolve_address_tcp(io_service, conn_id, server_host, server_port, server_ep)) {
-    throw DeviceError("tcp: resolve", "Bind address resolve failed");
-  }
-
-  CONSOLE_BRIDGE_logInform(PFXd "Server address: %s", conn_id, to_string_ss(server_ep).c_str());
-
-  try {
-    socket.open(tcp::v4());
-    socket.connect(server_ep);
-  } catch (asio::system_error & err) {
-    throw DeviceError("tcp", err);
-  }
+  CONSOLE_BRIDGE_logInform(
+    PFXd "Connecting to %s:%u", conn_id, server_host.c_str(), server_port);
 
   // NOTE: shared_from_this() should not be used in constructors
 
-  // give some work to io_service before start
-  io_service.post(std::bind(&MAVConnTCPClient::do_recv, this));
-
-  // run io_service for async io
-  io_thread = std::thread(
-    [this]() {
-      utils::set_this_thread_name("mtcp%zu", conn_id);
-      io_service.run();
-    });
+  // resolve and connect on the io thread: the node starts
+  // immediately even when the server is not up yet
+  io_service.post(std::bind(&MAVConnTCPClient::do_resolve, this));
+
+  // run io_service for async io (shared pool runs it for us)
+  if (own_io_service) {
+    io_thread = std::thread(
+      [this]() {
+        utils::set_this_thread_name("mtcp%zu", conn_id);
+        io_service.run();
+      });
+  }
 }
 
 MAVConnTCPClient::MAVConnTCPClient(
   uint8_t system_id, uint8_t component_id,
   asio::io_service & server_io)
 : MAVConnInterface(system_id, component_id),
+  own_io_service(),
+  io_service(server_io),
+  server_port(0),
+  resolver(server_io),
   socket(server_io),
+  is_destroying(false),
+  conn_in_progress(false),
   tx_in_progress(false),
-  tx_q{},
+  tx_q(MAX_TXQ_SIZE),
   rx_buf{}
 {
   // waiting when server call client_connected()
@@ -141,6 +148,85 @@ void MAVConnTCPClient::client_connected(size_t server_channel)
   GET_IO_SERVICE(socket).post(std::bind(&MAVConnTCPClient::do_recv, shared_from_this()));
 }
 
+void MAVConnTCPClient::do_resolve()
+{
+  auto sthis = shared_from_this();
+
+#if ASIO_VERSION >= 101200
+  resolver.async_resolve(
+    server_host, "",
+    [sthis](error_code ec, tcp::resolver::results_type results) {
+      if (ec || results.empty()) {
+        CONSOLE_BRIDGE_logError(
+          PFXd "resolve: %s", sthis->conn_id,
+          ec ? ec.message().c_str() : "no address found");
+        sthis->close();
+        return;
+      }
+
+      sthis->do_connect(*results.begin());
+    });
+#else
+  tcp::resolver::query query(server_host, "");
+  resolver.async_resolve(
+    query,
+    [sthis](error_code ec, tcp::resolver::iterator it) {
+      if (ec || it == tcp::resolver::iterator()) {
+        CONSOLE_BRIDGE_logError(
+          PFXd "resolve: %s", sthis->conn_id,
+          ec ? ec.message().c_str() : "no address found");
+        sthis->close();
+        return;
+      }
+
+      sthis->do_connect(*it);
+    });
+#endif
+}
+
+void MAVConnTCPClient::do_connect(tcp::endpoint ep)
+{
+  server_ep = ep;
+  server_ep.port(server_port);
+
+  CONSOLE_BRIDGE_logDebug(
+    PFXd "host %s resolved as %s", conn_id,
+    server_host.c_str(), to_string_ss(server_ep).c_str());
+
+  auto sthis = shared_from_this();
+  error_code ec;
+
+  socket.open(tcp::v4(), ec);
+  if (ec) {
+    CONSOLE_BRIDGE_logError(PFXd "open: %s", conn_id, ec.message().c_str());
+    close();
+    return;
+  }
+
+  socket.async_connect(
+    server_ep,
+    [sthis](error_code error) {
+      if (error) {
+        CONSOLE_BRIDGE_logError(PFXd "connect: %s", sthis->conn_id, error.message().c_str());
+        sthis->close();
+        return;
+      }
+
+      CONSOLE_BRIDGE_logInform(
+        PFXd "Server address: %s", sthis->conn_id,
+        to_string_ss(sthis->server_ep).c_str());
+
+      sthis->conn_in_progress = false;
+      if (sthis->port_opened_cb) {
+        sthis->port_opened_cb();
+      }
+
+      sthis->do_recv();
+      // flush messages queued while the link was establishing
+      sthis->do_send(true);
+    });
+}
+
 MAVConnTCPClient::~MAVConnTCPClient()
 {
   is_destroying = true;
@@ -150,22 +236,34 @@ MAVConnTCPClient::~MAVConnTCPClient()
 void MAVConnTCPClient::close()
 {
   lock_guard lock(mutex);
-  if (!is_open()) {
+  if (!is_open() && !conn_in_progress) {
     return;
   }
 
-  socket.shutdown(asio::ip::tcp::socket::shutdown_send);
-  socket.cancel();
-  socket.close();
-
-  io_work.reset();
-  io_service.stop();
+  conn_in_progress = false;
+  resolver.cancel();
 
-  if (io_thread.joinable()) {
-    io_thread.join();
+  if (is_open()) {
+    error_code ec;
+    socket.shutdown(asio::ip::tcp::socket::shutdown_send, ec);
+    socket.cancel();
+    socket.close();
   }
 
-  io_service.reset();
+  if (own_io_service) {
+    io_work.reset();
+    io_service.stop();
+
+    if (io_thread.joinable()) {
+      io_thread.join();
+    }
+
+    io_service.reset();
+  } else {
+    // shared pool: quiesce tasks queued with a bare this before the
+    // object may be destroyed (completion handlers hold shared_ptr)
+    IOServicePool::instance().flush();
+  }
 
   if (port_closed_cb) {
     port_closed_cb();
@@ -182,11 +280,11 @@ void MAVConnTCPClient::send_bytes(const uint8_t * bytes, size_t length)
   {
     lock_guard lock(mutex);
 
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    if (tx_q.push(TxQ::Band::status, tx_buf_pool.alloc(bytes, length)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnTCPClient::send_bytes: TX queue overflow");
     }
-
-    tx_q.emplace_back(bytes, length);
   }
   GET_IO_SERVICE(socket).post(std::bind(&MAVConnTCPClient::do_send, shared_from_this(), true));
 }
@@ -205,11 +303,11 @@ void MAVConnTCPClient::send_message(const mavlink_message_t * message)
   {
     lock_guard lock(mutex);
 
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    if (tx_q.push(TxQ::band_of(message->msgid), tx_buf_pool.alloc(message)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnTCPClient::send_message: TX queue overflow");
     }
-
-    tx_q.emplace_back(message);
   }
   GET_IO_SERVICE(socket).post(std::bind(&MAVConnTCPClient::do_send, shared_from_this(), true));
 }
@@ -225,12 +323,41 @@ void MAVConnTCPClient::send_message(const mavlink::Message & message, const uint
 
   {
     lock_guard lock(mutex);
-
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    // finalize signs the frame: hold the signing state against
+    // concurrent Rx verification on the io thread
+    auto slock = signing_lock();
+
+    if (tx_q.push(
+        TxQ::band_of(message.get_message_info().id),
+        tx_buf_pool.alloc(message, get_status_p(), sys_id, source_compid)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnTCPClient::send_message: TX queue overflow");
     }
+  }
+  GET_IO_SERVICE(socket).post(std::bind(&MAVConnTCPClient::do_send, shared_from_this(), true));
+}
+
 
-    tx_q.emplace_back(message, get_status_p(), sys_id, source_compid);
+void MAVConnTCPClient::send_messages(const mavlink_message_t * msgs, size_t count)
+{
+  if (!is_open()) {
+    CONSOLE_BRIDGE_logError(PFXd "send: channel closed!", conn_id);
+    return;
+  }
+
+  {
+    lock_guard lock(mutex);
+
+    for (size_t i = 0; i < count; i++) {
+      log_send(PFX, &msgs[i]);
+
+      if (tx_q.push(TxQ::band_of(msgs[i].msgid), tx_buf_pool.alloc(&msgs[i])) ==
+        TxQ::PushResult::overflow)
+      {
+        throw std::length_error("MAVConnTCPClient::send_messages: TX queue overflow");
+      }
+    }
   }
   GET_IO_SERVICE(socket).post(std::bind(&MAVConnTCPClient::do_send, shared_from_this(), true));
 }
@@ -261,17 +388,28 @@ void MAVConnTCPClient::do_send(bool check_tx_state)
     return;
   }
 
-  lock_guard lock(mutex);
-  if (tx_q.empty()) {
+  if (conn_in_progress) {
+    // queued messages are flushed by the connect completion
+    return;
+  }
+
+  // NOTE: only the io thread consumes tx_q, no lock needed.
+  // A partially written frame latches its band: re-evaluating
+  // priorities mid-frame would interleave another frame's bytes
+  // into it and corrupt the stream.
+  const auto band = tx_partial ? tx_band : tx_q.top_band();
+  auto * bufp = tx_q.front(band);
+  if (bufp == nullptr) {
     return;
   }
+  tx_band = band;
 
   tx_in_progress = true;
   auto sthis = shared_from_this();
-  auto & buf_ref = tx_q.front();
+  auto & buf_ref = **bufp;
   socket.async_send(
     buffer(buf_ref.dpos(), buf_ref.nbytes()),
-    [sthis, &buf_ref](error_code error, size_t bytes_transferred) {
+    [sthis, &buf_ref, band](error_code error, size_t bytes_transferred) {
       assert(ssize_t(bytes_transferred) <= buf_ref.len);
 
       if (error) {
@@ -281,16 +419,15 @@ void MAVConnTCPClient::do_send(bool check_tx_state)
       }
 
       sthis->iostat_tx_add(bytes_transferred);
-      lock_guard lock(sthis->mutex);
-
-      if (sthis->tx_q.empty()) {
-        sthis->tx_in_progress = false;
-        return;
-      }
 
       buf_ref.pos += bytes_transferred;
       if (buf_ref.nbytes() == 0) {
-        sthis->tx_q.pop_front();
+        sthis->stat_tx_complete(buf_ref);
+        sthis->tx_q.pop(band);
+        sthis->tx_partial = false;
+      } else {
+        // latch the band until this frame fully left the wire
+        sthis->tx_partial = true;
       }
 
       if (!sthis->tx_q.empty()) {
@@ -307,7 +444,8 @@ MAVConnTCPServer::MAVConnTCPServer(
   uint8_t system_id, uint8_t component_id,
   std::string server_host, uint16_t server_port)
 : MAVConnInterface(system_id, component_id),
-  io_service(),
+  own_io_service(IOServicePool::instance().is_running() ? nullptr : new asio::io_service()),
+  io_service(own_io_service ? *own_io_service : IOServicePool::instance().io_service()),
   acceptor(io_service),
   is_destroying(false)
 {
@@ -329,12 +467,14 @@ MAVConnTCPServer::MAVConnTCPServer(
   // give some work to io_service before start
   io_service.post(std::bind(&MAVConnTCPServer::do_accept, this));
 
-  // run io_service for async io
-  io_thread = std::thread(
-    [this]() {
-      utils::set_this_thread_name("mtcps%zu", conn_id);
-      io_service.run();
-    });
+  // run io_service for async io (shared pool runs it for us)
+  if (own_io_service) {
+    io_thread = std::thread(
+      [this]() {
+        utils::set_this_thread_name("mtcps%zu", conn_id);
+        io_service.run();
+      });
+  }
 }
 
 MAVConnTCPServer::~MAVConnTCPServer()
@@ -345,21 +485,44 @@ MAVConnTCPServer::~MAVConnTCPServer()
 
 void MAVConnTCPServer::close()
 {
-  lock_guard lock(mutex);
-  if (!is_open()) {
-    return;
-  }
+  std::list<std::shared_ptr<MAVConnTCPClient>> local_list;
 
-  CONSOLE_BRIDGE_logInform(
-    PFXd "Terminating server. "
-    "All connections will be closed.",
-    conn_id);
+  {
+    lock_guard lock(mutex);
+    if (!is_open()) {
+      return;
+    }
 
-  io_service.stop();
-  acceptor.close();
+    CONSOLE_BRIDGE_logInform(
+      PFXd "Terminating server. "
+      "All connections will be closed.",
+      conn_id);
 
-  if (io_thread.joinable()) {
-    io_thread.join();
+    if (own_io_service) {
+      io_service.stop();
+    }
+    acceptor.close();
+
+    if (own_io_service && io_thread.joinable()) {
+      io_thread.join();
+    }
+
+    if (!own_io_service) {
+      local_list = client_list;
+    }
+  }
+
+  // With a shared pool the io thread keeps running: terminate client
+  // connections explicitly and quiesce our own bare-this accept
+  // task. Both must run with the server mutex released — the pool
+  // thread may be blocked on it inside a fan-out send, and the
+  // clients' own close/flush would deadlock behind it otherwise.
+  if (!own_io_service) {
+    for (auto & instp : local_list) {
+      instp->close();
+    }
+
+    IOServicePool::instance().flush();
   }
 
   if (port_closed_cb) {
@@ -425,17 +588,36 @@ void MAVConnTCPServer::send_bytes(const uint8_t * bytes, size_t length)
 
 void MAVConnTCPServer::send_message(const mavlink_message_t * message)
 {
+  assert(message != nullptr);
+
+  log_send(PFX, message);
+
+  // serialize once, hand the same bytes to every client; each Tx
+  // queue entry still carries its own write position, so the bytes
+  // land in the per-client pooled buffer via one memcpy
+  MsgBuffer buf(message);
+
   lock_guard lock(mutex);
   for (auto & instp : client_list) {
-    instp->send_message(message);
+    instp->send_bytes(buf.data, buf.len);
   }
 }
 
 void MAVConnTCPServer::send_message(const mavlink::Message & message, const uint8_t source_compid)
 {
+  log_send_obj(PFX, message);
+
+  // one serialization with a single server-side sequence counter
+  // instead of N per-client finalizations; finalize signs the frame,
+  // so hold the signing state against Rx verification meanwhile
+  MsgBuffer buf = [this, &message, source_compid]() {
+      auto slock = signing_lock();
+      return MsgBuffer(message, get_status_p(), sys_id, source_compid);
+    } ();
+
   lock_guard lock(mutex);
   for (auto & instp : client_list) {
-    instp->send_message(message, source_compid);
+    instp->send_bytes(buf.data, buf.len);
   }
 }
 
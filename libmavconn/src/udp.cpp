@@ -15,11 +15,22 @@
  * @{
  */
 
+#if defined(__linux__)
+#include <linux/sockios.h>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#endif
+
 #include <mavconn/console_bridge_compat.hpp>
+#include <mavconn/io_pool.hpp>
 #include <mavconn/thread_utils.hpp>
 #include <mavconn/udp.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <string>
 
 namespace mavconn
@@ -33,6 +44,8 @@ using utils::to_string_ss;
 using utils::operator"" _KiB;
 using mavlink::mavlink_message_t;
 
+using TxQ = PrioTxQueue<MsgBufferPool::BufferPtr>;
+
 #define PFX "mavconn: udp"
 #define PFXd PFX "%zu: "
 
@@ -73,16 +86,21 @@ static bool resolve_address_udp(
 MAVConnUDP::MAVConnUDP(
   uint8_t system_id, uint8_t component_id,
   std::string bind_host, uint16_t bind_port,
-  std::string remote_host, uint16_t remote_port)
+  std::string remote_host, uint16_t remote_port,
+  size_t rx_batch)
 : MAVConnInterface(system_id, component_id),
-  io_service(),
-  io_work(new io_service::work(io_service)),
+  own_io_service(IOServicePool::instance().is_running() ? nullptr : new asio::io_service()),
+  io_service(own_io_service ? *own_io_service : IOServicePool::instance().io_service()),
+  io_work(own_io_service ? new asio::io_service::work(io_service) : nullptr),
   permanent_broadcast(false),
   remote_exists(false),
   socket(io_service),
   tx_in_progress(false),
-  tx_q{},
-  rx_buf{}
+  tx_q(MAX_TXQ_SIZE),
+  rx_buf{},
+  rx_batch_size((rx_batch > MAX_RX_BATCH) ? MAX_RX_BATCH : rx_batch),
+  rx_batch_buf((rx_batch_size > 1) ? rx_batch_size : 0),
+  rx_dedup_enabled(false)
 {
   using udps = asio::ip::udp::socket;
 
@@ -115,13 +133,36 @@ MAVConnUDP::MAVConnUDP(
     socket.set_option(udps::send_buffer_size(256_KiB));
     socket.set_option(udps::receive_buffer_size(512_KiB));
 
+#if defined(__linux__)
+    // kernel rx timestamps for timesync (see get_last_rx_stamp_ns)
+    {
+      int on = 1;
+      ::setsockopt(socket.native_handle(), SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+    }
+#endif
+
     socket.bind(bind_ep);
 
     if (remote_host == BROADCAST_REMOTE_HOST) {
       socket.set_option(udps::broadcast(true));
+      rx_dedup_enabled = true;
     } else if (remote_host == PERMANENT_BROADCAST_REMOTE_HOST) {
       socket.set_option(udps::broadcast(true));
       permanent_broadcast = true;
+      rx_dedup_enabled = true;
+    } else if (remote_exists && remote_ep.address().is_multicast()) {
+      // multicast fan-out: serialize once, let the network replicate.
+      // Keep the configured group as destination (no remote learning)
+      // and dedup Rx, several receivers may echo the same packet.
+      socket.set_option(
+        asio::ip::multicast::join_group(
+          remote_ep.address().to_v4(), bind_ep.address().to_v4()));
+      permanent_broadcast = true;
+      rx_dedup_enabled = true;
+
+      CONSOLE_BRIDGE_logInform(
+        PFXd "Joined multicast group %s", conn_id,
+        to_string_ss(remote_ep).c_str());
     }
   } catch (asio::system_error & err) {
     throw DeviceError("udp", err);
@@ -132,12 +173,14 @@ MAVConnUDP::MAVConnUDP(
   // give some work to io_service before start
   io_service.post(std::bind(&MAVConnUDP::do_recvfrom, this));
 
-  // run io_service for async io
-  io_thread = std::thread(
-    [this]() {
-      utils::set_this_thread_name("mudp%zu", conn_id);
-      io_service.run();
-    });
+  // run io_service for async io (shared pool runs it for us)
+  if (own_io_service) {
+    io_thread = std::thread(
+      [this]() {
+        utils::set_this_thread_name("mudp%zu", conn_id);
+        io_service.run();
+      });
+  }
 }
 
 MAVConnUDP::~MAVConnUDP()
@@ -147,22 +190,35 @@ MAVConnUDP::~MAVConnUDP()
 
 void MAVConnUDP::close()
 {
-  lock_guard lock(mutex);
-  if (!is_open()) {
-    return;
-  }
+  {
+    lock_guard lock(mutex);
+    if (!is_open()) {
+      return;
+    }
 
-  socket.cancel();
-  socket.close();
+    socket.cancel();
+    socket.close();
 
-  io_work.reset();
-  io_service.stop();
+    if (own_io_service) {
+      io_work.reset();
+      io_service.stop();
 
-  if (io_thread.joinable()) {
-    io_thread.join();
+      if (io_thread.joinable()) {
+        io_thread.join();
+      }
+
+      io_service.reset();
+    }
   }
 
-  io_service.reset();
+  if (!own_io_service) {
+    // Shared pool: quiesce tasks queued with a bare this before the
+    // object may be destroyed (completion handlers hold shared_ptr).
+    // Must run with the connection mutex released — the pool thread
+    // may be blocked on it inside a send path, and the sentinel has
+    // to get a chance to execute.
+    IOServicePool::instance().flush();
+  }
 
   if (port_closed_cb) {
     port_closed_cb();
@@ -184,11 +240,11 @@ void MAVConnUDP::send_bytes(const uint8_t * bytes, size_t length)
   {
     lock_guard lock(mutex);
 
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    if (tx_q.push(TxQ::Band::status, tx_buf_pool.alloc(bytes, length)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnUDP::send_bytes: TX queue overflow");
     }
-
-    tx_q.emplace_back(bytes, length);
   }
   io_service.post(std::bind(&MAVConnUDP::do_sendto, shared_from_this(), true));
 }
@@ -212,11 +268,11 @@ void MAVConnUDP::send_message(const mavlink_message_t * message)
   {
     lock_guard lock(mutex);
 
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    if (tx_q.push(TxQ::band_of(message->msgid), tx_buf_pool.alloc(message)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnUDP::send_message: TX queue overflow");
     }
-
-    tx_q.emplace_back(message);
   }
   io_service.post(std::bind(&MAVConnUDP::do_sendto, shared_from_this(), true));
 }
@@ -237,19 +293,130 @@ void MAVConnUDP::send_message(const mavlink::Message & message, const uint8_t so
 
   {
     lock_guard lock(mutex);
-
-    if (tx_q.size() >= MAX_TXQ_SIZE) {
+    // finalize signs the frame: hold the signing state against
+    // concurrent Rx verification on the io thread
+    auto slock = signing_lock();
+
+    if (tx_q.push(
+        TxQ::band_of(message.get_message_info().id),
+        tx_buf_pool.alloc(message, get_status_p(), sys_id, source_compid)) ==
+      TxQ::PushResult::overflow)
+    {
       throw std::length_error("MAVConnUDP::send_message: TX queue overflow");
     }
+  }
+  io_service.post(std::bind(&MAVConnUDP::do_sendto, shared_from_this(), true));
+}
 
-    tx_q.emplace_back(message, get_status_p(), sys_id, source_compid);
+
+void MAVConnUDP::send_messages(const mavlink_message_t * msgs, size_t count)
+{
+  if (!is_open()) {
+    CONSOLE_BRIDGE_logError(PFXd "send: channel closed!", conn_id);
+    return;
+  }
+
+  if (!remote_exists) {
+    CONSOLE_BRIDGE_logDebug(PFXd "send: Remote not known, message dropped.", conn_id);
+    return;
+  }
+
+  {
+    lock_guard lock(mutex);
+
+    for (size_t i = 0; i < count; i++) {
+      log_send(PFX, &msgs[i]);
+
+      if (tx_q.push(TxQ::band_of(msgs[i].msgid), tx_buf_pool.alloc(&msgs[i])) ==
+        TxQ::PushResult::overflow)
+      {
+        throw std::length_error("MAVConnUDP::send_messages: TX queue overflow");
+      }
+    }
   }
   io_service.post(std::bind(&MAVConnUDP::do_sendto, shared_from_this(), true));
 }
 
+#if defined(__linux__)
+void MAVConnUDP::do_recvmmsg()
+{
+  mmsghdr mhdr[MAX_RX_BATCH] = {};
+  iovec iov[MAX_RX_BATCH];
+  sockaddr_storage from[MAX_RX_BATCH];
+  uint8_t cmsgbuf[MAX_RX_BATCH][CMSG_SPACE(sizeof(timespec))];
+
+  const auto cnt = std::min(rx_batch_size, rx_batch_buf.size());
+  for (size_t i = 0; i < cnt; i++) {
+    iov[i].iov_base = rx_batch_buf[i].data();
+    iov[i].iov_len = rx_batch_buf[i].size();
+    mhdr[i].msg_hdr.msg_name = &from[i];
+    mhdr[i].msg_hdr.msg_namelen = sizeof(from[i]);
+    mhdr[i].msg_hdr.msg_iov = &iov[i];
+    mhdr[i].msg_hdr.msg_iovlen = 1;
+    mhdr[i].msg_hdr.msg_control = cmsgbuf[i];
+    mhdr[i].msg_hdr.msg_controllen = sizeof(cmsgbuf[i]);
+  }
+
+  auto rc = ::recvmmsg(socket.native_handle(), mhdr, cnt, MSG_DONTWAIT, nullptr);
+  if (rc <= 0) {
+    // spurious wakeup: the async_wait will be re-armed by the caller
+    return;
+  }
+
+  for (int i = 0; i < rc; i++) {
+    if (!permanent_broadcast && from[i].ss_family == AF_INET) {
+      auto sin = reinterpret_cast<const sockaddr_in *>(&from[i]);
+      udp::endpoint ep(
+        asio::ip::address_v4(ntohl(sin->sin_addr.s_addr)),
+        ntohs(sin->sin_port));
+
+      if (ep != last_remote_ep) {
+        CONSOLE_BRIDGE_logInform(
+          PFXd "Remote address: %s", conn_id, to_string_ss(ep).c_str());
+        remote_exists = true;
+        last_remote_ep = ep;
+        remote_ep = ep;
+      }
+    }
+
+    last_rx_stamp_ns = 0;
+    for (cmsghdr * cmsg = CMSG_FIRSTHDR(&mhdr[i].msg_hdr); cmsg != nullptr;
+      cmsg = CMSG_NXTHDR(&mhdr[i].msg_hdr, cmsg))
+    {
+      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS) {
+        timespec ts;
+        std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+        last_rx_stamp_ns = uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+      }
+    }
+
+    parse_buffer(PFX, rx_batch_buf[i].data(), rx_batch_buf[i].size(), mhdr[i].msg_len);
+  }
+}
+#endif
+
 void MAVConnUDP::do_recvfrom()
 {
   auto sthis = shared_from_this();
+
+#if defined(__linux__) && ASIO_VERSION >= 101100
+  if (rx_batch_size > 1) {
+    socket.async_wait(
+      udp::socket::wait_read,
+      [sthis](error_code error) {
+        if (error) {
+          CONSOLE_BRIDGE_logError(PFXd "receive: %s", sthis->conn_id, error.message().c_str());
+          sthis->close();
+          return;
+        }
+
+        sthis->do_recvmmsg();
+        sthis->do_recvfrom();
+      });
+    return;
+  }
+#endif
+
   socket.async_receive_from(
     buffer(rx_buf),
     permanent_broadcast ? recv_ep : remote_ep,
@@ -268,29 +435,101 @@ void MAVConnUDP::do_recvfrom()
         sthis->last_remote_ep = sthis->remote_ep;
       }
 
+#if defined(__linux__)
+      {
+        // kernel stamp of the just-delivered datagram
+        timespec ts;
+        if (::ioctl(sthis->socket.native_handle(), SIOCGSTAMPNS, &ts) == 0) {
+          sthis->last_rx_stamp_ns = uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+        } else {
+          sthis->last_rx_stamp_ns = 0;
+        }
+      }
+#endif
+
       sthis->parse_buffer(PFX, sthis->rx_buf.data(), sthis->rx_buf.size(), bytes_transferred);
       sthis->do_recvfrom();
     });
 }
 
+#if defined(__linux__)
+bool MAVConnUDP::try_sendmmsg(TxQ::Band band)
+{
+  // NOTE: called from the io thread (tx_q consumer)
+  mmsghdr mhdr[MAX_TX_BATCH] = {};
+  iovec iov[MAX_TX_BATCH];
+
+  size_t cnt = tx_q.band_size(band);
+  if (cnt > MAX_TX_BATCH) {
+    cnt = MAX_TX_BATCH;
+  }
+  for (size_t i = 0; i < cnt; i++) {
+    auto & buf = **tx_q.peek(band, i);
+
+    iov[i].iov_base = buf.dpos();
+    iov[i].iov_len = buf.nbytes();
+    mhdr[i].msg_hdr.msg_name = remote_ep.data();
+    mhdr[i].msg_hdr.msg_namelen = remote_ep.size();
+    mhdr[i].msg_hdr.msg_iov = &iov[i];
+    mhdr[i].msg_hdr.msg_iovlen = 1;
+  }
+
+  auto rc = ::sendmmsg(socket.native_handle(), mhdr, cnt, MSG_DONTWAIT);
+  if (rc <= 0) {
+    // EAGAIN or transient error: leave the queue to the async path
+    return false;
+  }
+
+  for (int i = 0; i < rc; i++) {
+    iostat_tx_add(mhdr[i].msg_len);
+    stat_tx_complete(**tx_q.front(band));
+    tx_q.pop(band);
+  }
+
+  return tx_q.empty();
+}
+#endif
+
 void MAVConnUDP::do_sendto(bool check_tx_state)
 {
   if (check_tx_state && tx_in_progress) {
     return;
   }
 
-  lock_guard lock(mutex);
-  if (tx_q.empty()) {
+  // NOTE: only the io thread consumes tx_q, no lock needed
+  auto band = tx_q.top_band();
+  auto * bufp = tx_q.front(band);
+  if (bufp == nullptr) {
     return;
   }
 
   tx_in_progress = true;
+
+#if defined(__linux__)
+  // Datagrams are atomic: drain bursts with one syscall instead of
+  // one async_send_to per buffer. Anything not accepted by the kernel
+  // falls through to the async path below.
+  if (tx_q.band_size(band) > 1) {
+    if (try_sendmmsg(band)) {
+      tx_in_progress = false;
+      return;
+    }
+
+    band = tx_q.top_band();
+    bufp = tx_q.front(band);
+    if (bufp == nullptr) {
+      tx_in_progress = false;
+      return;
+    }
+  }
+#endif
+
   auto sthis = shared_from_this();
-  auto & buf_ref = tx_q.front();
+  auto & buf_ref = **bufp;
   socket.async_send_to(
     buffer(buf_ref.dpos(), buf_ref.nbytes()),
     remote_ep,
-    [sthis, &buf_ref](error_code error, size_t bytes_transferred) {
+    [sthis, &buf_ref, band](error_code error, size_t bytes_transferred) {
       assert(ssize_t(bytes_transferred) <= buf_ref.len);
 
       if (error == asio::error::network_unreachable) {
@@ -305,16 +544,11 @@ void MAVConnUDP::do_sendto(bool check_tx_state)
       }
 
       sthis->iostat_tx_add(bytes_transferred);
-      lock_guard lock(sthis->mutex);
-
-      if (sthis->tx_q.empty()) {
-        sthis->tx_in_progress = false;
-        return;
-      }
 
       buf_ref.pos += bytes_transferred;
       if (buf_ref.nbytes() == 0) {
-        sthis->tx_q.pop_front();
+        sthis->stat_tx_complete(buf_ref);
+        sthis->tx_q.pop(band);
       }
 
       if (!sthis->tx_q.empty()) {
@@ -325,6 +559,29 @@ void MAVConnUDP::do_sendto(bool check_tx_state)
     });
 }
 
+bool MAVConnUDP::accept_message(const mavlink::mavlink_message_t & msg)
+{
+  if (!rx_dedup_enabled) {
+    return true;
+  }
+
+  const uint16_t key = (msg.sysid << 8) | msg.compid;
+  const auto now = steady_clock::now();
+
+  auto it = rx_dedup.find(key);
+  if (it != rx_dedup.end() && it->second.seq == msg.seq &&
+    (now - it->second.stamp) < std::chrono::milliseconds(RX_DEDUP_WINDOW_MS))
+  {
+    CONSOLE_BRIDGE_logDebug(
+      PFXd "dropped duplicate Message-Id: %u IDs: %u.%u Seq: %u",
+      conn_id, msg.msgid, msg.sysid, msg.compid, msg.seq);
+    return false;
+  }
+
+  rx_dedup[key] = DedupEntry{msg.seq, now};
+  return true;
+}
+
 std::string MAVConnUDP::get_remote_endpoint() const
 {
   return to_string_ss(remote_ep);
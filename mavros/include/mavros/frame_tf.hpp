@@ -168,6 +168,28 @@ Eigen::Vector3d transform_static_frame(
   const Eigen::Vector3d & map_origin,
   const StaticEcefTF transform);
 
+/**
+ * @brief Rotate @p count vectors in place (batch static transform).
+ */
+void transform_static_frame(
+  Eigen::Vector3d * vecs, const size_t count, const StaticTF transform);
+
+/**
+ * @brief Rotate @p count vectors in place by @p q (batch transform).
+ */
+void transform_frame(
+  Eigen::Vector3d * vecs, const size_t count, const Eigen::Quaterniond & q);
+
+/**
+ * @brief Precomposed NED+aircraft -> ENU+baselink attitude transform.
+ *
+ * Equivalent to transform_orientation(AIRCRAFT_TO_BASELINK) after
+ * transform_orientation(NED_TO_ENU), folded into one 4x4 coefficient
+ * multiply. Both component transforms are involutions, so the same
+ * function serves the reverse chain.
+ */
+Eigen::Quaterniond transform_orientation_ned_aircraft_enu_baselink(const Eigen::Quaterniond & q);
+
 }       // namespace detail
 
 // -*- frame tf -*-
@@ -212,6 +234,26 @@ inline T transform_orientation_baselink_aircraft(const T & in)
   return detail::transform_orientation(in, StaticTF::BASELINK_TO_AIRCRAFT);
 }
 
+/**
+ * @brief Transform from attitude represented WRT NED+aircraft to
+ *		  attitude represented WRT ENU+base_link frames (one multiply)
+ */
+inline Eigen::Quaterniond transform_orientation_ned_aircraft_enu_baselink(
+  const Eigen::Quaterniond & in)
+{
+  return detail::transform_orientation_ned_aircraft_enu_baselink(in);
+}
+
+/**
+ * @brief Transform from attitude represented WRT ENU+base_link to
+ *		  attitude represented WRT NED+aircraft frames (one multiply)
+ */
+inline Eigen::Quaterniond transform_orientation_enu_baselink_ned_aircraft(
+  const Eigen::Quaterniond & in)
+{
+  return detail::transform_orientation_ned_aircraft_enu_baselink(in);
+}
+
 /**
  * @brief Transform from attitude represented WRT aircraft frame to
  *		  attitude represented WRT base_link frame, treating aircraft frame
@@ -253,6 +295,41 @@ inline T transform_frame_enu_ned(const T & in)
   return detail::transform_static_frame(in, StaticTF::ENU_TO_NED);
 }
 
+/**
+ * @brief Transform @p count vectors in place from NED to ENU
+ *
+ * Batch variant: rotates the whole array with one vectorized
+ * product, for obstacle grids and trajectories.
+ */
+inline void transform_frame_ned_enu(Eigen::Vector3d * vecs, const size_t count)
+{
+  detail::transform_static_frame(vecs, count, StaticTF::NED_TO_ENU);
+}
+
+//! @brief Transform @p count vectors in place from ENU to NED
+inline void transform_frame_enu_ned(Eigen::Vector3d * vecs, const size_t count)
+{
+  detail::transform_static_frame(vecs, count, StaticTF::ENU_TO_NED);
+}
+
+//! @brief Transform @p count vectors in place from aircraft to base_link
+inline void transform_frame_aircraft_baselink(Eigen::Vector3d * vecs, const size_t count)
+{
+  detail::transform_static_frame(vecs, count, StaticTF::AIRCRAFT_TO_BASELINK);
+}
+
+//! @brief Transform @p count vectors in place from base_link to aircraft
+inline void transform_frame_baselink_aircraft(Eigen::Vector3d * vecs, const size_t count)
+{
+  detail::transform_static_frame(vecs, count, StaticTF::BASELINK_TO_AIRCRAFT);
+}
+
+//! @brief Rotate @p count vectors in place by quaternion @p q
+inline void transform_frame(Eigen::Vector3d * vecs, const size_t count, const Eigen::Quaterniond & q)
+{
+  detail::transform_frame(vecs, count, q);
+}
+
 /**
  * @brief Transform data expressed in Aircraft frame to Baselink frame.
  *
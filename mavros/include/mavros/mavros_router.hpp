@@ -21,7 +21,10 @@
 #define MAVROS__MAVROS_ROUTER_HPP_
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <thread>
 #include <set>
 #include <string>
 #include <shared_mutex>     // NOLINT
@@ -32,12 +35,16 @@
 
 #include "mavconn/interface.hpp"
 #include "mavconn/mavlink_dialect.hpp"
+#include "mavconn/msgbuffer.hpp"
+#include "mavconn/ringbuffer.hpp"
 #include "mavros/utils.hpp"
 #include "rclcpp/macros.hpp"
 #include "rclcpp/rclcpp.hpp"
 #include "diagnostic_updater/diagnostic_updater.hpp"
 
 #include "mavros_msgs/msg/mavlink.hpp"
+#include "mavros_msgs/msg/mavlink_batch.hpp"
+#include "mavros_msgs/msg/mavlink_fixed.hpp"
 #include "mavros_msgs/srv/endpoint_add.hpp"
 #include "mavros_msgs/srv/endpoint_del.hpp"
 
@@ -83,13 +90,12 @@ public:
     id(0),
     link_type(Type::fcu),
     url{},
-    remote_addrs{},
-    stale_addrs{}
+    remote_addrs{}
   {
     const addr_t broadcast_addr = 0;
 
-    // Accept broadcasts by default
-    remote_addrs.emplace(broadcast_addr);
+    // Accept broadcasts by default (never expires)
+    remote_addrs.emplace(broadcast_addr, 0);
   }
 
   std::shared_ptr<Router> parent;
@@ -97,8 +103,44 @@ public:
   uint32_t id;                         // id of the endpoint
   Type link_type;                      // class of the endpoint
   std::string url;                     // url to open that endpoint
-  std::set<addr_t> remote_addrs;       // remotes that we heard there
-  std::set<addr_t> stale_addrs;        // temporary storage for stale remote addrs
+
+  //! generations without traffic before a remote addr expires
+  //! (the generation advances once per sweep period)
+  static constexpr uint64_t ADDR_STALE_GENERATIONS = 2;
+
+  //! remotes that we heard there: addr -> generation last stamped.
+  //! Stale entries are lazily dropped during addr index rebuild,
+  //! no periodic writer-lock sweep needed.
+  std::unordered_map<addr_t, uint64_t> remote_addrs;
+  //! guards remote_addrs (endpoint rx thread vs index rebuild)
+  std::mutex addr_mu;
+
+  //! One slot of the staged routing pipeline Rx ring.
+  struct RxItem
+  {
+    mavlink_message_t msg;
+    Framing framing;
+    //! kernel receive stamp [ns], 0 if unknown
+    uint64_t rx_stamp_ns;
+    //! original framed bytes (0: not available, re-encode)
+    uint16_t frame_len;
+    uint8_t frame[mavconn::MsgBuffer::MAX_SIZE];
+  };
+
+  //! Rx ring depth per endpoint (staged pipeline mode)
+  static constexpr size_t RX_RING_SIZE = 256;
+
+  //! per-source ring feeding the router worker pool
+  mavconn::RingBuffer<RxItem> rx_ring{RX_RING_SIZE};
+  //! exclusive-consumer claim for rx_ring
+  std::atomic<bool> rx_claimed{false};
+
+  //! kernel receive stamp of the message being routed, 0 if unknown
+  std::atomic<uint64_t> rx_stamp_ns{0};
+
+  // reconnect backoff state, owned by the router reconnect worker
+  std::chrono::steady_clock::time_point next_reconnect {};
+  std::chrono::seconds reconnect_backoff {1};
 
   virtual bool is_open() = 0;
   virtual std::pair<bool, std::string> open() = 0;
@@ -107,8 +149,29 @@ public:
   virtual void send_message(
     const mavlink_message_t * msg, const Framing framing = Framing::ok,
     id_t src_id = 0) = 0;
+
+  /**
+   * Forward the original framed bytes verbatim (CRC and signature
+   * untouched), avoiding the decode/re-encode round trip.
+   * Default falls back to send_message().
+   */
+  virtual void send_frame(
+    const uint8_t * frame, const size_t frame_len,
+    const mavlink_message_t * msg, const Framing framing, id_t src_id)
+  {
+    (void)frame;
+    (void)frame_len;
+    send_message(msg, framing, src_id);
+  }
+
   virtual void recv_message(const mavlink_message_t * msg, const Framing framing = Framing::ok);
 
+  //! recv_message() variant keeping the original framed bytes for
+  //! pass-through routing (frame may be nullptr).
+  void recv_message(
+    const mavlink_message_t * msg, const Framing framing,
+    const uint8_t * frame, const size_t frame_len);
+
   virtual std::string diag_name();
   virtual void diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat) = 0;
 };
@@ -146,7 +209,10 @@ public:
     const std::string & node_name = "mavros_router")
   : rclcpp::Node(node_name,
       options /* rclcpp::NodeOptions(options).use_intra_process_comms(true) */),
-    endpoints{}, stat_msg_routed(0), stat_msg_sent(0), stat_msg_dropped(0),
+    endpoints{}, addr_index(std::make_shared<AddrIndex>()), addr_index_dirty(true),
+    addr_generation(1),
+    workers_running(false), rx_pending(0),
+    stat_msg_routed(0), stat_msg_sent(0), stat_msg_dropped(0),
     diagnostic_updater(this, 1.0)
   {
     RCLCPP_DEBUG(this->get_logger(), "Start mavros::router::Router initialization...");
@@ -156,6 +222,19 @@ public:
     this->declare_parameter<StrV>("fcu_urls", StrV());
     this->declare_parameter<StrV>("gcs_urls", StrV());
     this->declare_parameter<StrV>("uas_urls", StrV());
+    this->declare_parameter<int>("num_worker_threads", 0);
+    // ROSEndpoint Tx batching: flush after uas_batch_size messages
+    // or uas_batch_window_us microseconds (0 disables batching)
+    this->declare_parameter<int>("uas_batch_size", 0);
+    this->declare_parameter<int>("uas_batch_window_us", 2000);
+    // publish the fixed-capacity (POD-sized, loanable) link message
+    // INSTEAD of the regular one: mavlink_source_fixed replaces
+    // mavlink_source, which stays silent while this is enabled
+    // (both at once would route every message twice in the UAS);
+    // see mavros_msgs/MavlinkFixed
+    this->declare_parameter<bool>("uas_zero_copy", false);
+    // drop the second copy of a message arriving over redundant links
+    this->declare_parameter<bool>("enable_source_dedup", false);
 
     add_service = this->create_service<mavros_msgs::srv::EndpointAdd>(
       "~/add_endpoint",
@@ -164,13 +243,26 @@ public:
       "~/del_endpoint",
       std::bind(&Router::del_endpoint, this, _1, _2));
 
-    // try to reconnect endpoint each 30 seconds
-    reconnect_timer =
-      this->create_wall_timer(30s, std::bind(&Router::periodic_reconnect_endpoints, this));
-
-    // collect garbage addrs each minute
-    stale_addrs_timer =
-      this->create_wall_timer(60s, std::bind(&Router::periodic_clear_stale_remote_addrs, this));
+    // reconnection runs on its own worker with per-endpoint backoff:
+    // a dead serial device stalls only that worker, never routing
+    reconnect_thread = std::thread(std::bind(&Router::reconnect_loop, this));
+
+    // advance remote addr generation each minute; stale addrs
+    // expire lazily at the next index rebuild
+    addr_gen_timer =
+      this->create_wall_timer(60s, std::bind(&Router::periodic_advance_addr_generation, this));
+
+    // drop summary: one line per 10 s at most, off the hot path
+    drop_summary_timer = this->create_wall_timer(
+      10s, [this]() {
+        const size_t dropped = stat_msg_dropped.load(std::memory_order_relaxed);
+        if (dropped != drop_summary_last) {
+          RCLCPP_WARN(
+            get_logger(), "Dropped %zu messages in the last period (%zu total)",
+            dropped - drop_summary_last, dropped);
+          drop_summary_last = dropped;
+        }
+      });
 
     diagnostic_updater.setHardwareID("none");  // NOTE: router connects several hardwares
     diagnostic_updater.add("MAVROS Router", this, &Router::diag_run);
@@ -183,14 +275,38 @@ public:
     RCLCPP_INFO(get_logger(), "Built-in SIMD instructions: %s", Eigen::SimdInstructionSetsInUse());
     RCLCPP_INFO(get_logger(), "Built-in MAVLink package version: %s", mavlink::version);
     RCLCPP_INFO(get_logger(), "Known MAVLink dialects:%s", ss.str().c_str());
+    source_dedup_enabled = this->get_parameter("enable_source_dedup").as_bool();
+    if (source_dedup_enabled) {
+      // one slot per (sysid, compid)
+      source_seq_table = std::vector<std::atomic<uint64_t>>(65536);
+    }
+
+    auto num_workers = this->get_parameter("num_worker_threads").as_int();
+    if (num_workers > 0) {
+      start_workers(num_workers);
+    }
+
     RCLCPP_INFO(get_logger(), "MAVROS Router started");
   }
 
-  void route_message(Endpoint::SharedPtr src, const mavlink_message_t * msg, const Framing framing);
+  ~Router() override
+  {
+    reconnect_exit = true;
+    if (reconnect_thread.joinable()) {
+      reconnect_thread.join();
+    }
+
+    stop_workers();
+  }
+
+  void route_message(
+    Endpoint::SharedPtr src, const mavlink_message_t * msg, const Framing framing,
+    const uint8_t * frame = nullptr, const size_t frame_len = 0);
 
 private:
   friend class Endpoint;
   friend class TestRouter;
+  friend class RouterFixture;
 
   static std::atomic<id_t> id_counter;
 
@@ -199,14 +315,68 @@ private:
   // map stores all routing endpoints
   std::unordered_map<id_t, Endpoint::SharedPtr> endpoints;
 
+  using AddrIndex = std::unordered_map<addr_t, std::vector<Endpoint::SharedPtr>>;
+
+  //! target addr -> destination endpoints; copy-on-write snapshot,
+  //! lazily rebuilt when addr_index_dirty is set (new remote addr
+  //! learned or topology changed)
+  std::shared_ptr<const AddrIndex> addr_index;
+  std::atomic<bool> addr_index_dirty;
+
+  // Redundant-link dedup: per (sysid, compid) slot packs the ms
+  // stamp and last sequence number into one relaxed atomic; a copy
+  // of a recently seen sequence within the reorder window is
+  // dropped, a big jump or staleness resets the slot so failover
+  // stays seamless.
+  bool source_dedup_enabled = false;
+  static constexpr int64_t DEDUP_STALE_MS = 500;
+  static constexpr int8_t DEDUP_SEQ_WINDOW = 64;
+  std::vector<std::atomic<uint64_t>> source_seq_table;
+
+  bool is_duplicate(const mavlink_message_t * msg)
+  {
+    const size_t key = (size_t(msg->sysid) << 8) | msg->compid;
+    const uint64_t now_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    auto & slot = source_seq_table[key];
+    const uint64_t prev = slot.load(std::memory_order_relaxed);
+    const uint8_t prev_seq = prev & 0xff;
+    const uint64_t prev_ms = prev >> 8;
+    const int8_t diff = int8_t(msg->seq - prev_seq);
+
+    if (prev != 0 && diff <= 0 && diff > -DEDUP_SEQ_WINDOW &&
+      (now_ms - prev_ms) < uint64_t(DEDUP_STALE_MS))
+    {
+      return true;
+    }
+
+    slot.store((now_ms << 8) | msg->seq, std::memory_order_relaxed);
+    return false;
+  }
+
   std::atomic<size_t> stat_msg_routed;      //!< amount of messages came to route_messages()
   std::atomic<size_t> stat_msg_sent;        //!< amount of messages sent
   std::atomic<size_t> stat_msg_dropped;     //!< amount of messages dropped
 
+  //! per-msgid drop accounting (v1 id range; diag shows the top ones)
+  std::array<std::atomic<uint32_t>, 256> drop_by_msgid {};
+  std::atomic<uint32_t> drop_other {0};
+  std::array<size_t, 3> top_dropped_ids {};
+  size_t drop_summary_last = 0;
+
+  //! one-line periodic drop summary, replaces per-drop log throttling
+  rclcpp::TimerBase::SharedPtr drop_summary_timer;
+
   rclcpp::Service<mavros_msgs::srv::EndpointAdd>::SharedPtr add_service;
   rclcpp::Service<mavros_msgs::srv::EndpointDel>::SharedPtr del_service;
-  rclcpp::TimerBase::SharedPtr reconnect_timer;
-  rclcpp::TimerBase::SharedPtr stale_addrs_timer;
+  std::thread reconnect_thread;
+  std::atomic<bool> reconnect_exit {false};
+  rclcpp::TimerBase::SharedPtr addr_gen_timer;
+
+  //! current remote addr generation (see Endpoint::remote_addrs)
+  std::atomic<uint64_t> addr_generation;
   rclcpp::Node::OnSetParametersCallbackHandle::SharedPtr set_parameters_handle_ptr;
   diagnostic_updater::Updater diagnostic_updater;
 
@@ -217,8 +387,35 @@ private:
     const mavros_msgs::srv::EndpointDel::Request::SharedPtr request,
     mavros_msgs::srv::EndpointDel::Response::SharedPtr response);
 
-  void periodic_reconnect_endpoints();
-  void periodic_clear_stale_remote_addrs();
+  // staged routing pipeline (enabled via num_worker_threads parameter):
+  // endpoint rx threads enqueue into per-source rings, workers route
+  std::vector<std::thread> worker_threads;
+  std::mutex worker_mu;
+  std::condition_variable worker_cv;
+  std::atomic<bool> workers_running;
+  std::atomic<size_t> rx_pending;
+
+  //! kernel rx stamp of the message the calling thread routes now
+  static thread_local uint64_t current_rx_stamp_ns;
+
+  /**
+   * Hand @p msg to the worker pool.
+   * @return false when the pipeline is disabled (route inline then).
+   */
+  bool enqueue_for_routing(
+    Endpoint::SharedPtr src, const mavlink_message_t * msg,
+    const Framing framing,
+    const uint8_t * frame = nullptr, const size_t frame_len = 0);
+
+  void start_workers(size_t count);
+  void stop_workers();
+  void worker_loop();
+
+  void reconnect_loop();
+  void periodic_advance_addr_generation();
+
+  //! NOTE: requires at least shared lock on mu
+  void rebuild_addr_index();
 
   rcl_interfaces::msg::SetParametersResult on_set_parameters_cb(
     const std::vector<rclcpp::Parameter> & parameters);
@@ -259,6 +456,10 @@ public:
     const mavlink_message_t * msg, const Framing framing = Framing::ok,
     id_t src_id = 0) override;
 
+  void send_frame(
+    const uint8_t * frame, const size_t frame_len,
+    const mavlink_message_t * msg, const Framing framing, id_t src_id) override;
+
   void diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat) override;
 };
 
@@ -284,6 +485,12 @@ public:
 
   rclcpp::Subscription<mavros_msgs::msg::Mavlink>::SharedPtr sink;       // UAS -> FCU
   rclcpp::Publisher<mavros_msgs::msg::Mavlink>::SharedPtr source;        // FCU -> UAS
+  //! FCU -> UAS aggregated (uas_batch_size > 0)
+  rclcpp::Publisher<mavros_msgs::msg::MavlinkBatch>::SharedPtr batch_source;
+  //! FCU -> UAS fixed-capacity zero-copy variant; replaces source
+  //! while uas_zero_copy is enabled
+  rclcpp::Publisher<mavros_msgs::msg::MavlinkFixed>::SharedPtr fixed_source;
+  rclcpp::TimerBase::SharedPtr batch_timer;
 
   bool is_open() override;
   std::pair<bool, std::string> open() override;
@@ -296,7 +503,15 @@ public:
   void diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat) override;
 
 private:
+  size_t batch_max_size = 0;
+  std::mutex batch_mu;
+  mavros_msgs::msg::MavlinkBatch batch;
+
   void ros_recv_message(const mavros_msgs::msg::Mavlink::SharedPtr rmsg);
+
+  void flush_batch();
+  //! NOTE: requires batch_mu held
+  void flush_batch_locked();
 };
 
 }   // namespace router
@@ -29,6 +29,7 @@
 #include <atomic>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -40,9 +41,14 @@
 #include "GeographicLib/Geoid.hpp"
 #include "sensor_msgs/msg/imu.hpp"
 #include "sensor_msgs/msg/nav_sat_fix.hpp"
+#include "mavros_msgs/msg/mavlink_batch.hpp"
+#include "mavros_msgs/msg/mavlink_fixed.hpp"
+#include "mavros_msgs/srv/get_latency_stats.hpp"
+#include "std_srvs/srv/trigger.hpp"
 
 #include "mavros/utils.hpp"
 #include "mavros/plugin.hpp"
+#include "mavros/transaction.hpp"
 #include "mavros/frame_tf.hpp"
 
 namespace mavros
@@ -148,10 +154,18 @@ public:
   /**
    * @brief Geoid dataset used to convert between AMSL and WGS-84
    *
-   * That class loads egm96_5 dataset to RAM, it is about 24 MiB.
+   * Opened lazily on first use in on-demand file mode: the ~24 MiB
+   * dataset is paged through the kernel page cache and shared across
+   * processes. Guard direct evaluations with geoid_mutex.
    */
   static std::shared_ptr<GeographicLib::Geoid> egm96_5;
 
+  //! serializes egm96_5 evaluations (on-demand mode is not threadsafe)
+  static std::mutex geoid_mutex;
+
+  //! Open the geoid dataset once, on first conversion.
+  static void lazy_init_geoid();
+
   /**
    * @brief Conversion from height above geoid (AMSL)
    * to height above ellipsoid (WGS-84)
@@ -159,7 +173,9 @@ public:
   template<class T, std::enable_if_t<std::is_pointer<T>::value, bool> = true>
   inline double geoid_to_ellipsoid_height(const T lla)
   {
+    lazy_init_geoid();
     if (egm96_5) {
+      std::lock_guard<std::mutex> lock(geoid_mutex);
       return GeographicLib::Geoid::GEOIDTOELLIPSOID * (*egm96_5)(lla->latitude, lla->longitude);
     } else {
       return 0.0;
@@ -179,7 +195,9 @@ public:
   template<class T, std::enable_if_t<std::is_pointer<T>::value, bool> = true>
   inline double ellipsoid_to_geoid_height(const T lla)
   {
+    lazy_init_geoid();
     if (egm96_5) {
+      std::lock_guard<std::mutex> lock(geoid_mutex);
       return GeographicLib::Geoid::ELLIPSOIDTOGEOID * (*egm96_5)(lla->latitude, lla->longitude);
     } else {
       return 0.0;
@@ -193,16 +211,22 @@ public:
   }
 
 private:
-  std::shared_timed_mutex mu;
-
-  sensor_msgs::msg::Imu imu_enu_data;
-  sensor_msgs::msg::Imu imu_ned_data;
-
-  sensor_msgs::msg::NavSatFix gps_fix;
-  float gps_eph;
-  float gps_epv;
-  int gps_fix_type;
-  int gps_satellites_visible;
+  //! GPS RAW state published as one snapshot
+  struct GpsState
+  {
+    sensor_msgs::msg::NavSatFix fix;
+    float eph;
+    float epv;
+    int fix_type;
+    int satellites_visible;
+  };
+
+  // State is kept as immutable copy-on-write snapshots, swapped with
+  // the shared_ptr atomic ops: readers take a reference without ever
+  // blocking the rx-thread writers (and vice versa).
+  std::shared_ptr<const sensor_msgs::msg::Imu> imu_enu_data;
+  std::shared_ptr<const sensor_msgs::msg::Imu> imu_ned_data;
+  std::shared_ptr<const GpsState> gps_data;
 
   //! init_geographiclib() once flag
   static std::once_flag init_flag;
@@ -372,15 +396,78 @@ public:
    * @param child_id    child frame for transform
    * @param tr          transform
    */
+  /**
+   * @brief Batched dynamic transform publishing.
+   *
+   * Transforms sent within the same aggregation window (5 ms) leave
+   * as one tf message instead of one DDS sample each, and each child
+   * frame is rate-capped by the tf_rate_limit parameter (0: off).
+   * Preferred over using tf2_broadcaster directly on per-message
+   * paths.
+   */
+  void send_transform(const geometry_msgs::msg::TransformStamped & transform);
+
   void publish_static_transform(
     const std::string & frame_id, const std::string & child_id,
     const Eigen::Affine3d & tr);
 
   /* -*- time sync -*- */
 
+  //! Clock offset estimate with first-order drift model
+  struct TimeOffsetState
+  {
+    int64_t offset_ns;       //!< offset at ref_local_ns
+    double skew;             //!< drift rate [ns/ns]
+    uint64_t ref_local_ns;   //!< local time of the estimate, 0: no extrapolation
+  };
+
   inline void set_time_offset(uint64_t offset_ns)
   {
     time_offset = offset_ns;
+    std::atomic_store(
+      &time_offset_state,
+      std::shared_ptr<const TimeOffsetState>(
+        std::make_shared<TimeOffsetState>(
+          TimeOffsetState{static_cast<int64_t>(offset_ns), 0.0, 0})));
+  }
+
+  /**
+   * @brief Set offset + skew estimate (drift compensated).
+   *
+   * Stamps synthesized between sync exchanges then follow the
+   * estimated drift instead of aging with the FCU oscillator,
+   * which allows a much lower TIMESYNC rate.
+   */
+  void set_time_offset_skew(int64_t offset_ns, double skew, uint64_t ref_local_ns);
+
+  //! Current offset, extrapolated along the skew estimate
+  uint64_t compute_time_offset_ns();
+
+  /**
+   * @brief Shared protocol transaction engine.
+   *
+   * One timer wheel serves the timeout/retry bookkeeping of all
+   * request/ack protocols (param, mission, ftp) instead of a wall
+   * timer per plugin.
+   */
+  inline plugin::TransactionEngine & transactions()
+  {
+    if (!transaction_engine) {
+      transaction_engine = std::make_shared<plugin::TransactionEngine>(this);
+    }
+    return *transaction_engine;
+  }
+
+  /**
+   * @brief Receive stamp of the message currently being dispatched.
+   *
+   * Carries the source link's kernel rx timestamp through the router
+   * (falls back to the router publish time). Only valid inside
+   * plugin handlers; 0 before the first message.
+   */
+  inline uint64_t get_last_message_stamp_ns()
+  {
+    return last_message_stamp_ns;
   }
 
   inline uint64_t get_time_offset(void)
@@ -567,6 +654,22 @@ private:
   rclcpp::Node::OnSetParametersCallbackHandle::SharedPtr set_parameters_handle_ptr;
   rclcpp::TimerBase::SharedPtr startup_delay_timer;
 
+  // transform aggregator (see send_transform())
+  std::mutex tf_agg_mutex;
+  std::vector<geometry_msgs::msg::TransformStamped> tf_agg_buf;
+  std::unordered_map<std::string, rclcpp::Time> tf_last_sent;
+  double tf_rate_limit = 0.0;
+  rclcpp::TimerBase::SharedPtr tf_agg_timer;
+
+  plugin::TransactionEngine::SharedPtr transaction_engine;
+
+  //! compiled allow/deny lists (see is_plugin_allowed())
+  utils::AllowDenyMatcher plugin_matcher;
+
+  //! plugins deferred by plugin_lazy_load, instantiated incrementally
+  std::vector<std::string> deferred_plugin_names;
+  rclcpp::TimerBase::SharedPtr lazy_load_timer;
+
   // XXX(vooon): we have to use own executor because Node::create_sub_node() doesn't work for us.
   using thread_ptr = std::unique_ptr<std::thread, std::function<void (std::thread *)>>;
   thread_ptr exec_spin_thd;
@@ -577,8 +680,33 @@ private:
   std::vector<plugin::Plugin::SharedPtr> loaded_plugins;
 
   //! UAS link -> router -> plugin handler
+  //! master subscription table, mutated only by add_plugin()
   std::unordered_map<mavlink::msgid_t, plugin::Plugin::Subscriptions> plugin_subscriptions;
 
+  /**
+   * Immutable dispatch snapshot, swapped with the shared_ptr atomic
+   * ops (same pattern as the router addr index): with lazy plugin
+   * loading, add_plugin() runs on a timer while plugin_route() reads
+   * on other executor threads, so the index must never be mutated
+   * under a concurrent reader. Each snapshot owns its subscription
+   * copy (v1/ext point into it) and shares the per-msgid latency
+   * histograms with its predecessor so statistics persist.
+   */
+  struct PluginDispatch
+  {
+    std::unordered_map<mavlink::msgid_t, plugin::Plugin::Subscriptions> subscriptions;
+    std::array<const plugin::Plugin::Subscriptions *, 256> v1 {};
+    std::vector<std::pair<mavlink::msgid_t,
+      const plugin::Plugin::Subscriptions *>> ext;
+    std::unordered_map<mavlink::msgid_t,
+      std::shared_ptr<mavconn::LatencyHistogram>> latency;
+  };
+
+  std::shared_ptr<const PluginDispatch> plugin_dispatch;
+
+  rclcpp::Service<mavros_msgs::srv::GetLatencyStats>::SharedPtr get_latency_stats_srv;
+  rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr dump_memory_stats_srv;
+
   std::shared_timed_mutex mu;
 
   // essential data
@@ -592,12 +720,24 @@ private:
   std::vector<ConnectionCb> connection_cb_vec;
   std::vector<CapabilitiesCb> capabilities_cb_vec;
 
+  // connection event debounce (see update_connection_status())
+  static constexpr int64_t CONNECTION_DEBOUNCE_MS = 200;
+  std::atomic<bool> conn_event_pending {false};
+  bool conn_event_delivered = false;
+  rclcpp::TimerBase::SharedPtr conn_event_timer;
+
   std::atomic<uint64_t> time_offset;
+  std::atomic<uint64_t> last_message_stamp_ns{0};
+  std::shared_ptr<const TimeOffsetState> time_offset_state;
   timesync_mode tsync_mode;
 
   // UAS -> Router connection
   mavlink::mavlink_status_t mavlink_status;
   rclcpp::Subscription<mavros_msgs::msg::Mavlink>::SharedPtr source;    // FCU -> UAS
+  //! FCU -> UAS aggregated (see router uas_batch_size)
+  rclcpp::Subscription<mavros_msgs::msg::MavlinkBatch>::SharedPtr batch_source;
+  //! FCU -> UAS fixed-capacity variant (see router uas_zero_copy)
+  rclcpp::Subscription<mavros_msgs::msg::MavlinkFixed>::SharedPtr fixed_source;
   rclcpp::Publisher<mavros_msgs::msg::Mavlink>::SharedPtr sink;         // UAS -> FCU
 
   //! initialize connection to the Router
@@ -605,6 +745,8 @@ private:
 
   //! uas message receive handler
   void recv_message(const mavros_msgs::msg::Mavlink::SharedPtr rmsg);
+  void recv_batch(const mavros_msgs::msg::MavlinkBatch::SharedPtr bmsg);
+  void recv_fixed(const mavros_msgs::msg::MavlinkFixed::SharedPtr rmsg);
 
   //! message router
   void plugin_route(const mavlink::mavlink_message_t * mmsg, const mavconn::Framing framing);
@@ -617,6 +759,7 @@ private:
 
   //! load plugin
   void add_plugin(const std::string & pl_name);
+  void rebuild_plugin_dispatch();
 
   rcl_interfaces::msg::SetParametersResult on_set_parameters_cb(
     const std::vector<rclcpp::Parameter> & parameters);
@@ -624,6 +767,16 @@ private:
   void log_connect_change(bool connected);
 
   void diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat);
+  void diag_run_latency(diagnostic_updater::DiagnosticStatusWrapper & stat);
+  void diag_run_memory(diagnostic_updater::DiagnosticStatusWrapper & stat);
+
+  void dump_memory_stats_cb(
+    const std_srvs::srv::Trigger::Request::SharedPtr req,
+    std_srvs::srv::Trigger::Response::SharedPtr res);
+
+  void get_latency_stats_cb(
+    const mavros_msgs::srv::GetLatencyStats::Request::SharedPtr req,
+    mavros_msgs::srv::GetLatencyStats::Response::SharedPtr res);
 };
 }              // namespace uas
 }       // namespace mavros
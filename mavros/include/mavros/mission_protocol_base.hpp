@@ -26,7 +26,9 @@
 #include <iomanip>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <condition_variable>
+#include <deque>
 
 #include "rcpputils/asserts.hpp"
 #include "mavros/mavros_uas.hpp"
@@ -288,6 +290,8 @@ public:
     is_timedout(false),
     reschedule_pull(false),
     do_pull_after_gcs(false),
+    cache_valid(false),
+    enable_mission_cache(false),
     enable_partial_push(false),
     use_mission_item_int(false),
     mission_item_int_support_confirmed(false),
@@ -296,8 +300,14 @@ public:
     WP_TIMEOUT(1s),
     RESCHEDULE_TIME(5s)
   {
-    timeout_timer = node->create_wall_timer(WP_TIMEOUT, std::bind(&MissionBase::timeout_cb, this));
-    timeout_timer->cancel();
+    // timeout bookkeeping runs on the shared transaction engine
+    timeout_txn = uas->transactions().create(
+      WP_TIMEOUT, std::bind(&MissionBase::timeout_cb, this));
+
+    // mission cache (default off): a re-pull is only answered from
+    // cache when MISSION_CHECKSUM proves the content unchanged
+    node->declare_parameter("enable_mission_cache", false);
+    node->get_parameter("enable_mission_cache", enable_mission_cache);
   }
 
   Subscriptions get_subscriptions() override
@@ -317,6 +327,12 @@ public:
       ret.push_back(make_handler(&MissionBase::handle_mission_item_reached));
     }
 
+    if (enable_mission_cache) {
+      // raw handler: MISSION_CHECKSUM is not in every dialect header
+      ret.push_back(
+        make_handler(MISSION_CHECKSUM_ID, &MissionBase::handle_mission_checksum_raw));
+    }
+
     return ret;
   }
 
@@ -328,6 +344,36 @@ protected:
   std::vector<MissionItem> waypoints;
   std::vector<MissionItem> send_waypoints;
 
+  // Opt-in mission cache (enable_mission_cache parameter, default
+  // off): a complete pull or accepted push marks the stored list
+  // valid, and a later rescheduled pull skips the item transfer only
+  // when the FCU's MISSION_CHECKSUM proves the content unchanged
+  // since the cache was filled. A bare count match is NOT proof —
+  // an edited mission of equal length must still be re-downloaded —
+  // so FCUs that never emit MISSION_CHECKSUM always take the full
+  // pull.
+  bool cache_valid;
+  bool enable_mission_cache;
+
+  //! MISSION_CHECKSUM msgid (decoded raw, see get_subscriptions())
+  static constexpr mavlink::msgid_t MISSION_CHECKSUM_ID = 53;
+
+  bool fcu_checksum_valid = false;
+  uint32_t fcu_mission_checksum = 0;
+  bool cache_checksum_valid = false;
+  uint32_t cache_checksum = 0;
+
+  //! snapshot the FCU checksum the cached list corresponds to
+  void snapshot_cache_checksum()
+  {
+    cache_checksum = fcu_mission_checksum;
+    cache_checksum_valid = fcu_checksum_valid;
+  }
+
+  //! bumped on every change of @p waypoints content or current flag;
+  //! lets subclasses cache converted/serialized representations
+  uint64_t mission_generation = 0;
+
   const MTYPE mission_type;
   const char * log_prefix;
 
@@ -360,7 +406,7 @@ protected:
   std::condition_variable list_receiving;
   std::condition_variable list_sending;
 
-  rclcpp::TimerBase::SharedPtr timeout_timer;
+  uint64_t timeout_txn;   //!< transaction slot for timeout resend
   rclcpp::TimerBase::SharedPtr schedule_timer;
 
   bool reschedule_pull;
@@ -480,6 +526,14 @@ protected:
    * @param msg     Received Mavlink msg
    * @param mcur    MISSION_CURRENT from msg
    */
+  /**
+   * @brief handle MISSION_CHECKSUM mavlink msg (decoded raw)
+   *
+   * Tracked so the mission cache can prove content unchanged.
+   */
+  void handle_mission_checksum_raw(
+    const mavlink::mavlink_message_t * msg, const mavconn::Framing framing);
+
   virtual void handle_mission_current(
     const mavlink::mavlink_message_t * msg,
     mavlink::common::msg::MISSION_CURRENT & mcur,
@@ -518,6 +572,13 @@ protected:
       return;
     }
 
+    if (!try_acquire_link()) {
+      // another mission type is on the wire: queue behind it
+      RCLCPP_DEBUG(get_logger(), "%s: link busy, reschedule pull", log_prefix);
+      schedule_pull(RESCHEDULE_TIME);
+      return;
+    }
+
     RCLCPP_DEBUG(get_logger(), "%s: start scheduled pull", log_prefix);
     wp_state = WP::RXLIST;
     wp_count = 0;
@@ -525,12 +586,73 @@ protected:
     mission_request_list();
   }
 
+  /* -*- shared link transfer scheduler -*- */
+
+  // One mission transaction may be on the wire at a time; the
+  // shared slot is handed out FIFO across the mission-type plugins
+  // (waypoint, geofence, rallypoint), so a queued geofence push
+  // starts the moment a waypoint download finishes instead of
+  // colliding with it or waiting behind a reschedule backoff.
+  static std::mutex link_mutex;
+  static std::condition_variable link_cv;
+  static std::deque<const MissionBase *> link_queue;
+  static const MissionBase * link_owner;
+
+  //! Take the transfer slot if free and nobody queued before us.
+  bool try_acquire_link()
+  {
+    std::lock_guard<std::mutex> lock(link_mutex);
+
+    if (link_owner == nullptr && link_queue.empty()) {
+      link_owner = this;
+      return true;
+    }
+
+    return false;
+  }
+
+  //! Queue for the transfer slot (FIFO fair); false on timeout.
+  bool acquire_link(const std::chrono::nanoseconds timeout)
+  {
+    std::unique_lock<std::mutex> lock(link_mutex);
+
+    link_queue.push_back(this);
+    bool ok = link_cv.wait_for(
+      lock, timeout,
+      [this]() {
+        return link_owner == nullptr && link_queue.front() == this;
+      });
+
+    if (ok) {
+      link_queue.pop_front();
+      link_owner = this;
+    } else {
+      link_queue.erase(
+        std::find(link_queue.begin(), link_queue.end(), this));
+    }
+
+    return ok;
+  }
+
+  void release_link()
+  {
+    std::lock_guard<std::mutex> lock(link_mutex);
+
+    if (link_owner == this) {
+      link_owner = nullptr;
+      link_cv.notify_all();
+    }
+  }
+
   //! @brief Send ACK back to FCU after pull
   void request_mission_done(void)
   {
     /* possibly not needed if count == 0 (QGC impl) */
     mission_ack(MRES::ACCEPTED);
 
+    cache_valid = true;
+    snapshot_cache_checksum();
+    mission_generation++;
     go_idle();
     list_receiving.notify_all();
     RCLCPP_INFO(get_logger(), "%s: mission received", log_prefix);
@@ -540,7 +662,8 @@ protected:
   {
     reschedule_pull = false;
     wp_state = WP::IDLE;
-    timeout_timer->cancel();
+    uas->transactions().cancel(timeout_txn);
+    release_link();
   }
 
   void restart_timeout_timer(void)
@@ -552,7 +675,7 @@ protected:
   void restart_timeout_timer_int(void)
   {
     is_timedout = false;
-    timeout_timer->reset();
+    uas->transactions().arm(timeout_txn);
   }
 
   void schedule_pull(const std::chrono::nanoseconds & dt)
@@ -617,6 +740,8 @@ protected:
     for (auto & it : waypoints) {
       it.is_current = !!(i++ == seq);
     }
+
+    mission_generation++;
   }
 
   //! @brief publish the updated waypoint list after operation
@@ -56,6 +56,167 @@ class Filter
     const mavconn::Framing framing) = 0;
 };
 
+/**
+ * @brief Fixed-capacity callable for message handlers.
+ *
+ * std::function heap-allocates the make_handler() closures (a
+ * shared_ptr plus member pointer never fits the small-buffer
+ * optimization), scattering the hundred-plus handlers of a loaded
+ * UAS across the heap. This stores the closure inline, so the
+ * per-msgid subscription vectors hold the code pointers and captures
+ * contiguously and dispatch stays in cache.
+ */
+template<size_t Capacity, typename Signature>
+class InplaceFunction;
+
+template<size_t Capacity, typename R, typename ... Args>
+class InplaceFunction<Capacity, R(Args...)>
+{
+public:
+  InplaceFunction()
+  : invoke_fn(nullptr), manage_fn(nullptr)
+  {}
+
+  template<typename F, typename = std::enable_if_t<
+      !std::is_same<std::decay_t<F>, InplaceFunction>::value>>
+  InplaceFunction(F && fn)              // NOLINT(runtime/explicit)
+  {
+    using Fn = std::decay_t<F>;
+    static_assert(sizeof(Fn) <= Capacity, "closure exceeds inplace capacity");
+
+    new (&storage) Fn(std::forward<F>(fn));
+    invoke_fn = [](const void * s, Args... args) -> R {
+        return (*static_cast<const Fn *>(static_cast<const void *>(s)))(args ...);
+      };
+    manage_fn = [](void * dst, void * src, const Op op) {
+        switch (op) {
+          case Op::copy:
+            new (dst) Fn(*static_cast<const Fn *>(src));
+            break;
+          case Op::move:
+            new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+            break;
+          case Op::destroy:
+            static_cast<Fn *>(src)->~Fn();
+            break;
+        }
+      };
+  }
+
+  InplaceFunction(const InplaceFunction & other)
+  : invoke_fn(other.invoke_fn), manage_fn(other.manage_fn)
+  {
+    if (manage_fn) {
+      manage_fn(&storage, const_cast<void *>(static_cast<const void *>(&other.storage)), Op::copy);
+    }
+  }
+
+  InplaceFunction(InplaceFunction && other)
+  : invoke_fn(other.invoke_fn), manage_fn(other.manage_fn)
+  {
+    if (manage_fn) {
+      manage_fn(&storage, &other.storage, Op::move);
+    }
+  }
+
+  InplaceFunction & operator=(const InplaceFunction & other)
+  {
+    if (this != &other) {
+      this->~InplaceFunction();
+      new (this) InplaceFunction(other);
+    }
+    return *this;
+  }
+
+  InplaceFunction & operator=(InplaceFunction && other)
+  {
+    if (this != &other) {
+      this->~InplaceFunction();
+      new (this) InplaceFunction(std::move(other));
+    }
+    return *this;
+  }
+
+  ~InplaceFunction()
+  {
+    if (manage_fn) {
+      manage_fn(nullptr, &storage, Op::destroy);
+    }
+  }
+
+  R operator()(Args... args) const
+  {
+    return invoke_fn(&storage, args ...);
+  }
+
+  explicit operator bool() const
+  {
+    return invoke_fn != nullptr;
+  }
+
+private:
+  enum class Op : uint8_t { copy, move, destroy };
+
+  using InvokeFn = R (*)(const void *, Args...);
+  using ManageFn = void (*)(void *, void *, const Op);
+
+  typename std::aligned_storage<Capacity>::type storage;
+  InvokeFn invoke_fn;
+  ManageFn manage_fn;
+};
+
+/**
+ * @brief Rate-capped publisher (see Plugin::create_throttled_publisher()).
+ *
+ * publish() decimates against the configured output rate; 0 (the
+ * default) is uncapped. The rate comes from an auto-declared
+ * "<topic>.rate" parameter, so operators can cap any wrapped topic
+ * at runtime without touching plugin code.
+ */
+template<typename MessageT>
+class ThrottledPublisher
+{
+public:
+  using SharedPtr = std::shared_ptr<ThrottledPublisher<MessageT>>;
+
+  ThrottledPublisher(
+    typename rclcpp::Publisher<MessageT>::SharedPtr pub_,
+    rclcpp::Clock::SharedPtr clock_)
+  : pub(pub_), clock(clock_), period_ns(0), last_ns(0)
+  {}
+
+  void set_rate(const double rate_hz)
+  {
+    period_ns = (rate_hz > 0.0) ? static_cast<int64_t>(1e9 / rate_hz) : 0;
+  }
+
+  void publish(const MessageT & msg)
+  {
+    const int64_t period = period_ns.load(std::memory_order_relaxed);
+
+    if (period > 0) {
+      const int64_t now = clock->now().nanoseconds();
+      if (now - last_ns < period) {
+        return;
+      }
+      last_ns = now;
+    }
+
+    pub->publish(msg);
+  }
+
+  typename rclcpp::Publisher<MessageT>::SharedPtr get_publisher() const
+  {
+    return pub;
+  }
+
+private:
+  typename rclcpp::Publisher<MessageT>::SharedPtr pub;
+  rclcpp::Clock::SharedPtr clock;
+  std::atomic<int64_t> period_ns;
+  int64_t last_ns;
+};
+
 /**
  * @brief MAVROS Plugin base class
  */
@@ -67,8 +228,9 @@ private:
 public:
   RCLCPP_SMART_PTR_DEFINITIONS(Plugin);
 
-  //! generic message handler callback
-  using HandlerCb = mavconn::MAVConnInterface::ReceivedCb;
+  //! generic message handler callback, stored inline (see InplaceFunction)
+  using HandlerCb = InplaceFunction<96,
+      void (const mavlink::mavlink_message_t *, const mavconn::Framing)>;
   //! Tuple: MSG ID, MSG NAME, message type into hash_code, message handler callback
   using HandlerInfo = std::tuple<mavlink::msgid_t, const char *, size_t, HandlerCb>;
   //! Subscriptions vector
@@ -161,8 +323,9 @@ protected:
     return HandlerInfo {
       id, name, type_hash_,
       [bfn, uas_](const mavlink::mavlink_message_t * msg, const mavconn::Framing framing) {
-        auto filter = _F();
-        if (!filter(uas_, msg, framing)) {
+        // static predicate: inlines into the dispatch with no filter
+        // object or virtual call per message
+        if (!_F::check(uas_, msg, framing)) {
           return;
         }
 
@@ -170,7 +333,7 @@ protected:
         _T obj;
         obj.deserialize(map);
 
-        bfn(msg, obj, filter);
+        bfn(msg, obj, _F());
       }
     };
   }
@@ -251,6 +414,36 @@ protected:
     return node->declare_parameter(name, default_value, parameter_descriptor, ignore_override);
   }
 
+  /**
+   * Create a publisher with an operator-tunable output rate cap.
+   *
+   * Declares and watches the "<topic>.rate" parameter (0 default:
+   * uncapped), so any wrapped topic can be throttled at runtime to
+   * cut companion CPU and radio-bridged DDS traffic.
+   */
+  template<typename MessageT, typename ... Args>
+  typename ThrottledPublisher<MessageT>::SharedPtr create_throttled_publisher(
+    const std::string & topic, Args && ... args)
+  {
+    auto tpub = std::make_shared<ThrottledPublisher<MessageT>>(
+      node->create_publisher<MessageT>(topic, std::forward<Args>(args)...),
+      node->get_clock());
+
+    std::string pname = topic;
+    if (pname.compare(0, 2, "~/") == 0) {
+      pname = pname.substr(2);
+    }
+    pname += ".rate";
+
+    enable_node_watch_parameters();
+    node_declate_and_watch_parameter(
+      pname, 0.0, [tpub](const rclcpp::Parameter & p) {
+        tpub->set_rate(p.as_double());
+      });
+
+    return tpub;
+  }
+
   //! Helper to convert ros time to mavlink time_usec field
   inline uint64_t get_time_usec(const builtin_interfaces::msg::Time & t)
   {
@@ -276,6 +469,141 @@ protected:
   }
 };
 
+/**
+ * @brief Opt-in asynchronous handler dispatch for plugins.
+ *
+ * Handlers registered through Plugin::make_handler() run inline on
+ * the connection's rx thread, so bulk-protocol plugins (ftp, param)
+ * doing long service work delay high-rate handlers behind them.
+ * Plugins may additionally derive from QueuedPlugin and wrap
+ * selected subscriptions with queued() — those handlers then run on
+ * a per-plugin worker thread fed from a bounded queue — or with
+ * queued_latest(), where only the newest pending message survives
+ * (latest-value-wins, for high-rate topics where stale samples are
+ * worthless).
+ */
+class QueuedPlugin
+{
+public:
+  //! Default depth of the FIFO dispatch queue.
+  static constexpr size_t DEFAULT_QUEUE_DEPTH = 64;
+
+protected:
+  explicit QueuedPlugin(size_t queue_depth = DEFAULT_QUEUE_DEPTH);
+  virtual ~QueuedPlugin();
+
+  //! Move @p info handler onto the plugin worker (bounded FIFO,
+  //! overflow drops the newest message).
+  Plugin::HandlerInfo queued(Plugin::HandlerInfo info);
+
+  //! Like queued(), but only the newest pending message is kept.
+  Plugin::HandlerInfo queued_latest(Plugin::HandlerInfo info);
+
+  //! Stop the worker thread; queued messages are discarded.
+  void stop_worker();
+
+private:
+  struct WorkerState;
+  std::shared_ptr<WorkerState> worker_state;
+};
+
+/**
+ * @brief Reusable publish gate for high-rate republishing plugins.
+ *
+ * Wire-rate telemetry (RC channels, servo outputs, VFR HUD, ...) is
+ * often static or oversampled for the subscribers; the gate applies
+ * one of three policies in front of the publisher:
+ *
+ * - "passthrough": publish everything (default);
+ * - "on_change":   drop messages equal to the last published one
+ *                  (custom comparator, e.g. epsilon compare);
+ * - "throttle":    cap the output at a maximum rate.
+ */
+template<typename MessageT>
+class PublishGate
+{
+public:
+  using EqualFn = std::function<bool (const MessageT &, const MessageT &)>;
+
+  void configure(const std::string & policy_, const double max_rate_hz, EqualFn equal_fn_ = nullptr)
+  {
+    policy = Policy::passthrough;
+    if (policy_ == "on_change") {
+      policy = Policy::on_change;
+    } else if (policy_ == "throttle") {
+      policy = Policy::throttle;
+    }
+
+    min_period = (max_rate_hz > 0.0) ?
+      rclcpp::Duration::from_seconds(1.0 / max_rate_hz) : rclcpp::Duration(0, 0);
+    equal_fn = equal_fn_;
+    have_last = false;
+  }
+
+  //! @return true when @p msg should be published
+  bool accept(const MessageT & msg, const rclcpp::Time & now)
+  {
+    switch (policy) {
+      case Policy::on_change:
+        if (have_last && equal_fn && equal_fn(last_msg, msg)) {
+          return false;
+        }
+        last_msg = msg;
+        have_last = true;
+        return true;
+
+      case Policy::throttle:
+        if (have_last && (now - last_stamp) < min_period) {
+          return false;
+        }
+        last_stamp = now;
+        have_last = true;
+        return true;
+
+      default:
+        return true;
+    }
+  }
+
+private:
+  enum class Policy : uint8_t
+  {
+    passthrough,
+    on_change,
+    throttle,
+  };
+
+  Policy policy = Policy::passthrough;
+  rclcpp::Duration min_period {0, 0};
+  rclcpp::Time last_stamp {};
+  MessageT last_msg {};
+  bool have_last = false;
+  EqualFn equal_fn;
+};
+
+/**
+ * @brief Publish through the loaned message API when available.
+ *
+ * On zero-copy capable DDS transports (and fixed-size message
+ * types, see the bounded hot-topic definitions) this borrows the
+ * sample from the middleware and avoids both the allocation and the
+ * serialization copy; everywhere else it falls back to
+ * publish-by-copy. Intended for high-rate sensor topics.
+ */
+template<typename MessageT>
+inline void publish_loaned(
+  const typename rclcpp::Publisher<MessageT>::SharedPtr & pub,
+  const MessageT & msg)
+{
+  if (pub->can_loan_messages()) {
+    auto loaned = pub->borrow_loaned_message();
+    loaned.get() = msg;
+    pub->publish(std::move(loaned));
+  } else {
+    pub->publish(msg);
+  }
+}
+
 //! A factory class to help initialize plugin node from constructor
 class PluginFactory
 {
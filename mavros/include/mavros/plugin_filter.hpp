@@ -36,17 +36,28 @@ using UASPtr = UAS::SharedPtr;
 using mavconn::Framing;
 
 
+// NOTE: the static check() members are what the dispatch path calls
+// (see Plugin::make_handler): the predicate inlines into the handler
+// with no filter object construction or virtual call. The virtual
+// operator() remains for code holding a Filter reference.
+
 //! AnyOk filter passes all messages with Framing::ok
 class AnyOk : public Filter
 {
 public:
+  static inline bool check(
+    const UASPtr & uas [[maybe_unused]],
+    const mavlink::mavlink_message_t * cmsg [[maybe_unused]],
+    const Framing framing)
+  {
+    return framing == Framing::ok;
+  }
+
   inline bool operator()(
     UASPtr uas, const mavlink::mavlink_message_t * cmsg,
     const Framing framing) override
   {
-    (void)uas;
-    (void)cmsg;
-    return framing == Framing::ok;
+    return check(uas, cmsg, framing);
   }
 };
 
@@ -54,11 +65,18 @@ public:
 class SystemAndOk : public Filter
 {
 public:
+  static inline bool check(
+    const UASPtr & uas, const mavlink::mavlink_message_t * cmsg,
+    const Framing framing)
+  {
+    return framing == Framing::ok && uas->is_my_target(cmsg->sysid);
+  }
+
   inline bool operator()(
     UASPtr uas, const mavlink::mavlink_message_t * cmsg,
     const Framing framing) override
   {
-    return framing == Framing::ok && uas->is_my_target(cmsg->sysid);
+    return check(uas, cmsg, framing);
   }
 };
 
@@ -67,11 +85,18 @@ public:
 class ComponentAndOk : public Filter
 {
 public:
+  static inline bool check(
+    const UASPtr & uas, const mavlink::mavlink_message_t * cmsg,
+    const Framing framing)
+  {
+    return framing == Framing::ok && uas->is_my_target(cmsg->sysid, cmsg->compid);
+  }
+
   inline bool operator()(
     UASPtr uas, const mavlink::mavlink_message_t * cmsg,
     const Framing framing) override
   {
-    return framing == Framing::ok && uas->is_my_target(cmsg->sysid, cmsg->compid);
+    return check(uas, cmsg, framing);
   }
 };
 
@@ -19,8 +19,11 @@
 #ifndef MAVROS__SETPOINT_MIXIN_HPP_
 #define MAVROS__SETPOINT_MIXIN_HPP_
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <string>
+#include <thread>
 
 #include "rcpputils/asserts.hpp"
 #include "mavros/mavros_uas.hpp"
@@ -33,6 +36,144 @@ namespace mavros
 namespace plugin
 {
 
+/**
+ * @brief Latest-value setpoint pacer.
+ *
+ * Subscription callbacks store the newest sample into a latest-value
+ * slot with update(); a dedicated thread transmits that sample at an
+ * exact configured rate. This decouples SET_POSITION_TARGET timing
+ * from ROS executor jitter: a bursty or jittery upstream publisher
+ * can neither burst the Tx queue nor starve the offboard stream.
+ *
+ * The slot is guarded by a spinlock whose critical section is a
+ * single message copy — the pacer's send work never runs under it,
+ * so the subscription callback cannot be blocked behind the link.
+ *
+ * Transmission stops after STALE_PERIODS pacing periods without a
+ * fresh sample: a dead upstream publisher must trip the FCU's
+ * setpoint-timeout failsafe, not be masked by endless retransmission
+ * of the last value. It resumes on the next update().
+ */
+template<typename MsgT>
+class SetpointPacer
+{
+public:
+  using SendFn = std::function<void (const MsgT &)>;
+
+  SetpointPacer()
+  : running(false), has_value(false)
+  {
+    slot_lock.clear();
+  }
+
+  ~SetpointPacer()
+  {
+    stop();
+  }
+
+  //! Start the paced tx thread; @p send_fn runs on it.
+  void start(const double rate_hz, SendFn send_fn_)
+  {
+    stop();
+
+    send_fn = send_fn_;
+    period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<double>(1.0 / rate_hz));
+
+    running = true;
+    thread = std::thread([this]() {run();});
+  }
+
+  void stop()
+  {
+    running = false;
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+
+  bool is_running() const
+  {
+    return running;
+  }
+
+  //! Store the newest sample.
+  void update(const MsgT & msg)
+  {
+    while (slot_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    slot = msg;
+    slot_lock.clear(std::memory_order_release);
+
+    last_update_ns.store(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count(),
+      std::memory_order_relaxed);
+    has_value = true;
+  }
+
+private:
+  bool read(MsgT & out)
+  {
+    if (!has_value) {
+      return false;
+    }
+
+    while (slot_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    out = slot;
+    slot_lock.clear(std::memory_order_release);
+
+    return true;
+  }
+
+  void run()
+  {
+    mavconn::utils::set_this_thread_name("sp-pacer");
+    // best effort: jitter matters more than fairness here
+    mavconn::utils::set_this_thread_priority(SCHED_FIFO, 10);
+
+    // absolute deadlines: drift-free pacing regardless of send cost
+    auto next = std::chrono::steady_clock::now();
+    MsgT msg;
+
+    while (running) {
+      next += period;
+      std::this_thread::sleep_until(next);
+      if (!running) {
+        break;
+      }
+
+      // staleness bound: stop retransmitting a dead publisher's
+      // last setpoint so the FCU failsafe sees the loss
+      const int64_t now_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+      const int64_t age_ns = now_ns - last_update_ns.load(std::memory_order_relaxed);
+      if (age_ns > STALE_PERIODS * period.count()) {
+        continue;
+      }
+
+      if (read(msg)) {
+        send_fn(msg);
+      }
+    }
+  }
+
+  //! pacing periods without a fresh sample before output stops
+  static constexpr int64_t STALE_PERIODS = 3;
+
+  std::atomic<bool> running;
+  std::atomic<bool> has_value;
+  std::atomic<int64_t> last_update_ns {0};
+  std::atomic_flag slot_lock;
+  MsgT slot;
+
+  SendFn send_fn;
+  std::chrono::nanoseconds period;
+  std::thread thread;
+};
+
 /**
  * @brief This mixin adds set_position_target_local_ned()
  */
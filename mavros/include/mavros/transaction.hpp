@@ -0,0 +1,151 @@
+/*
+ * Copyright 2021 Vladimir Ermakov.
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+/**
+ * @brief Shared protocol transaction engine
+ * @file transaction.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup plugin
+ * @{
+ */
+
+#pragma once
+
+#ifndef MAVROS__TRANSACTION_HPP_
+#define MAVROS__TRANSACTION_HPP_
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+
+namespace mavros
+{
+namespace plugin
+{
+
+/**
+ * @brief Shared timeout service for request/ack protocols.
+ *
+ * The param, ftp and mission plugins each ran their own wall timer
+ * for timeout/retry bookkeeping. This engine multiplexes any number
+ * of transaction slots onto one coarse timer wheel (100 ms tick,
+ * protocol timeouts are >= 1 s): a plugin creates a slot with its
+ * timeout callback, then arms it when a request goes out and
+ * cancels it when the answer arrives. Many transactions may be
+ * armed concurrently; retry policy stays with the protocol code,
+ * which re-arms from its timeout callback.
+ *
+ * Callbacks fire from the node's executor context with no engine
+ * lock held, so they may freely arm/cancel/create slots.
+ */
+class TransactionEngine
+{
+public:
+  using SharedPtr = std::shared_ptr<TransactionEngine>;
+  using TimeoutCb = std::function<void ()>;
+
+  //! wheel granularity; fine enough for >= 1 s protocol timeouts
+  static constexpr std::chrono::milliseconds TICK {100};
+
+  explicit TransactionEngine(rclcpp::Node * node_)
+  : node(node_), next_id(1)
+  {
+  }
+
+  //! @brief Create a transaction slot (starts disarmed).
+  uint64_t create(const std::chrono::nanoseconds timeout, TimeoutCb cb)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const uint64_t id = next_id++;
+    slots.emplace(id, Slot{timeout, {}, false, std::move(cb)});
+
+    if (!wheel_timer) {
+      wheel_timer = node->create_wall_timer(
+        TICK, std::bind(&TransactionEngine::tick, this));
+    }
+
+    return id;
+  }
+
+  //! @brief (Re)start the countdown of slot @p id.
+  void arm(const uint64_t id)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = slots.find(id);
+    if (it != slots.end()) {
+      it->second.deadline = std::chrono::steady_clock::now() + it->second.timeout;
+      it->second.armed = true;
+    }
+  }
+
+  //! @brief Stop the countdown (answer arrived).
+  void cancel(const uint64_t id)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = slots.find(id);
+    if (it != slots.end()) {
+      it->second.armed = false;
+    }
+  }
+
+  //! @brief Drop the slot entirely.
+  void remove(const uint64_t id)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    slots.erase(id);
+  }
+
+private:
+  struct Slot
+  {
+    std::chrono::nanoseconds timeout;
+    std::chrono::steady_clock::time_point deadline;
+    bool armed;
+    TimeoutCb cb;
+  };
+
+  void tick()
+  {
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<TimeoutCb> expired;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto & kv : slots) {
+        if (kv.second.armed && now >= kv.second.deadline) {
+          kv.second.armed = false;
+          expired.push_back(kv.second.cb);
+        }
+      }
+    }
+
+    // run outside the lock: callbacks may arm/cancel/create
+    for (auto & cb : expired) {
+      cb();
+    }
+  }
+
+  rclcpp::Node * node;
+  std::mutex mutex;
+  uint64_t next_id;
+  std::unordered_map<uint64_t, Slot> slots;
+  rclcpp::TimerBase::SharedPtr wheel_timer;
+};
+
+}   // namespace plugin
+}   // namespace mavros
+
+#endif  // MAVROS__TRANSACTION_HPP_
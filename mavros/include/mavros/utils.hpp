@@ -20,7 +20,12 @@
 #ifndef MAVROS__UTILS_HPP_
 #define MAVROS__UTILS_HPP_
 
+#include <atomic>
+#include <mutex>
+#include <regex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <Eigen/Geometry>   // NOLINT
 
 #include "mavconn/thread_utils.hpp"
@@ -55,6 +60,100 @@ enum class timesync_mode
   PASSTHROUGH,
 };
 
+/**
+ * @brief Compiled allow/deny pattern matcher.
+ *
+ * Compiles fnmatch-style wildcard lists once into case-insensitive
+ * regexes and caches per-name verdicts, so startup plugin filtering
+ * and repeated runtime re-checks cost a hash lookup instead of a
+ * pattern scan per query.
+ *
+ * Verdict logic matches UAS plugin lists (issue #257): a name is
+ * denied when it matches the denylist unless it also matches the
+ * allowlist.
+ */
+class AllowDenyMatcher
+{
+public:
+  AllowDenyMatcher() = default;
+
+  //! Compile pattern lists; drops any cached verdicts.
+  void compile(
+    const std::vector<std::string> & denylist,
+    const std::vector<std::string> & allowlist);
+
+  //! Cached allow/deny verdict for @p name.
+  bool is_allowed(const std::string & name);
+
+private:
+  static std::regex glob_to_regex(const std::string & pattern);
+
+  std::vector<std::regex> deny_patterns;
+  std::vector<std::regex> allow_patterns;
+
+  std::mutex mu;
+  std::unordered_map<std::string, bool> verdict_cache;
+};
+
+/**
+ * @brief Tagged allocation counters for soak-test attribution.
+ *
+ * Plugin code may instantiate containers with
+ * CountingAllocator<T, tag> to attribute allocation traffic to a
+ * compile-time tag; counters are relaxed atomics, so the cost in
+ * the allocation path is two increments. Totals surface through the
+ * UAS memory diagnostics.
+ */
+struct AllocCounters
+{
+  std::atomic<uint64_t> alloc_calls {0};
+  std::atomic<uint64_t> alloc_bytes {0};
+
+  static constexpr size_t MAX_TAGS = 16;
+
+  //! per-tag counter slots; tag 0 is "untagged"
+  static AllocCounters & of_tag(size_t tag)
+  {
+    static AllocCounters counters[MAX_TAGS];
+    return counters[tag < MAX_TAGS ? tag : 0];
+  }
+};
+
+template<typename T, size_t Tag = 0>
+struct CountingAllocator
+{
+  using value_type = T;
+
+  CountingAllocator() = default;
+
+  template<typename U>
+  CountingAllocator(const CountingAllocator<U, Tag> &) {}    // NOLINT(runtime/explicit)
+
+  T * allocate(size_t n)
+  {
+    auto & c = AllocCounters::of_tag(Tag);
+    c.alloc_calls.fetch_add(1, std::memory_order_relaxed);
+    c.alloc_bytes.fetch_add(n * sizeof(T), std::memory_order_relaxed);
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T * p, size_t)
+  {
+    ::operator delete(p);
+  }
+
+  template<typename U>
+  bool operator==(const CountingAllocator<U, Tag> &) const
+  {
+    return true;
+  }
+  template<typename U>
+  bool operator!=(const CountingAllocator<U, Tag> &) const
+  {
+    return false;
+  }
+};
+
 /**
  * Helper to get enum value from strongly typed enum (enum class).
  */
@@ -85,6 +184,27 @@ std::string to_string(mavlink::common::MAV_MISSION_RESULT e);
 std::string to_string(mavlink::common::MAV_FRAME e);
 std::string to_string(mavlink::common::MAV_DISTANCE_SENSOR e);
 std::string to_string(mavlink::common::LANDING_TARGET_TYPE e);
+
+/**
+ * Zero-allocation to_string() variants.
+ *
+ * Lookups are reads of constexpr frozen tables; returns nullptr for
+ * out-of-range values. Prefer these on per-message paths (heartbeat
+ * diagnostics) where the std::string construction shows up.
+ */
+const char * to_cstring(timesync_mode e);
+const char * to_cstring(mavlink::minimal::MAV_AUTOPILOT e);
+const char * to_cstring(mavlink::minimal::MAV_TYPE e);
+const char * to_cstring(mavlink::minimal::MAV_STATE e);
+const char * to_cstring(mavlink::common::MAV_ESTIMATOR_TYPE e);
+const char * to_cstring(mavlink::common::ADSB_ALTITUDE_TYPE e);
+const char * to_cstring(mavlink::common::ADSB_EMITTER_TYPE e);
+const char * to_cstring(mavlink::common::GPS_FIX_TYPE e);
+const char * to_cstring(mavlink::common::MAV_MISSION_RESULT e);
+const char * to_cstring(mavlink::common::MAV_FRAME e);
+const char * to_cstring(mavlink::common::MAV_DISTANCE_SENSOR e);
+const char * to_cstring(mavlink::common::LANDING_TARGET_TYPE e);
+
 /**
  * Helper to call to_string() for enum _T
  */
@@ -95,12 +215,15 @@ std::string to_string_enum(int e)
 }
 
 std::string enum_to_name(mavlink::minimal::MAV_TYPE e);
+//! Zero-allocation variant of enum_to_name()
+const char * enum_to_name_cstring(mavlink::minimal::MAV_TYPE e);
 
 /**
  * @brief Function to match the received orientation received by MAVLink msg
  *        and the rotation of the sensor relative to the FCU.
  */
-Eigen::Quaterniond sensor_orientation_matching(mavlink::common::MAV_SENSOR_ORIENTATION orientation);
+const Eigen::Quaterniond & sensor_orientation_matching(
+  mavlink::common::MAV_SENSOR_ORIENTATION orientation);
 
 /**
  * @brief Retrieve sensor orientation number from alias name.
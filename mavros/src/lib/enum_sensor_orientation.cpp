@@ -14,6 +14,7 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <array>
 #include <string>
 #include <utility>
 
@@ -28,25 +29,16 @@ namespace utils
 
 using mavlink::common::MAV_SENSOR_ORIENTATION;
 
-// internal type: name - rotation
-using OrientationPair = std::pair<const std::string, const Eigen::Quaterniond>;
+//! internal type: name and quaternion components (w, x, y, z),
+//! computed at generation time so the table is pure data
+struct SensorOrientation
+{
+  const char * name;
+  double w, x, y, z;
+};
 
 static auto logger = rclcpp::get_logger("uas.enum");
 
-// internal data initializer
-static const OrientationPair make_orientation(
-  const std::string & name,
-  const double roll,
-  const double pitch,
-  const double yaw)
-{
-  constexpr auto DEG_TO_RAD = (M_PI / 180.0);
-  const Eigen::Quaterniond rot = ftf::quaternion_from_rpy(
-    Eigen::Vector3d(
-      roll, pitch,
-      yaw) * DEG_TO_RAD);
-  return std::make_pair(name, rot);
-}
 
 // [[[cog:
 // import attr
@@ -75,62 +67,92 @@ static const OrientationPair make_orientation(
 //             cog.msg(f"Parse Error: {ex}, desc: {desc}")
 //             return cls()
 //
-// cog.outl(f"static const std::array<const OrientationPair, {len(enum)}> sensor_orientations{{{{")
+// import math
+//
+// def quat_zyx(roll, pitch, yaw):
+//     # matches ftf::quaternion_from_rpy: Rz(yaw)*Ry(pitch)*Rx(roll)
+//     r, p, y = (math.radians(a) for a in (roll, pitch, yaw))
+//     cy, sy = math.cos(y / 2), math.sin(y / 2)
+//     cp, sp = math.cos(p / 2), math.sin(p / 2)
+//     cr, sr = math.cos(r / 2), math.sin(r / 2)
+//     return (cy * cp * cr + sy * sp * sr,
+//             cy * cp * sr - sy * sp * cr,
+//             cy * sp * cr + sy * cp * sr,
+//             sy * cp * cr - cy * sp * sr)
+//
+// cog.outl(f"static constexpr std::array<SensorOrientation, {len(enum)}> sensor_orientations{{{{")
 // for k, e in enum:
 //     name_short = e.name[len(pfx2):]
 //     vec = Vector3.parse_rpy(e.description)
+//     w, x, y, z = quat_zyx(vec.Roll, vec.Pitch, vec.Yaw)
 //     cog.outl(
-//         f"""/* {k:>2} */ make_orientation"""
-//         f"""("{name_short}", {vec.Roll}, {vec.Pitch}, {vec.Yaw}),""")
+//         f"""/* {k:>2} */ {{{{"{name_short}", {w!r}, {x!r}, {y!r}, {z!r}}}}},""")
 //
 // cog.outl("}};")
 // ]]]
-static const std::array<const OrientationPair, 42> sensor_orientations{{
-/*  0 */ make_orientation("NONE", 0.0, 0.0, 0.0),
-/*  1 */ make_orientation("YAW_45", 0.0, 0.0, 45.0),
-/*  2 */ make_orientation("YAW_90", 0.0, 0.0, 90.0),
-/*  3 */ make_orientation("YAW_135", 0.0, 0.0, 135.0),
-/*  4 */ make_orientation("YAW_180", 0.0, 0.0, 180.0),
-/*  5 */ make_orientation("YAW_225", 0.0, 0.0, 225.0),
-/*  6 */ make_orientation("YAW_270", 0.0, 0.0, 270.0),
-/*  7 */ make_orientation("YAW_315", 0.0, 0.0, 315.0),
-/*  8 */ make_orientation("ROLL_180", 180.0, 0.0, 0.0),
-/*  9 */ make_orientation("ROLL_180_YAW_45", 180.0, 0.0, 45.0),
-/* 10 */ make_orientation("ROLL_180_YAW_90", 180.0, 0.0, 90.0),
-/* 11 */ make_orientation("ROLL_180_YAW_135", 180.0, 0.0, 135.0),
-/* 12 */ make_orientation("PITCH_180", 0.0, 180.0, 0.0),
-/* 13 */ make_orientation("ROLL_180_YAW_225", 180.0, 0.0, 225.0),
-/* 14 */ make_orientation("ROLL_180_YAW_270", 180.0, 0.0, 270.0),
-/* 15 */ make_orientation("ROLL_180_YAW_315", 180.0, 0.0, 315.0),
-/* 16 */ make_orientation("ROLL_90", 90.0, 0.0, 0.0),
-/* 17 */ make_orientation("ROLL_90_YAW_45", 90.0, 0.0, 45.0),
-/* 18 */ make_orientation("ROLL_90_YAW_90", 90.0, 0.0, 90.0),
-/* 19 */ make_orientation("ROLL_90_YAW_135", 90.0, 0.0, 135.0),
-/* 20 */ make_orientation("ROLL_270", 270.0, 0.0, 0.0),
-/* 21 */ make_orientation("ROLL_270_YAW_45", 270.0, 0.0, 45.0),
-/* 22 */ make_orientation("ROLL_270_YAW_90", 270.0, 0.0, 90.0),
-/* 23 */ make_orientation("ROLL_270_YAW_135", 270.0, 0.0, 135.0),
-/* 24 */ make_orientation("PITCH_90", 0.0, 90.0, 0.0),
-/* 25 */ make_orientation("PITCH_270", 0.0, 270.0, 0.0),
-/* 26 */ make_orientation("PITCH_180_YAW_90", 0.0, 180.0, 90.0),
-/* 27 */ make_orientation("PITCH_180_YAW_270", 0.0, 180.0, 270.0),
-/* 28 */ make_orientation("ROLL_90_PITCH_90", 90.0, 90.0, 0.0),
-/* 29 */ make_orientation("ROLL_180_PITCH_90", 180.0, 90.0, 0.0),
-/* 30 */ make_orientation("ROLL_270_PITCH_90", 270.0, 90.0, 0.0),
-/* 31 */ make_orientation("ROLL_90_PITCH_180", 90.0, 180.0, 0.0),
-/* 32 */ make_orientation("ROLL_270_PITCH_180", 270.0, 180.0, 0.0),
-/* 33 */ make_orientation("ROLL_90_PITCH_270", 90.0, 270.0, 0.0),
-/* 34 */ make_orientation("ROLL_180_PITCH_270", 180.0, 270.0, 0.0),
-/* 35 */ make_orientation("ROLL_270_PITCH_270", 270.0, 270.0, 0.0),
-/* 36 */ make_orientation("ROLL_90_PITCH_180_YAW_90", 90.0, 180.0, 90.0),
-/* 37 */ make_orientation("ROLL_90_YAW_270", 90.0, 0.0, 270.0),
-/* 38 */ make_orientation("ROLL_90_PITCH_68_YAW_293", 90.0, 68.0, 293.0),
-/* 39 */ make_orientation("PITCH_315", 0.0, 315.0, 0.0),
-/* 40 */ make_orientation("ROLL_90_PITCH_315", 90.0, 315.0, 0.0),
-/* 100 */ make_orientation("CUSTOM", 0.0, 0.0, 0.0),
+static constexpr std::array<SensorOrientation, 42> sensor_orientations{{
+/*  0 */ {"NONE", 1.0, 0.0, 0.0, 0.0},
+/*  1 */ {"YAW_45", 0.9238795325112867, 0.0, 0.0, 0.3826834323650898},
+/*  2 */ {"YAW_90", 0.7071067811865476, 0.0, 0.0, 0.7071067811865475},
+/*  3 */ {"YAW_135", 0.38268343236508984, 0.0, 0.0, 0.9238795325112867},
+/*  4 */ {"YAW_180", 6.123233995736766e-17, 0.0, 0.0, 1.0},
+/*  5 */ {"YAW_225", -0.3826834323650897, -0.0, 0.0, 0.9238795325112867},
+/*  6 */ {"YAW_270", -0.7071067811865475, -0.0, 0.0, 0.7071067811865476},
+/*  7 */ {"YAW_315", -0.9238795325112867, -0.0, 0.0, 0.3826834323650899},
+/*  8 */ {"ROLL_180", 6.123233995736766e-17, 1.0, 0.0, 0.0},
+/*  9 */ {"ROLL_180_YAW_45", 5.657130561438501e-17, 0.9238795325112867, 0.3826834323650898, 2.3432602026631493e-17},
+/* 10 */ {"ROLL_180_YAW_90", 4.329780281177467e-17, 0.7071067811865476, 0.7071067811865475, 4.329780281177466e-17},
+/* 11 */ {"ROLL_180_YAW_135", 2.3432602026631496e-17, 0.38268343236508984, 0.9238795325112867, 5.657130561438501e-17},
+/* 12 */ {"PITCH_180", 6.123233995736766e-17, 0.0, 1.0, 0.0},
+/* 13 */ {"ROLL_180_YAW_225", -2.3432602026631487e-17, -0.3826834323650897, 0.9238795325112867, 5.657130561438501e-17},
+/* 14 */ {"ROLL_180_YAW_270", -4.329780281177466e-17, -0.7071067811865475, 0.7071067811865476, 4.329780281177467e-17},
+/* 15 */ {"ROLL_180_YAW_315", -5.657130561438501e-17, -0.9238795325112867, 0.3826834323650899, 2.34326020266315e-17},
+/* 16 */ {"ROLL_90", 0.7071067811865476, 0.7071067811865475, 0.0, 0.0},
+/* 17 */ {"ROLL_90_YAW_45", 0.6532814824381883, 0.6532814824381882, 0.27059805007309845, 0.2705980500730985},
+/* 18 */ {"ROLL_90_YAW_90", 0.5000000000000001, 0.5, 0.4999999999999999, 0.5},
+/* 19 */ {"ROLL_90_YAW_135", 0.27059805007309856, 0.2705980500730985, 0.6532814824381882, 0.6532814824381883},
+/* 20 */ {"ROLL_270", -0.7071067811865475, 0.7071067811865476, 0.0, -0.0},
+/* 21 */ {"ROLL_270_YAW_45", -0.6532814824381882, 0.6532814824381883, 0.2705980500730985, -0.27059805007309845},
+/* 22 */ {"ROLL_270_YAW_90", -0.5, 0.5000000000000001, 0.5, -0.4999999999999999},
+/* 23 */ {"ROLL_270_YAW_135", -0.2705980500730985, 0.27059805007309856, 0.6532814824381883, -0.6532814824381882},
+/* 24 */ {"PITCH_90", 0.7071067811865476, 0.0, 0.7071067811865475, 0.0},
+/* 25 */ {"PITCH_270", -0.7071067811865475, -0.0, 0.7071067811865476, -0.0},
+/* 26 */ {"PITCH_180_YAW_90", 4.329780281177467e-17, -0.7071067811865475, 0.7071067811865476, 4.329780281177466e-17},
+/* 27 */ {"PITCH_180_YAW_270", -4.329780281177466e-17, -0.7071067811865476, -0.7071067811865475, 4.329780281177467e-17},
+/* 28 */ {"ROLL_90_PITCH_90", 0.5000000000000001, 0.5, 0.5, -0.4999999999999999},
+/* 29 */ {"ROLL_180_PITCH_90", 4.329780281177467e-17, 0.7071067811865476, 4.329780281177466e-17, -0.7071067811865475},
+/* 30 */ {"ROLL_270_PITCH_90", -0.5, 0.5000000000000001, -0.4999999999999999, -0.5},
+/* 31 */ {"ROLL_90_PITCH_180", 4.329780281177467e-17, 4.329780281177466e-17, 0.7071067811865476, -0.7071067811865475},
+/* 32 */ {"ROLL_270_PITCH_180", -4.329780281177466e-17, 4.329780281177467e-17, -0.7071067811865475, -0.7071067811865476},
+/* 33 */ {"ROLL_90_PITCH_270", -0.5, -0.4999999999999999, 0.5000000000000001, -0.5},
+/* 34 */ {"ROLL_180_PITCH_270", -4.329780281177466e-17, -0.7071067811865475, 4.329780281177467e-17, -0.7071067811865476},
+/* 35 */ {"ROLL_270_PITCH_270", 0.4999999999999999, -0.5, -0.5, -0.5000000000000001},
+/* 36 */ {"ROLL_90_PITCH_180_YAW_90", 0.49999999999999994, -0.49999999999999994, 0.5000000000000001, -0.49999999999999994},
+/* 37 */ {"ROLL_90_YAW_270", -0.5, -0.4999999999999999, 0.5, 0.5000000000000001},
+/* 38 */ {"ROLL_90_PITCH_68_YAW_293", -0.27059805007309834, -0.7070798567270162, -0.006170592427165389, 0.6532814824381883},
+/* 39 */ {"PITCH_315", -0.9238795325112867, -0.0, 0.3826834323650899, -0.0},
+/* 40 */ {"ROLL_90_PITCH_315", -0.6532814824381883, -0.6532814824381882, 0.2705980500730986, -0.27059805007309856},
+/* 100 */ {"CUSTOM", 1.0, 0.0, 0.0, 0.0},
 }};
-// [[[end]]] (checksum: 2ed537a9279bb6a3992df43e225bbeb7)
+// [[[end]]] (checksum: efb7ea077493e670b43d7f0002ce9af3)
+
 
+//! Eigen quaternions materialized once from the constexpr table
+static const std::array<Eigen::Quaterniond, 42> & orientation_quaternions()
+{
+  static const auto table = []() {
+      std::array<Eigen::Quaterniond, 42> out;
+
+      for (size_t idx = 0; idx < out.size(); idx++) {
+        const auto & so = sensor_orientations[idx];
+        out[idx] = Eigen::Quaterniond(so.w, so.x, so.y, so.z);
+      }
+
+      return out;
+    } ();
+
+  return table;
+}
 
 std::string to_string(MAV_SENSOR_ORIENTATION orientation)
 {
@@ -140,18 +162,20 @@ std::string to_string(MAV_SENSOR_ORIENTATION orientation)
     return std::to_string(idx);
   }
 
-  return sensor_orientations[idx].first;
+  return sensor_orientations[idx].name;
 }
 
-Eigen::Quaterniond sensor_orientation_matching(MAV_SENSOR_ORIENTATION orientation)
+const Eigen::Quaterniond & sensor_orientation_matching(MAV_SENSOR_ORIENTATION orientation)
 {
+  static const Eigen::Quaterniond identity = Eigen::Quaterniond::Identity();
+
   const auto idx = enum_value(orientation);
   if (idx >= sensor_orientations.size()) {
     RCLCPP_ERROR(logger, "SENSOR: wrong orientation index: %d", idx);
-    return Eigen::Quaterniond::Identity();
+    return identity;
   }
 
-  return sensor_orientations[idx].second;
+  return orientation_quaternions()[idx];
 }
 
 int sensor_orientation_from_str(const std::string & sensor_orientation)
@@ -160,7 +184,7 @@ int sensor_orientation_from_str(const std::string & sensor_orientation)
 
   // 1. try to find by name
   for (size_t idx = 0; idx < sensor_orientations.size(); idx++) {
-    if (sensor_orientations[idx].first == sensor_orientation) {
+    if (sensor_orientation == sensor_orientations[idx].name) {
       return idx;
     }
   }
@@ -76,20 +76,35 @@ static auto logger = rclcpp::get_logger("uas.enum");
 //     array = ename_array_name(name, suffix)
 //     cog.outl(f"""\
 // //! {name} values
-// static const std::array<const std::string, {len(enum)}> {array}{{{{""")
+// static constexpr std::array<const char *, {len(enum)}> {array}{{{{""")
+//
+//
+// def cstring_name(funcname):
+//     return 'to_cstring' if funcname == 'to_string' else funcname + '_cstring'
 //
 //
 // def to_string_outl(ename, funcname='to_string', suffix=None):
 //     array = ename_array_name(ename, suffix)
+//     cfunc = cstring_name(funcname)
 //     cog.outl(f"""\
-// std::string {funcname}({ename} e)
+// const char * {cfunc}({ename} e)
 // {{
 //   size_t idx = enum_value(e);
 //   if (idx >= {array}.size()) {{
-//     return std::to_string(idx);
+//     return nullptr;
 //   }}
 //
 //   return {array}[idx];
+// }}
+//
+// std::string {funcname}({ename} e)
+// {{
+//   auto cs = {cfunc}(e);
+//   if (cs == nullptr) {{
+//     return std::to_string(enum_value(e));
+//   }}
+//
+//   return cs;
 // }}""")
 //
 //
@@ -134,7 +149,7 @@ static auto logger = rclcpp::get_logger("uas.enum");
 // enum_value_is_description_outl(ename)
 // ]]]
 //! MAV_AUTOPILOT values
-static const std::array<const std::string, 20> mav_autopilot_strings{{
+static constexpr std::array<const char *, 20> mav_autopilot_strings{{
 /*  0 */ "Generic autopilot",
 /*  1 */ "Reserved for future use",
 /*  2 */ "SLUGS autopilot",
@@ -157,23 +172,33 @@ static const std::array<const std::string, 20> mav_autopilot_strings{{
 /* 19 */ "AirRails",
 }};
 
-std::string to_string(MAV_AUTOPILOT e)
+const char * to_cstring(MAV_AUTOPILOT e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_autopilot_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_autopilot_strings[idx];
 }
-// [[[end]]] (checksum: 387a860b046aee21d511e60e364688ba)
+
+std::string to_string(MAV_AUTOPILOT e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: 879bbb735559a8c46cc69bd70cae3b61)
 
 // [[[cog:
 // ename = 'MAV_TYPE'
 // enum_value_is_description_outl(ename)
 // ]]]
 //! MAV_TYPE values
-static const std::array<const std::string, 37> mav_type_strings{{
+static constexpr std::array<const char *, 37> mav_type_strings{{
 /*  0 */ "Generic micro air vehicle",
 /*  1 */ "Fixed wing aircraft",
 /*  2 */ "Quadrotor",
@@ -213,23 +238,33 @@ static const std::array<const std::string, 37> mav_type_strings{{
 /* 36 */ "Battery",
 }};
 
-std::string to_string(MAV_TYPE e)
+const char * to_cstring(MAV_TYPE e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_type_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_type_strings[idx];
 }
-// [[[end]]] (checksum: 2beb0ad0074f54374b49a0654be4c2ac)
+
+std::string to_string(MAV_TYPE e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: ee3bf7f8053b6ea16b9b2a01f02f8038)
 
 // [[[cog:
 // ename = 'MAV_TYPE'
 // enum_value_is_name_outl(ename, funcname='enum_to_name', suffix='_names')
 // ]]]
 //! MAV_TYPE values
-static const std::array<const std::string, 37> mav_type_names{{
+static constexpr std::array<const char *, 37> mav_type_names{{
 /*  0 */ "GENERIC",
 /*  1 */ "FIXED_WING",
 /*  2 */ "QUADROTOR",
@@ -269,23 +304,33 @@ static const std::array<const std::string, 37> mav_type_names{{
 /* 36 */ "BATTERY",
 }};
 
-std::string enum_to_name(MAV_TYPE e)
+const char * enum_to_name_cstring(MAV_TYPE e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_type_names.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_type_names[idx];
 }
-// [[[end]]] (checksum: 58dbf88b346c0f2aa68917b71643b2f2)
+
+std::string enum_to_name(MAV_TYPE e)
+{
+  auto cs = enum_to_name_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: b40e88d565e736d899eb33bffba6b362)
 
 // [[[cog:
 // ename = 'MAV_STATE'
 // enum_value_is_name_outl(ename)
 // ]]]
 //! MAV_STATE values
-static const std::array<const std::string, 9> mav_state_strings{{
+static constexpr std::array<const char *, 9> mav_state_strings{{
 /*  0 */ "UNINIT",
 /*  1 */ "BOOT",
 /*  2 */ "CALIBRATING",
@@ -297,16 +342,26 @@ static const std::array<const std::string, 9> mav_state_strings{{
 /*  8 */ "FLIGHT_TERMINATION",
 }};
 
-std::string to_string(MAV_STATE e)
+const char * to_cstring(MAV_STATE e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_state_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_state_strings[idx];
 }
-// [[[end]]] (checksum: 170b518da48f77c54ea2681fdff01951)
+
+std::string to_string(MAV_STATE e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: 385d560c8fb0c83e5e0c21e1872432c9)
 
 // [[[cog:
 // ename = "timesync_mode"
@@ -321,23 +376,33 @@ std::string to_string(MAV_STATE e)
 // to_string_outl(ename)
 // ]]]
 //! timesync_mode values
-static const std::array<const std::string, 4> timesync_mode_strings{{
+static constexpr std::array<const char *, 4> timesync_mode_strings{{
 /*  0 */ "NONE",
 /*  1 */ "MAVLINK",
 /*  2 */ "ONBOARD",
 /*  3 */ "PASSTHROUGH",
 }};
 
-std::string to_string(timesync_mode e)
+const char * to_cstring(timesync_mode e)
 {
   size_t idx = enum_value(e);
   if (idx >= timesync_mode_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return timesync_mode_strings[idx];
 }
-// [[[end]]] (checksum: 3dfd2acb938e62ee606f93aeb7c5b086)
+
+std::string to_string(timesync_mode e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: bdbb6045012e9056b00b5127ed3752ba)
 
 timesync_mode timesync_mode_from_str(const std::string & mode)
 {
@@ -357,28 +422,38 @@ timesync_mode timesync_mode_from_str(const std::string & mode)
 // enum_value_is_name_outl(ename)
 // ]]]
 //! ADSB_ALTITUDE_TYPE values
-static const std::array<const std::string, 2> adsb_altitude_type_strings{{
+static constexpr std::array<const char *, 2> adsb_altitude_type_strings{{
 /*  0 */ "PRESSURE_QNH",
 /*  1 */ "GEOMETRIC",
 }};
 
-std::string to_string(ADSB_ALTITUDE_TYPE e)
+const char * to_cstring(ADSB_ALTITUDE_TYPE e)
 {
   size_t idx = enum_value(e);
   if (idx >= adsb_altitude_type_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return adsb_altitude_type_strings[idx];
 }
-// [[[end]]] (checksum: 72e4ce5bc5cf2e2c351869433e644667)
+
+std::string to_string(ADSB_ALTITUDE_TYPE e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: ec7b245e287bf3442497126f09e395fe)
 
 // [[[cog:
 // ename = 'ADSB_EMITTER_TYPE'
 // enum_value_is_name_outl(ename)
 // ]]]
 //! ADSB_EMITTER_TYPE values
-static const std::array<const std::string, 20> adsb_emitter_type_strings{{
+static constexpr std::array<const char *, 20> adsb_emitter_type_strings{{
 /*  0 */ "NO_INFO",
 /*  1 */ "LIGHT",
 /*  2 */ "SMALL",
@@ -401,23 +476,33 @@ static const std::array<const std::string, 20> adsb_emitter_type_strings{{
 /* 19 */ "POINT_OBSTACLE",
 }};
 
-std::string to_string(ADSB_EMITTER_TYPE e)
+const char * to_cstring(ADSB_EMITTER_TYPE e)
 {
   size_t idx = enum_value(e);
   if (idx >= adsb_emitter_type_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return adsb_emitter_type_strings[idx];
 }
-// [[[end]]] (checksum: 784076231225119b1c07a3bc8cc0e4af)
+
+std::string to_string(ADSB_EMITTER_TYPE e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: f85d75c35e4d88d5e9d2946bc383796f)
 
 // [[[cog:
 // ename = 'MAV_ESTIMATOR_TYPE'
 // enum_value_is_name_outl(ename)
 // ]]]
 //! MAV_ESTIMATOR_TYPE values
-static const std::array<const std::string, 9> mav_estimator_type_strings{{
+static constexpr std::array<const char *, 9> mav_estimator_type_strings{{
 /*  0 */ "UNKNOWN",
 /*  1 */ "NAIVE",
 /*  2 */ "VISION",
@@ -429,23 +514,33 @@ static const std::array<const std::string, 9> mav_estimator_type_strings{{
 /*  8 */ "AUTOPILOT",
 }};
 
-std::string to_string(MAV_ESTIMATOR_TYPE e)
+const char * to_cstring(MAV_ESTIMATOR_TYPE e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_estimator_type_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_estimator_type_strings[idx];
 }
-// [[[end]]] (checksum: 8e80791aa874e22d81ae16061d36b009)
+
+std::string to_string(MAV_ESTIMATOR_TYPE e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: 333a2ab9b9bb2e42874f1d649bdf39ab)
 
 // [[[cog:
 // ename = 'GPS_FIX_TYPE'
 // enum_value_is_name_outl(ename)
 // ]]]
 //! GPS_FIX_TYPE values
-static const std::array<const std::string, 9> gps_fix_type_strings{{
+static constexpr std::array<const char *, 9> gps_fix_type_strings{{
 /*  0 */ "NO_GPS",
 /*  1 */ "NO_FIX",
 /*  2 */ "2D_FIX",
@@ -457,23 +552,33 @@ static const std::array<const std::string, 9> gps_fix_type_strings{{
 /*  8 */ "PPP",
 }};
 
-std::string to_string(GPS_FIX_TYPE e)
+const char * to_cstring(GPS_FIX_TYPE e)
 {
   size_t idx = enum_value(e);
   if (idx >= gps_fix_type_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return gps_fix_type_strings[idx];
 }
-// [[[end]]] (checksum: 9cdb29f44c89bf9d2c8d2ff1edf259a9)
+
+std::string to_string(GPS_FIX_TYPE e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: cad5d8b69e9f06fbd3d3fa19e1debc0b)
 
 // [[[cog:
 // ename = 'MAV_MISSION_RESULT'
 // enum_value_is_description_outl(ename, split_by_delim='')
 // ]]]
 //! MAV_MISSION_RESULT values
-static const std::array<const std::string, 16> mav_mission_result_strings{{
+static constexpr std::array<const char *, 16> mav_mission_result_strings{{
 /*  0 */ "mission accepted OK",
 /*  1 */ "Generic error / not accepting mission commands at all right now.",
 /*  2 */ "Coordinate frame is not supported.",
@@ -492,23 +597,33 @@ static const std::array<const std::string, 16> mav_mission_result_strings{{
 /* 15 */ "Current mission operation cancelled (e.g. mission upload, mission download).",
 }};
 
-std::string to_string(MAV_MISSION_RESULT e)
+const char * to_cstring(MAV_MISSION_RESULT e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_mission_result_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_mission_result_strings[idx];
 }
-// [[[end]]] (checksum: dd50fe6b84e206d1451eef5de0caf7e2)
+
+std::string to_string(MAV_MISSION_RESULT e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: 21916943f1f89e1e0de5078e8bc38faf)
 
 // [[[cog:
 // ename = 'MAV_FRAME'
 // enum_value_is_name_outl(ename)
 // ]]]
 //! MAV_FRAME values
-static const std::array<const std::string, 22> mav_frame_strings{{
+static constexpr std::array<const char *, 22> mav_frame_strings{{
 /*  0 */ "GLOBAL",
 /*  1 */ "LOCAL_NED",
 /*  2 */ "MISSION",
@@ -533,16 +648,26 @@ static const std::array<const std::string, 22> mav_frame_strings{{
 /* 21 */ "LOCAL_FLU",
 }};
 
-std::string to_string(MAV_FRAME e)
+const char * to_cstring(MAV_FRAME e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_frame_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_frame_strings[idx];
 }
-// [[[end]]] (checksum: b1c9fb7f66bf65a157962e30f6572a4e)
+
+std::string to_string(MAV_FRAME e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: fa4dab9fd51f5dd3e3c5726e087ed1f9)
 
 // [[[cog:
 // ename = 'MAV_COMPONENT'
@@ -550,7 +675,7 @@ std::string to_string(MAV_FRAME e)
 // enum = get_enum(ename)
 //
 // cog.outl(
-//     f"static const std::unordered_map<size_t, const std::string> "
+//     f"static const std::unordered_map<size_t, const char *> "
 //     f"{suffix.lower()}_strings{{{{")
 // for k, e in enum:
 //     name_short =  e.name[len(suffix) + 1:]
@@ -562,7 +687,7 @@ std::string to_string(MAV_FRAME e)
 //
 // cog.outl("}};")
 // ]]]
-static const std::unordered_map<size_t, const std::string> mav_comp_id_strings{{
+static const std::unordered_map<size_t, const char *> mav_comp_id_strings{{
   {0, "ALL"},
   {1, "AUTOPILOT1"},
   {25, "USER1"},
@@ -693,7 +818,7 @@ static const std::unordered_map<size_t, const std::string> mav_comp_id_strings{{
   {242, "TUNNEL_NODE"},
   {250, "SYSTEM_CONTROL"},
 }};
-// [[[end]]] (checksum: c0c9e6b7645f3c80f00cb6a9da293722)
+// [[[end]]] (checksum: 864df8b68db2e8ae4bc5daeca4ef25c3)
 
 std::string to_string(MAV_COMPONENT e)
 {
@@ -737,7 +862,7 @@ MAV_TYPE mav_type_from_str(const std::string & mav_type)
 // enum_value_is_name_outl(ename)
 // ]]]
 //! MAV_DISTANCE_SENSOR values
-static const std::array<const std::string, 5> mav_distance_sensor_strings{{
+static constexpr std::array<const char *, 5> mav_distance_sensor_strings{{
 /*  0 */ "LASER",
 /*  1 */ "ULTRASOUND",
 /*  2 */ "INFRARED",
@@ -745,39 +870,59 @@ static const std::array<const std::string, 5> mav_distance_sensor_strings{{
 /*  4 */ "UNKNOWN",
 }};
 
-std::string to_string(MAV_DISTANCE_SENSOR e)
+const char * to_cstring(MAV_DISTANCE_SENSOR e)
 {
   size_t idx = enum_value(e);
   if (idx >= mav_distance_sensor_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return mav_distance_sensor_strings[idx];
 }
-// [[[end]]] (checksum: 21f7c2c585aa0140ed900032689dbfd8)
+
+std::string to_string(MAV_DISTANCE_SENSOR e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: 9ecbd072e4e0994cbba46807120bdc48)
 
 // [[[cog:
 // ename = 'LANDING_TARGET_TYPE'
 // enum_value_is_name_outl(ename)
 // ]]]
 //! LANDING_TARGET_TYPE values
-static const std::array<const std::string, 4> landing_target_type_strings{{
+static constexpr std::array<const char *, 4> landing_target_type_strings{{
 /*  0 */ "LIGHT_BEACON",
 /*  1 */ "RADIO_BEACON",
 /*  2 */ "VISION_FIDUCIAL",
 /*  3 */ "VISION_OTHER",
 }};
 
-std::string to_string(LANDING_TARGET_TYPE e)
+const char * to_cstring(LANDING_TARGET_TYPE e)
 {
   size_t idx = enum_value(e);
   if (idx >= landing_target_type_strings.size()) {
-    return std::to_string(idx);
+    return nullptr;
   }
 
   return landing_target_type_strings[idx];
 }
-// [[[end]]] (checksum: c8f41c140ea9c3119e4c2bec3772c666)
+
+std::string to_string(LANDING_TARGET_TYPE e)
+{
+  auto cs = to_cstring(e);
+  if (cs == nullptr) {
+    return std::to_string(enum_value(e));
+  }
+
+  return cs;
+}
+// [[[end]]] (checksum: 79898b19721fba433a290d0e2e9b4d96)
 
 LANDING_TARGET_TYPE landing_target_type_from_str(const std::string & landing_target_type)
 {
@@ -29,15 +29,20 @@ namespace detail
  * @brief Static quaternion needed for rotating between ENU and NED frames
  * NED to ENU: +PI/2 rotation about Z (Down) followed by a +PI rotation around X (old North/new East)
  * ENU to NED: +PI/2 rotation about Z (Up) followed by a +PI rotation about X (old East/new North)
+ *
+ * Exact closed form of quaternion_from_rpy(M_PI, 0.0, M_PI_2):
+ * no trig at static init (checked by unittests).
  */
-static const auto NED_ENU_Q = quaternion_from_rpy(M_PI, 0.0, M_PI_2);
+static const Eigen::Quaterniond NED_ENU_Q(0.0, M_SQRT1_2, M_SQRT1_2, 0.0);
 
 /**
  * @brief Static quaternion needed for rotating between aircraft and base_link frames
  * +PI rotation around X (Forward) axis transforms from Forward, Right, Down (aircraft)
  * Fto Forward, Left, Up (base_link) frames.
+ *
+ * Exact closed form of quaternion_from_rpy(M_PI, 0.0, 0.0).
  */
-static const auto AIRCRAFT_BASELINK_Q = quaternion_from_rpy(M_PI, 0.0, 0.0);
+static const Eigen::Quaterniond AIRCRAFT_BASELINK_Q(0.0, 1.0, 0.0, 0.0);
 
 /**
  * @brief Static vector needed for rotating between ENU and NED frames
@@ -69,11 +74,71 @@ static const Eigen::PermutationMatrix<3> NED_ENU_REFLECTION_XY(Eigen::Vector3i(1
 static const Eigen::DiagonalMatrix<double, 3> NED_ENU_REFLECTION_Z(1, 1, -1);
 
 /**
- * @brief Auxiliar matrices to Covariance transforms
+ * @brief Apply R * C * R^T on a covariance built from 3x3 blocks.
+ *
+ * The 6x6/9x9 rotation is block-diagonal with three identical 3x3
+ * blocks, so the full dense product reduces to one fixed-size
+ * 3-factor product per block — a few hundred FLOPs for the 9d case
+ * instead of ~2k, with no temporary NxN matrices.
  */
-using Matrix6d = Eigen::Matrix<double, 6, 6>;
-using Matrix9d = Eigen::Matrix<double, 9, 9>;
+template<typename MatIn, typename MatOut>
+static inline void rotate_covariance_blocks(
+  const Eigen::Matrix3d & R, const MatIn & cov_in, MatOut & cov_out)
+{
+  constexpr int nblocks = MatIn::RowsAtCompileTime / 3;
+  const Eigen::Matrix3d Rt = R.transpose();
+
+  for (int bi = 0; bi < nblocks; bi++) {
+    for (int bj = 0; bj < nblocks; bj++) {
+      cov_out.template block<3, 3>(bi * 3, bj * 3) =
+        R * cov_in.template block<3, 3>(bi * 3, bj * 3) * Rt;
+    }
+  }
+}
+
+
+/**
+ * Left/right quaternion products as linear maps over coeffs (x,y,z,w),
+ * used to precompose the common ned+aircraft -> enu+baselink chain
+ * into a single 4x4 multiply.
+ */
+static Eigen::Matrix4d quat_left_product_matrix(const Eigen::Quaterniond & l)
+{
+  Eigen::Matrix4d m;
+  const Eigen::Quaterniond basis[4] = {
+    {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}, {1, 0, 0, 0}};
+
+  for (int i = 0; i < 4; i++) {
+    m.col(i) = (l * basis[i]).coeffs();
+  }
+
+  return m;
+}
+
+static Eigen::Matrix4d quat_right_product_matrix(const Eigen::Quaterniond & r)
+{
+  Eigen::Matrix4d m;
+  const Eigen::Quaterniond basis[4] = {
+    {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}, {1, 0, 0, 0}};
+
+  for (int i = 0; i < 4; i++) {
+    m.col(i) = (basis[i] * r).coeffs();
+  }
+
+  return m;
+}
+
+//! Precomposed NED_ENU_Q * q * AIRCRAFT_BASELINK_Q (involution: same
+//! matrix serves both directions)
+static const Eigen::Matrix4d NED_AIRCRAFT_ENU_BASELINK_M =
+  quat_left_product_matrix(NED_ENU_Q) * quat_right_product_matrix(AIRCRAFT_BASELINK_Q);
 
+Eigen::Quaterniond transform_orientation_ned_aircraft_enu_baselink(const Eigen::Quaterniond & q)
+{
+  Eigen::Quaterniond out;
+  out.coeffs() = NED_AIRCRAFT_ENU_BASELINK_M * q.coeffs();
+  return out;
+}
 
 Eigen::Quaterniond transform_orientation(const Eigen::Quaterniond & q, const StaticTF transform)
 {
@@ -144,7 +209,6 @@ Covariance3d transform_static_frame(const Covariance3d & cov, const StaticTF tra
 Covariance6d transform_static_frame(const Covariance6d & cov, const StaticTF transform)
 {
   Covariance6d cov_out_;
-  Matrix6d R = Matrix6d::Zero();        // not `auto` because Zero ret is const
 
   EigenMapConstCovariance6d cov_in(cov.data());
   EigenMapCovariance6d cov_out(cov_out_.data());
@@ -167,10 +231,7 @@ Covariance6d transform_static_frame(const Covariance6d & cov, const StaticTF tra
       }
     case StaticTF::AIRCRAFT_TO_BASELINK:
     case StaticTF::BASELINK_TO_AIRCRAFT:
-      R.block<3, 3>(0, 0) =
-        R.block<3, 3>(3, 3) = AIRCRAFT_BASELINK_R;
-
-      cov_out = R * cov_in * R.transpose();
+      rotate_covariance_blocks(AIRCRAFT_BASELINK_R, cov_in, cov_out);
       return cov_out_;
 
     default:
@@ -182,7 +243,6 @@ Covariance6d transform_static_frame(const Covariance6d & cov, const StaticTF tra
 Covariance9d transform_static_frame(const Covariance9d & cov, const StaticTF transform)
 {
   Covariance9d cov_out_;
-  Matrix9d R = Matrix9d::Zero();
 
   EigenMapConstCovariance9d cov_in(cov.data());
   EigenMapCovariance9d cov_out(cov_out_.data());
@@ -206,11 +266,7 @@ Covariance9d transform_static_frame(const Covariance9d & cov, const StaticTF tra
       }
     case StaticTF::AIRCRAFT_TO_BASELINK:
     case StaticTF::BASELINK_TO_AIRCRAFT:
-      R.block<3, 3>(0, 0) =
-        R.block<3, 3>(3, 3) =
-        R.block<3, 3>(6, 6) = AIRCRAFT_BASELINK_R;
-
-      cov_out = R * cov_in * R.transpose();
+      rotate_covariance_blocks(AIRCRAFT_BASELINK_R, cov_in, cov_out);
       return cov_out_;
 
     default:
@@ -219,6 +275,39 @@ Covariance9d transform_static_frame(const Covariance9d & cov, const StaticTF tra
   }
 }
 
+void transform_static_frame(
+  Eigen::Vector3d * vecs, const size_t count, const StaticTF transform)
+{
+  // contiguous Vector3d array viewed as a 3xN matrix: one vectorized
+  // product instead of a rotation per point
+  Eigen::Map<Eigen::Matrix<double, 3, Eigen::Dynamic>> m(
+    reinterpret_cast<double *>(vecs), 3, count);
+
+  switch (transform) {
+    case StaticTF::NED_TO_ENU:
+    case StaticTF::ENU_TO_NED:
+      m = NED_ENU_REFLECTION_XY * (NED_ENU_REFLECTION_Z * m);
+      break;
+
+    case StaticTF::AIRCRAFT_TO_BASELINK:
+    case StaticTF::BASELINK_TO_AIRCRAFT:
+      m = AIRCRAFT_BASELINK_R * m;
+      break;
+
+    default:
+      rcpputils::require_true(false, "unsupported transform arg");
+  }
+}
+
+void transform_frame(
+  Eigen::Vector3d * vecs, const size_t count, const Eigen::Quaterniond & q)
+{
+  Eigen::Map<Eigen::Matrix<double, 3, Eigen::Dynamic>> m(
+    reinterpret_cast<double *>(vecs), 3, count);
+
+  m = q.normalized().toRotationMatrix() * m;
+}
+
 Eigen::Vector3d transform_static_frame(
   const Eigen::Vector3d & vec,
   const Eigen::Vector3d & map_origin,
@@ -286,31 +375,26 @@ Covariance3d transform_frame(const Covariance3d & cov, const Eigen::Quaterniond
 Covariance6d transform_frame(const Covariance6d & cov, const Eigen::Quaterniond & q)
 {
   Covariance6d cov_out_;
-  Matrix6d R = Matrix6d::Zero();
 
   EigenMapConstCovariance6d cov_in(cov.data());
   EigenMapCovariance6d cov_out(cov_out_.data());
 
-  R.block<3, 3>(0, 0) =
-    R.block<3, 3>(3, 3) = q.normalized().toRotationMatrix();
+  const Eigen::Matrix3d R = q.normalized().toRotationMatrix();
 
-  cov_out = R * cov_in * R.transpose();
+  rotate_covariance_blocks(R, cov_in, cov_out);
   return cov_out_;
 }
 
 Covariance9d transform_frame(const Covariance9d & cov, const Eigen::Quaterniond & q)
 {
   Covariance9d cov_out_;
-  Matrix9d R = Matrix9d::Zero();
 
   EigenMapConstCovariance9d cov_in(cov.data());
   EigenMapCovariance9d cov_out(cov_out_.data());
 
-  R.block<3, 3>(0, 0) =
-    R.block<3, 3>(3, 3) =
-    R.block<3, 3>(6, 6) = q.normalized().toRotationMatrix();
+  const Eigen::Matrix3d R = q.normalized().toRotationMatrix();
 
-  cov_out = R * cov_in * R.transpose();
+  rotate_covariance_blocks(R, cov_in, cov_out);
   return cov_out_;
 }
 
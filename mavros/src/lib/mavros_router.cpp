@@ -11,12 +11,15 @@
  * @author Vladimir Ermakov <vooon341@gmail.com>
  */
 
+#include <cstring>
+#include <random>
 #include <memory>
 #include <vector>
 #include <string>
 #include <set>
 #include <utility>
 
+#include "mavconn/thread_utils.hpp"
 #include "mavros/mavros_router.hpp"
 #include "rcpputils/asserts.hpp"
 
@@ -27,6 +30,7 @@ using unique_lock = std::unique_lock<std::shared_timed_mutex>;
 using shared_lock = std::shared_lock<std::shared_timed_mutex>;
 
 std::atomic<id_t> Router::id_counter {1000};
+thread_local uint64_t Router::current_rx_stamp_ns {0};
 
 static inline uint8_t get_msg_byte(const mavlink_message_t * msg, uint8_t offset)
 {
@@ -35,10 +39,15 @@ static inline uint8_t get_msg_byte(const mavlink_message_t * msg, uint8_t offset
 
 void Router::route_message(
   Endpoint::SharedPtr src, const mavlink_message_t * msg,
-  const Framing framing)
+  const Framing framing, const uint8_t * frame, const size_t frame_len)
 {
-  shared_lock lock(mu);
   this->stat_msg_routed++;
+  current_rx_stamp_ns = src->rx_stamp_ns.load(std::memory_order_relaxed);
+
+  if (source_dedup_enabled && is_duplicate(msg)) {
+    // second copy over a redundant link: plugins see it once
+    return;
+  }
 
   // find message destination target
   addr_t target_addr = 0;
@@ -52,49 +61,194 @@ void Router::route_message(
     }
   }
 
-  size_t sent_cnt = 0, retry_cnt = 0;
-retry:
-  for (auto & kv : this->endpoints) {
-    auto & dest = kv.second;
+  // lazily refresh the addr index; a concurrent router thread that
+  // lost the exchange may still read the previous snapshot, which at
+  // worst falls back to the broadcast list below. Routing itself
+  // runs on the copy-on-write snapshot, without holding mu.
+  if (this->addr_index_dirty.exchange(false)) {
+    shared_lock lock(mu);
+    rebuild_addr_index();
+  }
+  auto index = std::atomic_load(&this->addr_index);
 
-    if (src->id == dest->id) {
-      continue;     // do not echo message
-    }
-    if (src->link_type == dest->link_type) {
-      continue;     // drop messages between same type FCU/GCS/UAS
-    }
+  size_t sent_cnt = 0;
+  auto send_via = [&](addr_t addr) {
+      auto it = index->find(addr);
+      if (it == index->end()) {
+        return;
+      }
 
-    // NOTE(vooon): current router do not allow to speak drone-to-drone.
-    //              if it is needed perhaps better to add mavlink-router in front of mavros-router.
+      for (auto & dest : it->second) {
+        if (src->id == dest->id) {
+          continue;   // do not echo message
+        }
+        if (src->link_type == dest->link_type) {
+          continue;   // drop messages between same type FCU/GCS/UAS
+        }
 
-    bool has_target = dest->remote_addrs.find(target_addr) != dest->remote_addrs.end();
+        // NOTE(vooon): current router do not allow to speak drone-to-drone.
+        //              if it is needed perhaps better to add mavlink-router
+        //              in front of mavros-router.
 
-    if (has_target) {
-      dest->send_message(msg, framing, src->id);
-      sent_cnt++;
-    }
-  }
+        if (frame != nullptr) {
+          dest->send_frame(frame, frame_len, msg, framing, src->id);
+        } else {
+          dest->send_message(msg, framing, src->id);
+        }
+        sent_cnt++;
+      }
+    };
+
+  send_via(target_addr);
 
   // if message haven't been sent retry broadcast it
-  if (sent_cnt == 0 && retry_cnt < 2) {
-    target_addr = 0;
-    retry_cnt++;
-    goto retry;
+  if (sent_cnt == 0 && target_addr != 0) {
+    send_via(0);
   }
 
   // update stats
   this->stat_msg_sent.fetch_add(sent_cnt);
   if (sent_cnt == 0) {
+    // single relaxed increment: even the throttled-log clock read
+    // and lock are too much at GCS-disconnect drop rates. Counters
+    // surface through diag_run() and the periodic drop summary.
+    this->stat_msg_dropped.fetch_add(1, std::memory_order_relaxed);
+
+    if (msg->msgid < this->drop_by_msgid.size()) {
+      this->drop_by_msgid[msg->msgid].fetch_add(1, std::memory_order_relaxed);
+    } else {
+      this->drop_other.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+}
+
+void Router::rebuild_addr_index()
+{
+  auto lg = get_logger();
+  const uint64_t gen_now = this->addr_generation.load();
+  auto index = std::make_shared<AddrIndex>();
+
+  for (auto & kv : this->endpoints) {
+    auto & ep = kv.second;
+
+    std::lock_guard<std::mutex> lock(ep->addr_mu);
+    for (auto it = ep->remote_addrs.begin(); it != ep->remote_addrs.end(); ) {
+      // lazy expiry: no traffic for ADDR_STALE_GENERATIONS sweeps
+      if (it->first != 0 && gen_now - it->second >= Endpoint::ADDR_STALE_GENERATIONS) {
+        RCLCPP_INFO(
+          lg, "link[%d] removed stale remote address %d.%d", ep->id,
+          it->first >> 8, it->first & 0xff);
+        it = ep->remote_addrs.erase(it);
+        continue;
+      }
+
+      (*index)[it->first].push_back(ep);
+      ++it;
+    }
+  }
+
+  std::atomic_store(&this->addr_index, std::shared_ptr<const AddrIndex>(index));
+}
+
+bool Router::enqueue_for_routing(
+  Endpoint::SharedPtr src, const mavlink_message_t * msg,
+  const Framing framing, const uint8_t * frame, const size_t frame_len)
+{
+  if (!workers_running) {
+    return false;
+  }
+
+  Endpoint::RxItem item;
+  item.msg = *msg;
+  item.framing = framing;
+  item.rx_stamp_ns = src->rx_stamp_ns.load(std::memory_order_relaxed);
+  item.frame_len = 0;
+  if (frame != nullptr && frame_len <= sizeof(item.frame)) {
+    std::memcpy(item.frame, frame, frame_len);
+    item.frame_len = frame_len;
+  }
+
+  if (!src->rx_ring.push(std::move(item))) {
+    // a congested pipeline must not back-pressure the link
     this->stat_msg_dropped++;
+    return true;
+  }
+
+  this->rx_pending.fetch_add(1);
+  this->worker_cv.notify_one();
+  return true;
+}
+
+void Router::start_workers(size_t count)
+{
+  workers_running = true;
+
+  for (size_t i = 0; i < count; i++) {
+    worker_threads.emplace_back(
+      [this, i]() {
+        mavconn::utils::set_this_thread_name("mrouter%zu", i);
+        worker_loop();
+      });
+  }
+
+  RCLCPP_INFO(get_logger(), "Routing worker pool started: %zu threads", count);
+}
+
+void Router::stop_workers()
+{
+  if (!workers_running.exchange(false)) {
+    return;
+  }
+
+  worker_cv.notify_all();
+  for (auto & thd : worker_threads) {
+    if (thd.joinable()) {
+      thd.join();
+    }
+  }
+
+  worker_threads.clear();
+}
+
+void Router::worker_loop()
+{
+  while (workers_running) {
+    {
+      std::unique_lock<std::mutex> lk(worker_mu);
+      worker_cv.wait_for(
+        lk, 100ms,
+        [this]() {return !workers_running || rx_pending > 0;});
+    }
+    if (!workers_running) {
+      return;
+    }
+
+    // RCU-style endpoint snapshot: routing never holds mu
+    std::vector<Endpoint::SharedPtr> eps;
+    {
+      shared_lock lock(mu);
+      eps.reserve(this->endpoints.size());
+      for (auto & kv : this->endpoints) {
+        eps.push_back(kv.second);
+      }
+    }
+
+    for (auto & ep : eps) {
+      if (ep->rx_claimed.exchange(true)) {
+        continue;   // another worker drains this source
+      }
 
-    auto lg = get_logger();
-    auto clock = get_clock();
+      while (auto * item = ep->rx_ring.front()) {
+        ep->rx_stamp_ns.store(item->rx_stamp_ns, std::memory_order_relaxed);
+        route_message(
+          ep, &item->msg, item->framing,
+          (item->frame_len > 0) ? item->frame : nullptr, item->frame_len);
+        ep->rx_ring.pop();
+        this->rx_pending.fetch_sub(1);
+      }
 
-    RCLCPP_WARN_THROTTLE(
-      lg,
-      *clock, 10000, "Message dropped: msgid: %d, source: %d.%d, target: %d.%d", msg->msgid,
-      msg->sysid, msg->compid, target_addr >> 8,
-      target_addr & 0xff);
+      ep->rx_claimed = false;
+    }
   }
 }
 
@@ -134,6 +288,7 @@ void Router::add_endpoint(
   ep->url = request->url;
 
   this->endpoints[id] = ep;
+  this->addr_index_dirty = true;
   this->diagnostic_updater.add(ep->diag_name(), std::bind(&Endpoint::diag_run, ep, _1));
   RCLCPP_INFO(lg, "Endpoint link[%d] created", id);
 
@@ -163,6 +318,7 @@ void Router::del_endpoint(
       it->second->close();
       this->diagnostic_updater.removeByName(it->second->diag_name());
       this->endpoints.erase(it);
+      this->addr_index_dirty = true;
       response->successful = true;
     }
     return;
@@ -178,6 +334,7 @@ void Router::del_endpoint(
       it->second->close();
       this->diagnostic_updater.removeByName(it->second->diag_name());
       this->endpoints.erase(it);
+      this->addr_index_dirty = true;
       response->successful = true;
       return;
     }
@@ -264,57 +421,67 @@ rcl_interfaces::msg::SetParametersResult Router::on_set_parameters_cb(
   return result;
 }
 
-void Router::periodic_reconnect_endpoints()
+void Router::reconnect_loop()
 {
-  shared_lock lock(mu);
-  auto lg = get_logger();
+  mavconn::utils::set_this_thread_name("mr-reconnect");
 
-  RCLCPP_DEBUG(lg, "start reconnecting...");
+  auto lg = get_logger();
+  std::minstd_rand rng(std::random_device{}());
 
-  for (auto & kv : this->endpoints) {
-    auto & p = kv.second;
+  while (!reconnect_exit) {
+    std::this_thread::sleep_for(1s);
+    if (reconnect_exit) {
+      return;
+    }
 
-    if (p->is_open()) {
-      continue;
+    // snapshot under the shared lock; the (potentially slow) opens
+    // run with no router lock held at all
+    std::vector<Endpoint::SharedPtr> closed;
+    {
+      shared_lock lock(mu);
+      for (auto & kv : this->endpoints) {
+        if (!kv.second->is_open()) {
+          closed.push_back(kv.second);
+        }
+      }
     }
 
-    RCLCPP_INFO(lg, "link[%d] trying to reconnect...", p->id);
-    auto result = p->open();
+    const auto now = std::chrono::steady_clock::now();
 
-    if (result.first) {
-      RCLCPP_INFO(lg, "link[%d] reconnected", p->id);
-    } else {
-      RCLCPP_ERROR(lg, "link[%d] reconnect failed: %s", p->id, result.second.c_str());
-    }
-  }
-}
+    for (auto & ep : closed) {
+      if (now < ep->next_reconnect) {
+        continue;
+      }
 
-void Router::periodic_clear_stale_remote_addrs()
-{
-  unique_lock lock(mu);
-  auto lg = get_logger();
+      RCLCPP_INFO(lg, "link[%d] trying to reconnect...", ep->id);
+      auto result = ep->open();
 
-  RCLCPP_DEBUG(lg, "clear stale remotes");
-  for (auto & kv : this->endpoints) {
-    auto & p = kv.second;
+      if (result.first) {
+        RCLCPP_INFO(lg, "link[%d] reconnected", ep->id);
+        ep->reconnect_backoff = 1s;
+      } else {
+        RCLCPP_ERROR(lg, "link[%d] reconnect failed: %s", ep->id, result.second.c_str());
 
-    // Step 1: remove any stale addrs that still there
-    //         (hadn't been removed by Endpoint::recv_message())
-    for (auto addr : p->stale_addrs) {
-      if (addr != 0) {
-        p->remote_addrs.erase(addr);
-        RCLCPP_INFO(
-          lg, "link[%d] removed stale remote address %d.%d", p->id, addr >> 8,
-          addr & 0xff);
+        // exponential backoff with jitter, capped at one minute
+        ep->reconnect_backoff = std::min<std::chrono::seconds>(
+          ep->reconnect_backoff * 2, 60s);
+        ep->next_reconnect = now + ep->reconnect_backoff +
+          std::chrono::milliseconds(rng() % 1000);
       }
     }
-
-    // Step 2: re-initiate stale_addrs
-    p->stale_addrs.clear();
-    p->stale_addrs.insert(p->remote_addrs.begin(), p->remote_addrs.end());
   }
 }
 
+void Router::periodic_advance_addr_generation()
+{
+  // no locks taken: stale addrs expire lazily during the next
+  // addr index rebuild on the routing path
+  RCLCPP_DEBUG(get_logger(), "advance remote addr generation");
+
+  this->addr_generation.fetch_add(1);
+  this->addr_index_dirty = true;
+}
+
 void Router::diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   auto endpoints_len = [this]() -> auto {
@@ -327,6 +494,30 @@ void Router::diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat)
   stat.addf("Messages sent", "%zu", stat_msg_sent.load());
   stat.addf("Messages dropped", "%zu", stat_msg_dropped.load());
 
+  // top dropped msgids since start
+  for (int rank = 0; rank < 3; rank++) {
+    uint32_t best = 0;
+    size_t best_id = 0;
+    for (size_t id = 0; id < drop_by_msgid.size(); id++) {
+      const uint32_t cnt = drop_by_msgid[id].load(std::memory_order_relaxed);
+      bool taken = false;
+      for (int r = 0; r < rank; r++) {
+        if (top_dropped_ids[r] == id) {
+          taken = true;
+        }
+      }
+      if (!taken && cnt > best) {
+        best = cnt;
+        best_id = id;
+      }
+    }
+    if (best == 0) {
+      break;
+    }
+    top_dropped_ids[rank] = best_id;
+    stat.addf(utils::format("Dropped msgid [%d]", rank), "%zu: %u", best_id, best);
+  }
+
   if (endpoints_len < 2) {
     stat.summary(2, "not enough endpoints");
   } else {
@@ -335,6 +526,13 @@ void Router::diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat)
 }
 
 void Endpoint::recv_message(const mavlink_message_t * msg, const Framing framing)
+{
+  recv_message(msg, framing, nullptr, 0);
+}
+
+void Endpoint::recv_message(
+  const mavlink_message_t * msg, const Framing framing,
+  const uint8_t * frame, const size_t frame_len)
 {
   rcpputils::assert_true(msg, "msg not nullptr");
   // rcpputils::assert_true(this->parent, "parent not nullptr");
@@ -342,22 +540,31 @@ void Endpoint::recv_message(const mavlink_message_t * msg, const Framing framing
   const addr_t sysid_addr = msg->sysid << 8;
   const addr_t sysid_compid_addr = (msg->sysid << 8) | msg->compid;
 
-  // save source addr to remote_addrs
-  auto sp = this->remote_addrs.emplace(sysid_addr);
-  auto scp = this->remote_addrs.emplace(sysid_compid_addr);
-
-  // and delete it from stale_addrs
-  this->stale_addrs.erase(sysid_addr);
-  this->stale_addrs.erase(sysid_compid_addr);
-
   auto & nh = this->parent;
-  if (sp.second || scp.second) {
+  const uint64_t gen = nh->addr_generation.load();
+
+  // save source addr to remote_addrs, stamping the current generation
+  bool new_addr = false;
+  {
+    std::lock_guard<std::mutex> lock(this->addr_mu);
+
+    auto sp = this->remote_addrs.emplace(sysid_addr, gen);
+    auto scp = this->remote_addrs.emplace(sysid_compid_addr, gen);
+    sp.first->second = gen;
+    scp.first->second = gen;
+    new_addr = sp.second || scp.second;
+  }
+
+  if (new_addr) {
+    nh->addr_index_dirty = true;
     RCLCPP_INFO(
       nh->get_logger(), "link[%d] detected remote address %d.%d", this->id, msg->sysid,
       msg->compid);
   }
 
-  nh->route_message(shared_from_this(), msg, framing);
+  if (!nh->enqueue_for_routing(shared_from_this(), msg, framing, frame, frame_len)) {
+    nh->route_message(shared_from_this(), msg, framing, frame, frame_len);
+  }
 }
 
 std::string Endpoint::diag_name()
@@ -367,27 +574,51 @@ std::string Endpoint::diag_name()
 
 bool MAVConnEndpoint::is_open()
 {
-  if (!this->link) {
+  // NOTE: link is accessed with the shared_ptr atomic ops — routing
+  // runs without the router lock, so a concurrent del_endpoint()
+  // close would otherwise race plain reads (use-after-free)
+  auto link_ = std::atomic_load(&this->link);
+  if (!link_) {
     return false;
   }
 
-  return this->link->is_open();
+  return link_->is_open();
 }
 
 std::pair<bool, std::string> MAVConnEndpoint::open()
 {
   try {
     auto link = mavconn::MAVConnInterface::open_url(this->url);
-    link->message_received_cb =
-      std::bind(&MAVConnEndpoint::recv_message, shared_from_this(), _1, _2);
-    this->link = link;
+    // framed-bytes variant enables verbatim pass-through forwarding
+    auto sthis = std::static_pointer_cast<MAVConnEndpoint>(shared_from_this());
+    link->message_received_bytes_cb =
+      [sthis](const mavlink_message_t * msg, const Framing framing,
+        const uint8_t * frame, const size_t frame_len) {
+        auto link_ = std::atomic_load(&sthis->link);
+        if (link_) {
+          sthis->rx_stamp_ns.store(
+            link_->get_last_rx_stamp_ns(), std::memory_order_relaxed);
+
+          // RADIO_STATUS: feed txbuf into the link Tx shaper
+          // (field at payload offset 6 after wire reordering).
+          // No len check: MAVLink2 zero-truncation may shorten the
+          // payload below 7 bytes exactly when txbuf reads 0 — the
+          // congested case we must not miss — and the parser
+          // zero-fills the truncated tail, so the read is safe.
+          if (msg->msgid == 109 && framing == Framing::ok) {
+            link_->update_flow_control(_MAV_PAYLOAD(msg)[6]);
+          }
+        }
+        sthis->recv_message(msg, framing, frame, frame_len);
+      };
+    std::atomic_store(&this->link, link);
   } catch (mavconn::DeviceError & ex) {
     return {false, ex.what()};
   }
 
   // not necessary because router would not serialize mavlink::Message
   // but that is a good default
-  this->link->set_protocol_version(mavconn::Protocol::V20);
+  std::atomic_load(&this->link)->set_protocol_version(mavconn::Protocol::V20);
 
   // TODO(vooon): message signing?
 
@@ -396,12 +627,14 @@ std::pair<bool, std::string> MAVConnEndpoint::open()
 
 void MAVConnEndpoint::close()
 {
-  if (!this->link) {
+  // detach first: senders that already loaded the pointer finish on
+  // their own copy, everyone after sees the endpoint closed
+  auto link_ = std::atomic_exchange(&this->link, mavconn::MAVConnInterface::Ptr());
+  if (!link_) {
     return;
   }
 
-  this->link->close();
-  this->link.reset();
+  link_->close();
 }
 
 void MAVConnEndpoint::send_message(
@@ -410,22 +643,48 @@ void MAVConnEndpoint::send_message(
 {
   (void)framing;
 
-  if (!this->link) {
+  auto link_ = std::atomic_load(&this->link);
+  if (!link_) {
+    return;
+  }
+
+  link_->send_message_ignore_drop(msg);
+}
+
+void MAVConnEndpoint::send_frame(
+  const uint8_t * frame, const size_t frame_len,
+  const mavlink_message_t * msg, const Framing framing, id_t src_id)
+{
+  (void)framing;
+  (void)src_id;
+
+  auto link_ = std::atomic_load(&this->link);
+  if (!link_) {
     return;
   }
 
-  this->link->send_message_ignore_drop(msg);
+  (void)msg;
+
+  try {
+    link_->send_bytes(frame, frame_len);
+  } catch (std::length_error & e) {
+    // same drop semantics as send_message_ignore_drop()
+    if (auto & nh = this->parent) {
+      RCLCPP_ERROR(nh->get_logger(), "link[%d] DROPPED frame: %s", this->id, e.what());
+    }
+  }
 }
 
 void MAVConnEndpoint::diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
-  if (!this->link) {
+  auto link_ = std::atomic_load(&this->link);
+  if (!link_) {
     stat.summary(2, "closed");
     return;
   }
 
-  auto mav_status = this->link->get_status();
-  auto iostat = this->link->get_iostat();
+  auto mav_status = link_->get_status();
+  auto iostat = link_->get_iostat();
 
   stat.addf("Received packets", "%u", mav_status.packet_rx_success_count);
   stat.addf("Dropped packets", "%u", mav_status.packet_rx_drop_count);
@@ -439,10 +698,13 @@ void MAVConnEndpoint::diag_run(diagnostic_updater::DiagnosticStatusWrapper & sta
   stat.addf("Rx speed", "%f", iostat.rx_speed);
   stat.addf("Tx speed", "%f", iostat.tx_speed);
 
-  stat.addf("Remotes count", "%zu", this->remote_addrs.size());
-  size_t idx = 0;
-  for (auto addr : this->remote_addrs) {
-    stat.addf(utils::format("Remote [%d]", idx++), "%d.%d", addr >> 8, addr & 0xff);
+  {
+    std::lock_guard<std::mutex> lock(this->addr_mu);
+    stat.addf("Remotes count", "%zu", this->remote_addrs.size());
+    size_t idx = 0;
+    for (auto & kv : this->remote_addrs) {
+      stat.addf(utils::format("Remote [%d]", idx++), "%d.%d", kv.first >> 8, kv.first & 0xff);
+    }
   }
 
   if (mav_status.packet_rx_drop_count > stat_last_drop_count) {
@@ -471,14 +733,40 @@ std::pair<bool, std::string> ROSEndpoint::open()
   try {
     auto qos = QoS(
       1000).best_effort().durability_volatile();
+
+    // single-process composition: the UAS handoff becomes a pointer
+    // move instead of a DDS round trip
+    rclcpp::PublisherOptions pub_options;
+    pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+    rclcpp::SubscriptionOptions sub_options;
+    sub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+
     this->source =
       nh->create_publisher<mavros_msgs::msg::Mavlink>(
       utils::format(
         "%s/%s", this->url.c_str(),
-        "mavlink_source"), qos);
+        "mavlink_source"), qos, pub_options);
     this->sink = nh->create_subscription<mavros_msgs::msg::Mavlink>(
       utils::format("%s/%s", this->url.c_str(), "mavlink_sink"), qos,
-      std::bind(&ROSEndpoint::ros_recv_message, this, _1));
+      std::bind(&ROSEndpoint::ros_recv_message, this, _1), sub_options);
+
+    if (nh->get_parameter("uas_zero_copy").as_bool()) {
+      // fixed arrays make the sample POD-sized: eligible for loaned
+      // messages on shm-capable transports
+      this->fixed_source = nh->create_publisher<mavros_msgs::msg::MavlinkFixed>(
+        utils::format("%s/%s", this->url.c_str(), "mavlink_source_fixed"), qos, pub_options);
+    }
+
+    this->batch_max_size = nh->get_parameter("uas_batch_size").as_int();
+    if (this->batch_max_size > 0) {
+      auto window_us = nh->get_parameter("uas_batch_window_us").as_int();
+
+      this->batch_source = nh->create_publisher<mavros_msgs::msg::MavlinkBatch>(
+        utils::format("%s/%s", this->url.c_str(), "mavlink_source_batch"), qos, pub_options);
+      this->batch_timer = nh->create_wall_timer(
+        std::chrono::microseconds(window_us),
+        std::bind(&ROSEndpoint::flush_batch, this));
+    }
   } catch (rclcpp::exceptions::InvalidTopicNameError & ex) {
     return {false, ex.what()};
   }
@@ -488,6 +776,9 @@ std::pair<bool, std::string> ROSEndpoint::open()
 
 void ROSEndpoint::close()
 {
+  this->batch_timer.reset();
+  this->batch_source.reset();
+  this->fixed_source.reset();
   this->source.reset();
   this->sink.reset();
 }
@@ -496,6 +787,25 @@ void ROSEndpoint::send_message(const mavlink_message_t * msg, const Framing fram
 {
   rcpputils::assert_true(msg, "msg not null");
 
+  if (this->fixed_source) {
+    // uas_zero_copy REPLACES the per-endpoint Mavlink publication:
+    // mavlink_source stays silent while mavlink_source_fixed is up
+    // (publishing both would route every message twice in the UAS).
+    // Skipping the dynamic conversion below is the point — it is
+    // the allocation this mode exists to avoid.
+    mavros_msgs::msg::MavlinkFixed fmsg{};
+    if (mavros_msgs::mavlink::convert(*msg, fmsg, utils::enum_value(framing))) {
+      if (this->fixed_source->can_loan_messages()) {
+        auto loaned = this->fixed_source->borrow_loaned_message();
+        loaned.get() = fmsg;
+        this->fixed_source->publish(std::move(loaned));
+      } else {
+        this->fixed_source->publish(fmsg);
+      }
+    }
+    return;
+  }
+
   auto rmsg = mavros_msgs::msg::Mavlink();
   auto ok = mavros_msgs::mavlink::convert(*msg, rmsg, utils::enum_value(framing));
 
@@ -504,14 +814,52 @@ void ROSEndpoint::send_message(const mavlink_message_t * msg, const Framing fram
     return;
   }
 
-  rmsg.header.stamp = this->parent->now();
+  // prefer the source link's kernel receive stamp: it is free of
+  // userspace scheduling jitter (see MAVConnInterface rx timestamps)
+  const auto rx_stamp_ns = Router::current_rx_stamp_ns;
+  if (rx_stamp_ns != 0) {
+    rmsg.header.stamp = rclcpp::Time(rx_stamp_ns);
+  } else {
+    rmsg.header.stamp = this->parent->now();
+  }
   rmsg.header.frame_id = utils::format("ep:%d", src_id);
 
-  if (ok) {
-    this->source->publish(rmsg);
-  } else if (auto & nh = this->parent) {
-    RCLCPP_ERROR(nh->get_logger(), "message conversion error");
+  if (!ok) {
+    if (auto & nh = this->parent) {
+      RCLCPP_ERROR(nh->get_logger(), "message conversion error");
+    }
+    return;
+  }
+
+  if (this->batch_source) {
+    std::lock_guard<std::mutex> lock(this->batch_mu);
+
+    this->batch.messages.push_back(std::move(rmsg));
+    if (this->batch.messages.size() >= this->batch_max_size) {
+      flush_batch_locked();
+    }
+    return;
+  }
+
+  this->source->publish(rmsg);
+}
+
+void ROSEndpoint::flush_batch()
+{
+  std::lock_guard<std::mutex> lock(this->batch_mu);
+  flush_batch_locked();
+}
+
+void ROSEndpoint::flush_batch_locked()
+{
+  if (this->batch.messages.empty() || !this->batch_source) {
+    return;
   }
+
+  this->batch.header.stamp = this->parent->now();
+  this->batch.header.frame_id = this->url;
+  this->batch_source->publish(this->batch);
+  this->batch.messages.clear();
 }
 
 void ROSEndpoint::ros_recv_message(const mavros_msgs::msg::Mavlink::SharedPtr rmsg)
@@ -534,10 +882,13 @@ void ROSEndpoint::diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   // TODO(vooon): make some diagnostics
 
-  stat.addf("Remotes count", "%zu", this->remote_addrs.size());
-  size_t idx = 0;
-  for (auto addr : this->remote_addrs) {
-    stat.addf(utils::format("Remote [%d]", idx++), "%d.%d", addr >> 8, addr & 0xff);
+  {
+    std::lock_guard<std::mutex> lock(this->addr_mu);
+    stat.addf("Remotes count", "%zu", this->remote_addrs.size());
+    size_t idx = 0;
+    for (auto & kv : this->remote_addrs) {
+      stat.addf(utils::format("Remote [%d]", idx++), "%d.%d", kv.first >> 8, kv.first & 0xff);
+    }
   }
 
   if (this->is_open()) {
@@ -12,7 +12,11 @@
  */
 
 #include <fnmatch.h>
+#include <malloc.h>
+#include <unistd.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <Eigen/Eigen>  // NOLINT
@@ -31,6 +35,8 @@ using plugin::Plugin;
 using plugin::PluginFactory;
 using utils::enum_value;
 
+static bool pattern_match(const std::string & pattern, const std::string & pl_name);
+
 UAS::UAS(
   const rclcpp::NodeOptions & options_,
   const std::string & name_,
@@ -76,6 +82,14 @@ UAS::UAS(
   this->declare_parameter("target_component_id", target_component);
   this->declare_parameter("plugin_allowlist", plugin_allowlist);
   this->declare_parameter("plugin_denylist", plugin_denylist);
+  // lazy load: only the eager allowlist is instantiated before the
+  // link comes up, the rest is spread over the lazy-load timer
+  this->declare_parameter("plugin_lazy_load", false);
+  // per-child-frame dynamic TF rate cap used by send_transform()
+  this->declare_parameter("tf_rate_limit", 0.0);
+  this->declare_parameter(
+    "plugin_eager_allowlist",
+    std::vector<std::string>{"*sys_status*", "*sys_time*", "*heartbeat*", "*command*"});
 
   // NOTE(vooon): we couldn't add_plugin() in constructor because it needs shared_from_this()
   startup_delay_timer = this->create_wall_timer(
@@ -111,6 +125,24 @@ UAS::UAS(
       // setup diag
       diagnostic_updater.setHardwareID(utils::format("uas://%s", uas_url.c_str()));
       diagnostic_updater.add("MAVROS UAS", this, &UAS::diag_run);
+      diagnostic_updater.add("UAS Latency", this, &UAS::diag_run_latency);
+
+      // opt-in memory instrumentation for soak attribution
+      this->declare_parameter("enable_memory_diag", false);
+      if (this->get_parameter("enable_memory_diag").as_bool()) {
+        diagnostic_updater.add("UAS Memory", this, &UAS::diag_run_memory);
+        dump_memory_stats_srv = this->create_service<std_srvs::srv::Trigger>(
+          "~/dump_memory_stats",
+          std::bind(
+            &UAS::dump_memory_stats_cb, this, std::placeholders::_1,
+            std::placeholders::_2));
+      }
+
+      get_latency_stats_srv = this->create_service<mavros_msgs::srv::GetLatencyStats>(
+        "~/get_latency_stats",
+        std::bind(
+          &UAS::get_latency_stats_cb, this, std::placeholders::_1,
+          std::placeholders::_2));
 
       // setup uas link
       if (fcu_protocol == "v1.0") {
@@ -138,11 +170,52 @@ UAS::UAS(
       if (plugin_denylist.empty() && !plugin_allowlist.empty()) {
         plugin_denylist.emplace_back("*");
       }
+      plugin_matcher.compile(plugin_denylist, plugin_allowlist);
+
+      bool lazy_load = false;
+      std::vector<std::string> eager_allowlist{};
+      this->get_parameter("plugin_lazy_load", lazy_load);
+      this->get_parameter("plugin_eager_allowlist", eager_allowlist);
+
+      auto is_eager = [&eager_allowlist](const std::string & name) {
+          for (auto & pattern : eager_allowlist) {
+            if (pattern_match(pattern, name)) {
+              return true;
+            }
+          }
+          return false;
+        };
 
       for (auto & name : plugin_factory_loader.getDeclaredClasses()) {
+        if (lazy_load && !is_eager(name)) {
+          deferred_plugin_names.push_back(name);
+          continue;
+        }
+
         add_plugin(name);
       }
 
+      if (!deferred_plugin_names.empty()) {
+        RCLCPP_INFO(
+          get_logger(), "Lazy load: %zu plugins deferred",
+          deferred_plugin_names.size());
+
+        // one plugin per tick: dozens of parameter/publisher/service
+        // declarations per plugin no longer block failsafe readiness
+        lazy_load_timer = this->create_wall_timer(
+          200ms, [this]() {
+            if (deferred_plugin_names.empty()) {
+              lazy_load_timer->cancel();
+              RCLCPP_INFO(get_logger(), "Lazy load: all plugins initialized");
+              return;
+            }
+
+            auto name = deferred_plugin_names.front();
+            deferred_plugin_names.erase(deferred_plugin_names.begin());
+            add_plugin(name);
+          });
+      }
+
       connect_to_router();
 
       // Publish helper TFs used for frame transformation in the odometry plugin
@@ -187,14 +260,79 @@ UAS::UAS(
 
 void UAS::plugin_route(const mavlink_message_t * mmsg, const Framing framing)
 {
-  auto it = plugin_subscriptions.find(mmsg->msgid);
-  if (it == plugin_subscriptions.end()) {
+  // immutable snapshot: safe against concurrent add_plugin() rebuilds
+  auto dispatch = std::atomic_load(&plugin_dispatch);
+  if (!dispatch) {
     return;
   }
 
-  for (auto & info : it->second) {
+  const plugin::Plugin::Subscriptions * subs = nullptr;
+
+  if (mmsg->msgid < dispatch->v1.size()) {
+    subs = dispatch->v1[mmsg->msgid];
+  } else {
+    auto it = std::lower_bound(
+      dispatch->ext.begin(), dispatch->ext.end(), mmsg->msgid,
+      [](const auto & entry, mavlink::msgid_t msgid) {return entry.first < msgid;});
+    if (it != dispatch->ext.end() && it->first == mmsg->msgid) {
+      subs = it->second;
+    }
+  }
+
+  if (subs == nullptr) {
+    return;
+  }
+
+  for (auto & info : *subs) {
     std::get<3>(info)(mmsg, framing);
   }
+
+  // wire-arrival to handler-completion latency, per msgid
+  const uint64_t rx_ns = last_message_stamp_ns;
+  if (rx_ns != 0) {
+    auto it = dispatch->latency.find(mmsg->msgid);
+    if (it != dispatch->latency.end()) {
+      const int64_t lat_ns = this->now().nanoseconds() - static_cast<int64_t>(rx_ns);
+      if (lat_ns > 0) {
+        it->second->record(lat_ns / 1000);
+      }
+    }
+  }
+}
+
+void UAS::rebuild_plugin_dispatch()
+{
+  auto prev = std::atomic_load(&plugin_dispatch);
+  auto next = std::make_shared<PluginDispatch>();
+
+  // snapshot owns its subscription copy; v1/ext point into it
+  next->subscriptions = plugin_subscriptions;
+
+  for (auto & kv : next->subscriptions) {
+    if (kv.first < next->v1.size()) {
+      next->v1[kv.first] = &kv.second;
+    } else {
+      next->ext.emplace_back(kv.first, &kv.second);
+    }
+  }
+
+  std::sort(
+    next->ext.begin(), next->ext.end(),
+    [](const auto & lhs, const auto & rhs) {return lhs.first < rhs.first;});
+
+  // carry the histograms forward so statistics persist across loads
+  if (prev) {
+    next->latency = prev->latency;
+  }
+  for (auto & kv : next->subscriptions) {
+    auto it = next->latency.find(kv.first);
+    if (it == next->latency.end()) {
+      next->latency.emplace(kv.first, std::make_shared<mavconn::LatencyHistogram>());
+    }
+  }
+
+  std::atomic_store(
+    &plugin_dispatch, std::shared_ptr<const PluginDispatch>(next));
 }
 
 static bool pattern_match(const std::string & pattern, const std::string & pl_name)
@@ -222,19 +360,8 @@ static bool pattern_match(const std::string & pattern, const std::string & pl_na
 bool UAS::is_plugin_allowed(
   const std::string & pl_name)
 {
-  for (auto & bl_pattern : plugin_denylist) {
-    if (pattern_match(bl_pattern, pl_name)) {
-      for (auto & wl_pattern : plugin_allowlist) {
-        if (pattern_match(wl_pattern, pl_name)) {
-          return true;
-        }
-      }
-
-      return false;
-    }
-  }
-
-  return true;
+  // patterns are compiled once at startup, verdicts are cached
+  return plugin_matcher.is_allowed(pl_name);
 }
 
 inline bool is_mavlink_message_t(const size_t rt)
@@ -314,6 +441,7 @@ void UAS::add_plugin(const std::string & pl_name)
       }
     }
 
+    rebuild_plugin_dispatch();
     loaded_plugins.push_back(plugin);
 
     auto pl_node = plugin->get_node();
@@ -355,15 +483,30 @@ void UAS::connect_to_router()
   auto qos = rclcpp::QoS(
     1000).best_effort().durability_volatile();
 
+  // intra-process handoff when composed with the router in one
+  // process (see mavros_node)
+  rclcpp::PublisherOptions pub_options;
+  pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  rclcpp::SubscriptionOptions sub_options;
+  sub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+
   this->sink =
     this->create_publisher<mavros_msgs::msg::Mavlink>(
     utils::format(
       "%s/%s", this->uas_url.c_str(),
-      "mavlink_sink"), qos);
+      "mavlink_sink"), qos, pub_options);
 
   this->source = this->create_subscription<mavros_msgs::msg::Mavlink>(
     utils::format("%s/%s", this->uas_url.c_str(), "mavlink_source"), qos,
-    std::bind(&UAS::recv_message, this, std::placeholders::_1));
+    std::bind(&UAS::recv_message, this, std::placeholders::_1), sub_options);
+
+  this->batch_source = this->create_subscription<mavros_msgs::msg::MavlinkBatch>(
+    utils::format("%s/%s", this->uas_url.c_str(), "mavlink_source_batch"), qos,
+    std::bind(&UAS::recv_batch, this, std::placeholders::_1), sub_options);
+
+  this->fixed_source = this->create_subscription<mavros_msgs::msg::MavlinkFixed>(
+    utils::format("%s/%s", this->uas_url.c_str(), "mavlink_source_fixed"), qos,
+    std::bind(&UAS::recv_fixed, this, std::placeholders::_1), sub_options);
 }
 
 void UAS::recv_message(const mavros_msgs::msg::Mavlink::SharedPtr rmsg)
@@ -373,6 +516,34 @@ void UAS::recv_message(const mavros_msgs::msg::Mavlink::SharedPtr rmsg)
   auto ok = mavros_msgs::mavlink::convert(*rmsg, msg);
   rcpputils::assert_true(ok, "conversion error");
 
+  last_message_stamp_ns = rclcpp::Time(rmsg->header.stamp).nanoseconds();
+
+  if (ok) {
+    plugin_route(&msg, static_cast<mavconn::Framing>(rmsg->framing_status));
+  }
+}
+
+void UAS::recv_batch(const mavros_msgs::msg::MavlinkBatch::SharedPtr bmsg)
+{
+  for (const auto & rmsg : bmsg->messages) {
+    mavlink::mavlink_message_t msg;
+
+    auto ok = mavros_msgs::mavlink::convert(rmsg, msg);
+    rcpputils::assert_true(ok, "conversion error");
+
+    if (ok) {
+      plugin_route(&msg, static_cast<mavconn::Framing>(rmsg.framing_status));
+    }
+  }
+}
+
+void UAS::recv_fixed(const mavros_msgs::msg::MavlinkFixed::SharedPtr rmsg)
+{
+  mavlink::mavlink_message_t msg;
+
+  auto ok = mavros_msgs::mavlink::convert(*rmsg, msg);
+  rcpputils::assert_true(ok, "conversion error");
+
   if (ok) {
     plugin_route(&msg, static_cast<mavconn::Framing>(rmsg->framing_status));
   }
@@ -422,6 +593,135 @@ void UAS::log_connect_change(bool connected)
   }
 }
 
+//! read one numeric field [kB] from /proc/self/status
+static size_t proc_status_kb(const char * field)
+{
+  FILE * f = std::fopen("/proc/self/status", "r");
+  if (f == nullptr) {
+    return 0;
+  }
+
+  char line[128];
+  size_t value = 0;
+  const size_t field_len = std::strlen(field);
+
+  while (std::fgets(line, sizeof(line), f) != nullptr) {
+    if (std::strncmp(line, field, field_len) == 0) {
+      value = std::strtoul(line + field_len + 1, nullptr, 10);
+      break;
+    }
+  }
+
+  std::fclose(f);
+  return value;
+}
+
+void UAS::diag_run_memory(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  // sampled at the 1 Hz diagnostics tick: near-zero steady cost
+  stat.addf("RSS (kB)", "%zu", proc_status_kb("VmRSS:"));
+  stat.addf("Peak RSS (kB)", "%zu", proc_status_kb("VmHWM:"));
+
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+  const auto mi = mallinfo2();
+  stat.addf("Heap arena (kB)", "%zu", mi.arena / 1024);
+  stat.addf("Heap in use (kB)", "%zu", mi.uordblks / 1024);
+  stat.addf("Heap free (kB)", "%zu", mi.fordblks / 1024);
+#endif
+
+  for (size_t tag = 0; tag < utils::AllocCounters::MAX_TAGS; tag++) {
+    auto & c = utils::AllocCounters::of_tag(tag);
+    const uint64_t calls = c.alloc_calls.load(std::memory_order_relaxed);
+    if (calls == 0) {
+      continue;
+    }
+    stat.addf(
+      utils::format("Tag %zu allocs", tag), "%zu calls, %zu kB",
+      size_t(calls), size_t(c.alloc_bytes.load(std::memory_order_relaxed) / 1024));
+  }
+
+  stat.summary(0, "ok");
+}
+
+void UAS::dump_memory_stats_cb(
+  const std_srvs::srv::Trigger::Request::SharedPtr req [[maybe_unused]],
+  std_srvs::srv::Trigger::Response::SharedPtr res)
+{
+  auto path = utils::format("/tmp/mavros_malloc_info_%d.xml", getpid());
+
+  FILE * f = std::fopen(path.c_str(), "w");
+  if (f == nullptr) {
+    res->success = false;
+    res->message = "can't open dump file";
+    return;
+  }
+
+#if defined(__GLIBC__)
+  malloc_info(0, f);
+#endif
+  std::fclose(f);
+
+  res->success = true;
+  res->message = utils::format(
+    "RSS %zu kB, peak %zu kB, allocator state dumped to %s",
+    proc_status_kb("VmRSS:"), proc_status_kb("VmHWM:"), path.c_str());
+}
+
+void UAS::diag_run_latency(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  uint64_t total = 0, max_us = 0;
+  uint64_t sum_us = 0;
+  mavlink::msgid_t worst_id = 0;
+
+  auto dispatch = std::atomic_load(&plugin_dispatch);
+  if (!dispatch) {
+    stat.summary(0, "no handlers loaded yet");
+    return;
+  }
+
+  for (auto & kv : dispatch->latency) {
+    auto snap = kv.second->snapshot();
+
+    total += snap.count;
+    sum_us += snap.sum_us;
+    if (snap.max_us > max_us) {
+      max_us = snap.max_us;
+      worst_id = kv.first;
+    }
+  }
+
+  stat.addf("Samples", "%zu", size_t(total));
+  if (total > 0) {
+    stat.addf("Mean latency (us)", "%zu", size_t(sum_us / total));
+    stat.addf("Max latency (us)", "%zu", size_t(max_us));
+    stat.addf("Max latency msgid", "%u", worst_id);
+  }
+
+  stat.summary(0, "ok");
+}
+
+void UAS::get_latency_stats_cb(
+  const mavros_msgs::srv::GetLatencyStats::Request::SharedPtr req [[maybe_unused]],
+  mavros_msgs::srv::GetLatencyStats::Response::SharedPtr res)
+{
+  auto dispatch = std::atomic_load(&plugin_dispatch);
+  if (!dispatch) {
+    return;
+  }
+
+  for (auto & kv : dispatch->latency) {
+    auto snap = kv.second->snapshot();
+    if (snap.count == 0) {
+      continue;
+    }
+
+    res->msg_ids.push_back(kv.first);
+    res->sample_count.push_back(snap.count);
+    res->mean_us.push_back(snap.sum_us / snap.count);
+    res->max_us.push_back(snap.max_us);
+  }
+}
+
 void UAS::diag_run(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   // TODO(vooon): add some fields
@@ -11,12 +11,19 @@
  * @author Vladimir Ermakov <vooon341@gmail.com>
  */
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "mavros/mavros_uas.hpp"
 #include "mavros/plugin.hpp"
 
 using  mavros::plugin::Plugin;
+using  mavros::plugin::QueuedPlugin;
 
 void Plugin::enable_connection_cb()
 {
@@ -59,8 +66,162 @@ Plugin::SetParametersResult Plugin::node_on_set_parameters_cb(
 
 void Plugin::enable_node_watch_parameters()
 {
+  // idempotent: create_throttled_publisher() may call it too
+  if (node_set_parameters_handle_ptr) {
+    return;
+  }
+
   node_set_parameters_handle_ptr =
     node->add_on_set_parameters_callback(
     std::bind(
       &Plugin::node_on_set_parameters_cb, this, std::placeholders::_1));
 }
+
+/* -*- QueuedPlugin -*- */
+
+struct QueuedPlugin::WorkerState
+{
+  struct Item
+  {
+    mavlink::mavlink_message_t msg;
+    mavconn::Framing framing;
+    std::shared_ptr<Plugin::HandlerCb> cb;
+  };
+
+  //! latest-value-wins slot, one per queued_latest() handler
+  struct LatestSlot
+  {
+    bool pending = false;
+    Item item;
+  };
+
+  std::mutex mu;
+  std::condition_variable cv;
+  std::deque<Item> fifo;
+  std::vector<std::shared_ptr<LatestSlot>> latest_slots;
+  size_t depth;
+  bool running = true;
+  std::thread thread;
+
+  explicit WorkerState(size_t depth_)
+  : depth(depth_)
+  {}
+
+  bool have_work()
+  {
+    if (!fifo.empty()) {
+      return true;
+    }
+    for (auto & slot : latest_slots) {
+      if (slot->pending) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(mu);
+
+    while (running) {
+      cv.wait(lock, [this]() {return !running || have_work();});
+
+      while (running && !fifo.empty()) {
+        auto item = std::move(fifo.front());
+        fifo.pop_front();
+
+        lock.unlock();
+        (*item.cb)(&item.msg, item.framing);
+        lock.lock();
+      }
+
+      for (auto & slot : latest_slots) {
+        if (!running || !slot->pending) {
+          continue;
+        }
+
+        auto item = slot->item;
+        slot->pending = false;
+
+        lock.unlock();
+        (*item.cb)(&item.msg, item.framing);
+        lock.lock();
+      }
+    }
+  }
+};
+
+QueuedPlugin::QueuedPlugin(size_t queue_depth)
+: worker_state(std::make_shared<WorkerState>(queue_depth))
+{
+  auto state = worker_state;
+  worker_state->thread = std::thread([state]() {state->run();});
+}
+
+QueuedPlugin::~QueuedPlugin()
+{
+  stop_worker();
+}
+
+void QueuedPlugin::stop_worker()
+{
+  {
+    std::lock_guard<std::mutex> lock(worker_state->mu);
+    if (!worker_state->running) {
+      return;
+    }
+    worker_state->running = false;
+  }
+
+  worker_state->cv.notify_all();
+  if (worker_state->thread.joinable()) {
+    worker_state->thread.join();
+  }
+}
+
+Plugin::HandlerInfo QueuedPlugin::queued(Plugin::HandlerInfo info)
+{
+  auto state = worker_state;
+  auto cb = std::make_shared<Plugin::HandlerCb>(std::move(std::get<3>(info)));
+
+  std::get<3>(info) =
+    [state, cb](const mavlink::mavlink_message_t * msg, const mavconn::Framing framing) {
+      {
+        std::lock_guard<std::mutex> lock(state->mu);
+        if (state->fifo.size() >= state->depth) {
+          // bounded: a busy worker must not stall the rx thread
+          return;
+        }
+
+        state->fifo.push_back(WorkerState::Item{*msg, framing, cb});
+      }
+      state->cv.notify_one();
+    };
+
+  return info;
+}
+
+Plugin::HandlerInfo QueuedPlugin::queued_latest(Plugin::HandlerInfo info)
+{
+  auto state = worker_state;
+  auto cb = std::make_shared<Plugin::HandlerCb>(std::move(std::get<3>(info)));
+  auto slot = std::make_shared<WorkerState::LatestSlot>();
+
+  {
+    std::lock_guard<std::mutex> lock(state->mu);
+    state->latest_slots.push_back(slot);
+  }
+
+  std::get<3>(info) =
+    [state, cb, slot](const mavlink::mavlink_message_t * msg, const mavconn::Framing framing) {
+      {
+        std::lock_guard<std::mutex> lock(state->mu);
+        slot->item = WorkerState::Item{*msg, framing, cb};
+        slot->pending = true;
+      }
+      state->cv.notify_one();
+    };
+
+  return info;
+}
@@ -36,11 +36,34 @@ void UAS::update_connection_status(bool conn_)
   if (conn_ != connected) {
     connected = conn_;
 
-    s_shared_lock lock(mu);
-
-    // call all change cb's
-    for (auto & cb : connection_cb_vec) {
-      cb(conn_);
+    // Debounced, deferred delivery: a flapping link during handover
+    // used to fan out synchronously to every plugin callback on the
+    // rx thread, triggering N re-request storms per flap. Deliver
+    // the (latest) state once per settle window from a timer
+    // instead; flaps inside the window coalesce into one batched
+    // notification — or none, when the state returns to what the
+    // plugins last saw.
+    conn_event_pending = true;
+
+    if (!conn_event_timer) {
+      conn_event_timer = this->create_wall_timer(
+        std::chrono::milliseconds(CONNECTION_DEBOUNCE_MS),
+        [this]() {
+          if (!conn_event_pending.exchange(false)) {
+            return;
+          }
+
+          const bool state = connected;
+          if (state == conn_event_delivered) {
+            return;     // flap settled back, nothing to tell
+          }
+          conn_event_delivered = state;
+
+          s_shared_lock lock(mu);
+          for (auto & cb : connection_cb_vec) {
+            cb(state);
+          }
+        });
     }
   }
 }
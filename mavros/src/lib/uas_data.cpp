@@ -24,21 +24,19 @@ using namespace mavros::uas;  // NOLINT
 
 std::once_flag Data::init_flag;
 std::shared_ptr<GeographicLib::Geoid> Data::egm96_5;
+std::mutex Data::geoid_mutex;
 
 
 Data::Data()
-:   imu_enu_data{},
-  imu_ned_data{},
-  gps_fix{},
-  gps_eph(NAN),
-  gps_epv(NAN),
-  gps_fix_type(0),
-  gps_satellites_visible(0)
 {
-  auto & nq = imu_ned_data.orientation;
-  auto & eq = imu_enu_data.orientation;
-  auto & nv = imu_ned_data.angular_velocity;
-  auto & ev = imu_enu_data.angular_velocity;
+  auto enu = std::make_shared<sensor_msgs::msg::Imu>();
+  auto ned = std::make_shared<sensor_msgs::msg::Imu>();
+  auto gps = std::make_shared<GpsState>();
+
+  auto & nq = ned->orientation;
+  auto & eq = enu->orientation;
+  auto & nv = ned->angular_velocity;
+  auto & ev = enu->angular_velocity;
 
   nq.w = 1.0, nq.x = nq.y = nq.z = 0.0;
   eq.w = 1.0, eq.x = eq.y = eq.z = 0.0;
@@ -46,12 +44,26 @@ Data::Data()
   nv.x = nv.y = nv.z = 0.0;
   ev.x = ev.y = ev.z = 0.0;
 
-  gps_fix.status.service = sensor_msgs::msg::NavSatStatus::SERVICE_GPS;
-  gps_fix.status.status = sensor_msgs::msg::NavSatStatus::STATUS_NO_FIX;
-  gps_fix.position_covariance.fill(0.0);
-  gps_fix.position_covariance[0] = -1.0;
-  gps_fix.position_covariance_type = sensor_msgs::msg::NavSatFix::COVARIANCE_TYPE_UNKNOWN;
+  gps->eph = NAN;
+  gps->epv = NAN;
+  gps->fix_type = 0;
+  gps->satellites_visible = 0;
+  gps->fix.status.service = sensor_msgs::msg::NavSatStatus::SERVICE_GPS;
+  gps->fix.status.status = sensor_msgs::msg::NavSatStatus::STATUS_NO_FIX;
+  gps->fix.position_covariance.fill(0.0);
+  gps->fix.position_covariance[0] = -1.0;
+  gps->fix.position_covariance_type = sensor_msgs::msg::NavSatFix::COVARIANCE_TYPE_UNKNOWN;
+
+  imu_enu_data = enu;
+  imu_ned_data = ned;
+  gps_data = gps;
+
+  // NOTE: geoid dataset opens lazily on first height conversion,
+  // see lazy_init_geoid()
+}
 
+void Data::lazy_init_geoid()
+{
   std::call_once(init_flag, init_geographiclib);
 }
 
@@ -60,8 +72,16 @@ void Data::init_geographiclib()
   try {
     // Using smallest dataset with 5' grid,
     // From default location,
-    // Use cubic interpolation, Thread safe
-    egm96_5 = std::make_shared<GeographicLib::Geoid>("egm96-5", "", true, true);
+    // Use cubic interpolation.
+    //
+    // threadsafe=false keeps GeographicLib in its on-demand file
+    // mode: evaluations read through the kernel page cache, so the
+    // dataset is paged in lazily and the read-only pages are shared
+    // by every mavros-linked process on the vehicle, instead of each
+    // one loading a private ~24 MiB copy at startup. Concurrent
+    // evaluations are serialized by geoid_mutex (they are rare:
+    // callers cache the separation).
+    egm96_5 = std::make_shared<GeographicLib::Geoid>("egm96-5", "", true, false);
   } catch (const std::exception & e) {
     rcpputils::require_true(
       false, utils::format(
@@ -73,54 +93,53 @@ void Data::init_geographiclib()
 
 /* -*- IMU data -*- */
 
+// NOTE: updates publish a fresh immutable snapshot; readers load the
+// current snapshot atomically and never block the writer.
+
 void Data::update_attitude_imu_enu(const sensor_msgs::msg::Imu & imu)
 {
-  s_unique_lock lock(mu);
-  imu_enu_data = imu;
+  std::atomic_store(
+    &imu_enu_data,
+    std::shared_ptr<const sensor_msgs::msg::Imu>(
+      std::make_shared<sensor_msgs::msg::Imu>(imu)));
 }
 
 void Data::update_attitude_imu_ned(const sensor_msgs::msg::Imu & imu)
 {
-  s_unique_lock lock(mu);
-  imu_ned_data = imu;
+  std::atomic_store(
+    &imu_ned_data,
+    std::shared_ptr<const sensor_msgs::msg::Imu>(
+      std::make_shared<sensor_msgs::msg::Imu>(imu)));
 }
 
 sensor_msgs::msg::Imu Data::get_attitude_imu_enu()
 {
-  s_shared_lock lock(mu);
-  return imu_enu_data;
+  return *std::atomic_load(&imu_enu_data);
 }
 
 sensor_msgs::msg::Imu Data::get_attitude_imu_ned()
 {
-  s_shared_lock lock(mu);
-  return imu_ned_data;
+  return *std::atomic_load(&imu_ned_data);
 }
 
 geometry_msgs::msg::Quaternion Data::get_attitude_orientation_enu()
 {
-  s_shared_lock lock(mu);
-
-  return imu_enu_data.orientation;
+  return std::atomic_load(&imu_enu_data)->orientation;
 }
 
 geometry_msgs::msg::Quaternion Data::get_attitude_orientation_ned()
 {
-  s_shared_lock lock(mu);
-
-  return imu_ned_data.orientation;
+  return std::atomic_load(&imu_ned_data)->orientation;
 }
 
 geometry_msgs::msg::Vector3 Data::get_attitude_angular_velocity_enu()
 {
-  s_shared_lock lock(mu);
-  return imu_enu_data.angular_velocity;
+  return std::atomic_load(&imu_enu_data)->angular_velocity;
 }
 
 geometry_msgs::msg::Vector3 Data::get_attitude_angular_velocity_ned()
 {
-  s_shared_lock lock(mu);
-  return imu_ned_data.angular_velocity;
+  return std::atomic_load(&imu_ned_data)->angular_velocity;
 }
 
 /* -*- GPS data -*- */
@@ -130,29 +149,30 @@ void Data::update_gps_fix_epts(
   float eph, float epv,
   int fix_type, int satellites_visible)
 {
-  s_unique_lock lock(mu);
+  auto gps = std::make_shared<GpsState>();
+
+  gps->fix = fix;
+  gps->eph = eph;
+  gps->epv = epv;
+  gps->fix_type = fix_type;
+  gps->satellites_visible = satellites_visible;
 
-  gps_fix = fix;
-  gps_eph = eph;
-  gps_epv = epv;
-  gps_fix_type = fix_type;
-  gps_satellites_visible = satellites_visible;
+  std::atomic_store(&gps_data, std::shared_ptr<const GpsState>(gps));
 }
 
 //! Returns EPH, EPV, Fix type and satellites visible
 void Data::get_gps_epts(float & eph, float & epv, int & fix_type, int & satellites_visible)
 {
-  s_shared_lock lock(mu);
+  auto gps = std::atomic_load(&gps_data);
 
-  eph = gps_eph;
-  epv = gps_epv;
-  fix_type = gps_fix_type;
-  satellites_visible = gps_satellites_visible;
+  eph = gps->eph;
+  epv = gps->epv;
+  fix_type = gps->fix_type;
+  satellites_visible = gps->satellites_visible;
 }
 
 //! Retunrs last GPS RAW message
 sensor_msgs::msg::NavSatFix Data::get_gps_fix()
 {
-  s_shared_lock lock(mu);
-  return gps_fix;
+  return std::atomic_load(&gps_data)->fix;
 }
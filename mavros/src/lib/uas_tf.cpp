@@ -47,3 +47,41 @@ void UAS::publish_static_transform(
 
   tf2_static_broadcaster.sendTransform(static_transform_stamped);
 }
+
+void UAS::send_transform(const geometry_msgs::msg::TransformStamped & transform)
+{
+  std::lock_guard<std::mutex> lock(tf_agg_mutex);
+
+  if (!tf_agg_timer) {
+    // lazy setup: parameter + flush timer on first use
+    this->get_parameter_or("tf_rate_limit", tf_rate_limit, 0.0);
+    tf_agg_timer = this->create_wall_timer(
+      std::chrono::milliseconds(5), [this]() {
+        std::vector<geometry_msgs::msg::TransformStamped> batch;
+        {
+          std::lock_guard<std::mutex> lk(tf_agg_mutex);
+          if (tf_agg_buf.empty()) {
+            return;
+          }
+          batch.swap(tf_agg_buf);
+        }
+
+        // one tf message per window instead of one per transform
+        tf2_broadcaster.sendTransform(batch);
+      });
+  }
+
+  if (tf_rate_limit > 0.0) {
+    auto & last = tf_last_sent[transform.child_frame_id];
+    const rclcpp::Time stamp(transform.header.stamp);
+
+    if (last.nanoseconds() != 0 &&
+      (stamp - last).seconds() < 1.0 / tf_rate_limit)
+    {
+      return;
+    }
+    last = stamp;
+  }
+
+  tf_agg_buf.push_back(transform);
+}
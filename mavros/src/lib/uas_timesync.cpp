@@ -26,10 +26,30 @@ static inline rclcpp::Time ros_time_from_ns(const uint64_t stamp_ns)
     stamp_ns % 1000000000UL);                           // t_nsec
 }
 
+void UAS::set_time_offset_skew(int64_t offset_ns, double skew, uint64_t ref_local_ns)
+{
+  time_offset = offset_ns;
+  std::atomic_store(
+    &time_offset_state,
+    std::shared_ptr<const TimeOffsetState>(
+      std::make_shared<TimeOffsetState>(TimeOffsetState{offset_ns, skew, ref_local_ns})));
+}
+
+uint64_t UAS::compute_time_offset_ns()
+{
+  auto state = std::atomic_load(&time_offset_state);
+  if (!state || state->ref_local_ns == 0) {
+    return time_offset;
+  }
+
+  const int64_t dt_ns = this->now().nanoseconds() - static_cast<int64_t>(state->ref_local_ns);
+  return state->offset_ns + static_cast<int64_t>(state->skew * dt_ns);
+}
+
 rclcpp::Time UAS::synchronise_stamp(uint32_t time_boot_ms)
 {
-  // copy offset from atomic var
-  uint64_t offset_ns = time_offset;
+  // offset extrapolated along the estimated clock skew
+  uint64_t offset_ns = compute_time_offset_ns();
 
   if (offset_ns > 0 || tsync_mode == timesync_mode::PASSTHROUGH) {
     uint64_t stamp_ns = static_cast<uint64_t>(time_boot_ms) * 1000000UL + offset_ns;
@@ -41,7 +61,7 @@ rclcpp::Time UAS::synchronise_stamp(uint32_t time_boot_ms)
 
 rclcpp::Time UAS::synchronise_stamp(uint64_t time_usec)
 {
-  uint64_t offset_ns = time_offset;
+  uint64_t offset_ns = compute_time_offset_ns();
 
   if (offset_ns > 0 || tsync_mode == timesync_mode::PASSTHROUGH) {
     uint64_t stamp_ns = time_usec * 1000UL + offset_ns;
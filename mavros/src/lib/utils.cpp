@@ -0,0 +1,100 @@
+/*
+ * Copyright 2021 Vladimir Ermakov.
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+/**
+ * @brief some useful utils
+ * @file utils.cpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ */
+
+#include <string>
+#include <vector>
+
+#include "mavros/utils.hpp"
+
+using namespace mavros::utils;  // NOLINT
+
+std::regex AllowDenyMatcher::glob_to_regex(const std::string & pattern)
+{
+  std::string re;
+  re.reserve(pattern.size() * 2);
+
+  for (auto c : pattern) {
+    switch (c) {
+      case '*':
+        re += ".*";
+        break;
+      case '?':
+        re += '.';
+        break;
+      case '.':
+      case '+':
+      case '(':
+      case ')':
+      case '[':
+      case ']':
+      case '{':
+      case '}':
+      case '^':
+      case '$':
+      case '|':
+      case '\\':
+        re += '\\';
+        re += c;
+        break;
+      default:
+        re += c;
+    }
+  }
+
+  return std::regex(re, std::regex::icase | std::regex::optimize);
+}
+
+void AllowDenyMatcher::compile(
+  const std::vector<std::string> & denylist,
+  const std::vector<std::string> & allowlist)
+{
+  std::lock_guard<std::mutex> lock(mu);
+
+  deny_patterns.clear();
+  allow_patterns.clear();
+  verdict_cache.clear();
+
+  for (auto & pattern : denylist) {
+    deny_patterns.push_back(glob_to_regex(pattern));
+  }
+  for (auto & pattern : allowlist) {
+    allow_patterns.push_back(glob_to_regex(pattern));
+  }
+}
+
+bool AllowDenyMatcher::is_allowed(const std::string & name)
+{
+  std::lock_guard<std::mutex> lock(mu);
+
+  auto it = verdict_cache.find(name);
+  if (it != verdict_cache.end()) {
+    return it->second;
+  }
+
+  auto match_any = [&name](const std::vector<std::regex> & patterns) {
+      for (auto & re : patterns) {
+        if (std::regex_match(name, re)) {
+          return true;
+        }
+      }
+      return false;
+    };
+
+  bool allowed = true;
+  if (match_any(deny_patterns)) {
+    allowed = match_any(allow_patterns);
+  }
+
+  verdict_cache.emplace(name, allowed);
+  return allowed;
+}
@@ -29,7 +29,10 @@ int main(int argc, char * argv[])
   rclcpp::executors::MultiThreadedExecutor exec(rclcpp::ExecutorOptions(), 2);
 
   rclcpp::NodeOptions options;
-  // options.use_intra_process_comms(true);
+  // NOTE: the /uas link topics enable intra-process comms explicitly,
+  // so the router -> UAS handoff inside this container is a pointer
+  // move; node-level default stays off for plugin compatibility
+  // (latched publishers are not intra-process capable).
 
   std::string fcu_url, gcs_url, uas_url;
   int tgt_system = 1, tgt_component = 1;
@@ -19,6 +19,7 @@
 #include "mavros/mavros_uas.hpp"
 #include "mavros/plugin.hpp"
 #include "mavros/plugin_filter.hpp"
+#include "mavros/setpoint_mixin.hpp"
 
 #include "mavros_msgs/msg/actuator_control.hpp"
 
@@ -44,6 +45,11 @@ public:
 
     target_actuator_control_pub = node->create_publisher<mavros_msgs::msg::ActuatorControl>(
       "target_actuator_control", sensor_qos);
+    // >0: transmit the newest actuator target from a dedicated paced
+    // thread at exactly this rate; jitter is then bounded by the
+    // transport, not the ROS executor
+    node->declare_parameter("paced_tx_rate", 0.0);
+
     actuator_control_sub = node->create_subscription<mavros_msgs::msg::ActuatorControl>(
       "actuator_control", sensor_qos, std::bind(
         &ActuatorControlPlugin::actuator_control_cb, this, _1));
@@ -77,19 +83,44 @@ private:
 
   /* -*- callbacks -*- */
 
+  //! paced transmission of the newest target (see paced_tx_rate)
+  plugin::SetpointPacer<mavros_msgs::msg::ActuatorControl> pacer;
+
   void actuator_control_cb(const mavros_msgs::msg::ActuatorControl::SharedPtr req)
+  {
+    double rate = 0.0;
+    node->get_parameter("paced_tx_rate", rate);
+
+    if (rate > 0.0) {
+      if (!pacer.is_running()) {
+        pacer.start(
+          rate, [this](const mavros_msgs::msg::ActuatorControl & msg) {
+            send_actuator_control_target(msg);
+          });
+      }
+
+      pacer.update(*req);
+      return;
+    }
+
+    send_actuator_control_target(*req);
+  }
+
+  void send_actuator_control_target(const mavros_msgs::msg::ActuatorControl & req)
   {
     //! about groups, mixing and channels: @p https://pixhawk.org/dev/mixing
     //! message definiton here: @p https://mavlink.io/en/messages/common.html#SET_ACTUATOR_CONTROL_TARGET
-    mavlink::common::msg::SET_ACTUATOR_CONTROL_TARGET act{};
 
-    act.time_usec = get_time_usec(req->header.stamp);
-    act.group_mlx = req->group_mix;
-    uas->msg_set_target(act);
-    act.controls = req->controls;
+    // preallocated wire struct: per-sample work is field stores
+    act_msg.time_usec = get_time_usec(req.header.stamp);
+    act_msg.group_mlx = req.group_mix;
+    uas->msg_set_target(act_msg);
+    act_msg.controls = req.controls;
 
-    uas->send_message(act);
+    uas->send_message(act_msg);
   }
+
+  mavlink::common::msg::SET_ACTUATOR_CONTROL_TARGET act_msg {};
 };
 
 }       // namespace std_plugins
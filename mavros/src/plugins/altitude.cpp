@@ -21,8 +21,10 @@
 #include "mavros/mavros_uas.hpp"
 #include "mavros/plugin.hpp"
 #include "mavros/plugin_filter.hpp"
+#include "mavros/frame_tf.hpp"
 
 #include "mavros_msgs/msg/altitude.hpp"
+#include "mavros_msgs/msg/fused_flight_telemetry.hpp"
 
 namespace mavros
 {
@@ -48,20 +50,42 @@ public:
 
     auto sensor_qos = rclcpp::SensorDataQoS();
 
-    altitude_pub = node->create_publisher<mavros_msgs::msg::Altitude>("altitude", sensor_qos);
+    altitude_pub =
+      create_throttled_publisher<mavros_msgs::msg::Altitude>("altitude", sensor_qos);
+
+    // fused telemetry: one time-aligned sample per FCU cycle instead
+    // of several small topics for fleet aggregation consumers
+    node->declare_parameter("enable_fused", false);
+    node->get_parameter("enable_fused", enable_fused);
+    if (enable_fused) {
+      fused_pub = node->create_publisher<mavros_msgs::msg::FusedFlightTelemetry>(
+        "fused_telemetry", sensor_qos);
+    }
   }
 
   Subscriptions get_subscriptions() override
   {
-    return {
+    Subscriptions ret = {
       make_handler(&AltitudePlugin::handle_altitude),
     };
+
+    if (enable_fused) {
+      ret.push_back(make_handler(&AltitudePlugin::handle_vfr_hud));
+      ret.push_back(make_handler(&AltitudePlugin::handle_wind_cov));
+    }
+
+    return ret;
   }
 
 private:
   std::string frame_id;
+  bool enable_fused = false;
+
+  plugin::ThrottledPublisher<mavros_msgs::msg::Altitude>::SharedPtr altitude_pub;
+  rclcpp::Publisher<mavros_msgs::msg::FusedFlightTelemetry>::SharedPtr fused_pub;
 
-  rclcpp::Publisher<mavros_msgs::msg::Altitude>::SharedPtr altitude_pub;
+  //! reused fused sample; partner fields cached from their handlers
+  mavros_msgs::msg::FusedFlightTelemetry fused_msg;
 
   void handle_altitude(
     const mavlink::mavlink_message_t * msg [[maybe_unused]],
@@ -77,6 +101,41 @@ private:
     ros_msg.bottom_clearance = altitude.bottom_clearance;
 
     altitude_pub->publish(ros_msg);
+
+    if (fused_pub) {
+      // ALTITUDE is the cycle anchor: snapshot the cached partners
+      fused_msg.header = ros_msg.header;
+      fused_msg.altitude = ros_msg;
+      fused_pub->publish(fused_msg);
+    }
+  }
+
+  void handle_vfr_hud(
+    const mavlink::mavlink_message_t * msg [[maybe_unused]],
+    mavlink::common::msg::VFR_HUD & vfr_hud, plugin::filter::SystemAndOk filter [[maybe_unused]])
+  {
+    auto & hud = fused_msg.vfr_hud;
+
+    hud.header.stamp = node->now();
+    hud.airspeed = vfr_hud.airspeed;
+    hud.groundspeed = vfr_hud.groundspeed;
+    hud.heading = vfr_hud.heading;
+    hud.throttle = vfr_hud.throttle / 100.0;
+    hud.altitude = vfr_hud.alt;
+    hud.climb = vfr_hud.climb;
+  }
+
+  void handle_wind_cov(
+    const mavlink::mavlink_message_t * msg [[maybe_unused]],
+    mavlink::common::msg::WIND_COV & wind, plugin::filter::SystemAndOk filter [[maybe_unused]])
+  {
+    auto wind_enu = ftf::transform_frame_ned_enu(
+      Eigen::Vector3d(wind.wind_x, wind.wind_y, wind.wind_z));
+
+    fused_msg.wind.linear.x = wind_enu.x();
+    fused_msg.wind.linear.y = wind_enu.y();
+    fused_msg.wind.linear.z = wind_enu.z();
+    fused_msg.wind_valid = true;
   }
 };
 
@@ -121,6 +121,9 @@ public:
   }
 
 private:
+  //! resend attempts with incremented confirmation on ack loss
+  static constexpr uint8_t MAX_CONF_RETRIES = 2;
+
   using L_CommandTransaction = std::list<CommandTransaction>;
 
   std::mutex mutex;
@@ -231,6 +234,29 @@ private:
       bool is_not_timeout = wait_ack_for(*ack_it, result);
       lock.lock();
 
+      // MAVLink spec: a lost ack is retried by resending the command
+      // with an incremented confirmation field; each attempt gets its
+      // own timeout, other in-flight commands are unaffected.
+      uint8_t conf = confirmation;
+      while (!is_not_timeout && (conf - confirmation) < MAX_CONF_RETRIES) {
+        conf++;
+        RCLCPP_WARN(
+          get_logger(), "CMD: Command %u retry, confirmation %u", command, conf);
+
+        ack_it->promise = std::promise<uint8_t>();
+        command_long(
+          broadcast,
+          command, conf,
+          param1, param2,
+          param3, param4,
+          param5, param6,
+          param7);
+
+        lock.unlock();
+        is_not_timeout = wait_ack_for(*ack_it, result);
+        lock.lock();
+      }
+
       success = is_not_timeout && result == enum_value(MAV_RESULT::ACCEPTED);
 
       ack_waiting_list.erase(ack_it);
@@ -17,6 +17,8 @@
 #include <chrono>
 #include <cerrno>
 #include <condition_variable>
+#include <cstring>
+#include <list>
 #include <string>
 #include <vector>
 #include <map>
@@ -24,6 +26,7 @@
 #include <algorithm>
 
 #include "rcpputils/asserts.hpp"
+#include "rclcpp_action/rclcpp_action.hpp"
 #include "mavros/mavros_uas.hpp"
 #include "mavros/plugin.hpp"
 #include "mavros/plugin_filter.hpp"
@@ -41,6 +44,7 @@
 #include "mavros_msgs/srv/file_truncate.hpp"
 #include "mavros_msgs/srv/file_rename.hpp"
 #include "mavros_msgs/srv/file_checksum.hpp"
+#include "mavros_msgs/action/file_download.hpp"
 
 // enable debugging messages
 // #define FTP_LL_DEBUG
@@ -246,7 +250,7 @@ public:
  * @brief FTP plugin.
  * @plugin ftp
  */
-class FTPPlugin : public plugin::Plugin
+class FTPPlugin : public plugin::Plugin, public plugin::QueuedPlugin
 {
 public:
   explicit FTPPlugin(plugin::UASPtr uas_)
@@ -258,12 +262,19 @@ public:
     r_errno(0),
     list_offset(0),
     read_offset(0),
+    read_burst(false),
+    read_base(0),
+    read_expected(0),
+    burst_complete_seen(false),
     write_offset(0),
     open_size(0),
     read_size(0),
     read_buffer{},
     checksum_crc32(0)
   {
+    // burst read: stream chunks with gap re-request (see read_file)
+    node->declare_parameter("burst_read", true);
+
     // since C++ generator do not produce field length defs make check explicit.
     FTPRequest r;
     rcpputils::assert_true((r.payload.size() - sizeof(FTPRequest::PayloadHeader)) == r.DATA_MAXSZ);
@@ -316,12 +327,21 @@ public:
       node->create_service<mavros_msgs::srv::FileChecksum>(
       "~/checksum",
       std::bind(&FTPPlugin::checksum_cb, this, _1, _2));
+
+    // streaming transfer: chunked feedback or direct-to-disk,
+    // memory stays O(chunk) instead of O(file)
+    download_action_srv = rclcpp_action::create_server<FileDownload>(
+      node, "~/download",
+      std::bind(&FTPPlugin::download_goal_cb, this, _1, _2),
+      std::bind(&FTPPlugin::download_cancel_cb, this, _1),
+      std::bind(&FTPPlugin::download_accepted_cb, this, _1));
   }
 
   Subscriptions get_subscriptions() override
   {
     return {
-      make_handler(&FTPPlugin::handle_file_transfer_protocol),
+      // ftp does long service work: keep it off the rx hot thread
+      queued(make_handler(&FTPPlugin::handle_file_transfer_protocol)),
     };
   }
 
@@ -339,6 +359,10 @@ private:
   rclcpp::Service<std_srvs::srv::Empty>::SharedPtr reset_srv;
   rclcpp::Service<mavros_msgs::srv::FileChecksum>::SharedPtr checksum_srv;
 
+  using FileDownload = mavros_msgs::action::FileDownload;
+  using FileDownloadGoalHandle = rclcpp_action::ServerGoalHandle<FileDownload>;
+  rclcpp_action::Server<FileDownload>::SharedPtr download_action_srv;
+
   //! This type used in servicies to store 'data' fileds.
   typedef std::vector<uint8_t> V_FileData;
 
@@ -377,6 +401,14 @@ private:
   uint32_t read_offset;
   V_FileData read_buffer;
 
+  // burst read state: multiple outstanding chunks stream in, gaps
+  // are tracked and selectively re-requested with kCmdReadFile
+  bool read_burst;
+  uint32_t read_base;               //!< first requested offset
+  uint32_t read_expected;           //!< next contiguous offset
+  bool burst_complete_seen;
+  std::list<std::pair<uint32_t, uint32_t>> read_gaps;   //!< [begin, end)
+
   // FTP:Write
   uint32_t write_offset;
   V_FileData write_buffer;
@@ -416,11 +448,19 @@ private:
     const uint16_t incoming_seqnr = req.header()->seqNumber;
     const uint16_t expected_seqnr = last_send_seqnr + 1;
     if (incoming_seqnr != expected_seqnr) {
-      RCLCPP_WARN(
-        get_logger(), "FTP: Lost sync! seqnr: %u != %u",
-        incoming_seqnr, expected_seqnr);
-      go_idle(true, EILSEQ);
-      return;
+      if (op_state == OP::READ && read_burst) {
+        // lost burst chunks are recovered by the offset-based gap
+        // tracker; just resync the sequence counter
+        RCLCPP_DEBUG(
+          get_logger(), "FTP: burst seqnr skip: %u != %u",
+          incoming_seqnr, expected_seqnr);
+      } else {
+        RCLCPP_WARN(
+          get_logger(), "FTP: Lost sync! seqnr: %u != %u",
+          incoming_seqnr, expected_seqnr);
+        go_idle(true, EILSEQ);
+        return;
+      }
     }
 
     last_send_seqnr = incoming_seqnr;
@@ -484,9 +524,27 @@ private:
       list_directory_end();
       return;
     } else if (prev_op == OP::READ && error_code == FTPRequest::kErrEOF) {
+      if (read_burst) {
+        // burst stream hit EOF: only the gaps are left
+        burst_complete_seen = true;
+        op_state = OP::READ;
+        if (!burst_continue()) {
+          return;
+        }
+      }
       /* read done */
       read_file_end();
       return;
+    } else if (prev_op == OP::READ && read_burst &&
+      error_code == FTPRequest::kErrUnknownCommand &&
+      read_expected == read_base)
+    {
+      // no burst support: restart as stop-and-wait
+      RCLCPP_INFO(get_logger(), "FTP: burst read unsupported, falling back");
+      read_burst = false;
+      op_state = OP::READ;
+      send_read_command();
+      return;
     }
 
     RCLCPP_ERROR(
@@ -568,11 +626,98 @@ private:
     go_idle(false);
   }
 
+  /**
+   * Store a chunk at its file position; track the gaps a lossy link
+   * leaves in the burst stream for selective re-request.
+   */
+  void burst_store_chunk(uint32_t offset, const uint8_t * data, size_t size)
+  {
+    if (offset < read_base) {
+      return;     // stale
+    }
+
+    const size_t pos = offset - read_base;
+    if (pos >= read_size) {
+      return;
+    }
+
+    const size_t ncopy = std::min(size, read_size - pos);
+    if (read_buffer.size() < pos + ncopy) {
+      read_buffer.resize(pos + ncopy);
+    }
+    std::memcpy(read_buffer.data() + pos, data, ncopy);
+
+    if (offset > read_expected) {
+      // burst skipped ahead: remember the hole
+      read_gaps.emplace_back(read_expected, offset);
+      read_expected = offset + ncopy;
+    } else if (offset == read_expected) {
+      read_expected += ncopy;
+    } else {
+      // gap fill: drop the covered range from the gap list
+      for (auto it = read_gaps.begin(); it != read_gaps.end(); ++it) {
+        if (offset >= it->first && offset < it->second) {
+          if (offset + ncopy >= it->second) {
+            read_gaps.erase(it);
+          } else {
+            it->first = offset + ncopy;
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  //! @return true when the burst transfer is complete
+  bool burst_continue()
+  {
+    if (!read_gaps.empty()) {
+      auto & gap = read_gaps.front();
+      send_gap_read_command(gap.first, gap.second - gap.first);
+      return false;
+    }
+
+    if (!burst_complete_seen) {
+      return false;     // more stream chunks expected
+    }
+
+    return true;
+  }
+
+  void handle_ack_burst_read(const FTPRequest & req)
+  {
+    auto hdr = req.header();
+    auto lg = get_logger();
+
+    RCLCPP_DEBUG(lg, "FTP:m: ACK BurstRead SZ(%u) OFF(%u)", hdr->size, hdr->offset);
+    if (hdr->session != active_session) {
+      RCLCPP_ERROR(lg, "FTP:Read unexpected session");
+      go_idle(true, EBADSLT);
+      return;
+    }
+
+    burst_store_chunk(hdr->offset, req.data(), hdr->size);
+
+    // NOTE: spec places burst_complete where our padding starts
+    if (hdr->padding[0] != 0) {
+      burst_complete_seen = true;
+    }
+
+    if (burst_continue()) {
+      read_file_end();
+    }
+  }
+
   void handle_ack_read(const FTPRequest & req)
   {
     auto hdr = req.header();
     auto lg = get_logger();
 
+    if (hdr->req_opcode == FTPRequest::kCmdBurstReadFile) {
+      handle_ack_burst_read(req);
+      return;
+    }
+
     RCLCPP_DEBUG(lg, "FTP:m: ACK Read SZ(%u)", hdr->size);
     if (hdr->session != active_session) {
       RCLCPP_ERROR(lg, "FTP:Read unexpected session");
@@ -580,6 +725,15 @@ private:
       return;
     }
 
+    if (read_burst) {
+      // selective re-request of a burst gap
+      burst_store_chunk(hdr->offset, req.data(), hdr->size);
+      if (burst_continue()) {
+        read_file_end();
+      }
+      return;
+    }
+
     if (hdr->offset != read_offset) {
       RCLCPP_ERROR(lg, "FTP:Read different offset");
       go_idle(true, EBADE);
@@ -733,6 +887,27 @@ private:
     req.send(uas, last_send_seqnr);
   }
 
+  void send_burst_read_command()
+  {
+    // read the whole requested range as a burst stream
+    RCLCPP_DEBUG_STREAM(
+      get_logger(), "FTP:m: kCmdBurstReadFile: " << active_session << " off: " << read_offset);
+    FTPRequest req(FTPRequest::kCmdBurstReadFile, active_session);
+    req.header()->offset = read_offset;
+    req.header()->size = FTPRequest::DATA_MAXSZ;
+    req.send(uas, last_send_seqnr);
+  }
+
+  void send_gap_read_command(uint32_t offset, size_t size)
+  {
+    RCLCPP_DEBUG_STREAM(
+      get_logger(), "FTP:m: kCmdReadFile (gap): " << active_session << " off: " << offset);
+    FTPRequest req(FTPRequest::kCmdReadFile, active_session);
+    req.header()->offset = offset;
+    req.header()->size = (size < FTPRequest::DATA_MAXSZ) ? size : FTPRequest::DATA_MAXSZ;
+    req.send(uas, last_send_seqnr);
+  }
+
   void send_read_command()
   {
     // read operation always try read DATA_MAXSZ block (hdr->size ignored)
@@ -913,7 +1088,17 @@ private:
       read_buffer.reserve(len);
     }
 
-    send_read_command();
+    node->get_parameter("burst_read", read_burst);
+    read_base = off;
+    read_expected = off;
+    burst_complete_seen = false;
+    read_gaps.clear();
+
+    if (read_burst) {
+      send_burst_read_command();
+    } else {
+      send_read_command();
+    }
     return true;
   }
 
@@ -1173,6 +1358,121 @@ private:
     res->r_errno = r_errno;
   }
 
+
+  /* -*- streaming download action -*- */
+
+  //! Bytes fetched per read cycle; bounds memory and feedback size.
+  static constexpr size_t DOWNLOAD_CHUNK = 16 * 1024;
+
+  rclcpp_action::GoalResponse download_goal_cb(
+    const rclcpp_action::GoalUUID & uuid [[maybe_unused]],
+    std::shared_ptr<const FileDownload::Goal> goal)
+  {
+    if (op_state != OP::IDLE) {
+      RCLCPP_ERROR(get_logger(), "FTP: download rejected, FTP busy");
+      return rclcpp_action::GoalResponse::REJECT;
+    }
+
+    RCLCPP_INFO(
+      get_logger(), "FTP: download %s -> %s", goal->file_path.c_str(),
+      goal->local_path.empty() ? "<feedback>" : goal->local_path.c_str());
+    return rclcpp_action::GoalResponse::ACCEPT_AND_EXECUTE;
+  }
+
+  rclcpp_action::CancelResponse download_cancel_cb(
+    const std::shared_ptr<FileDownloadGoalHandle> goal_handle [[maybe_unused]])
+  {
+    return rclcpp_action::CancelResponse::ACCEPT;
+  }
+
+  void download_accepted_cb(const std::shared_ptr<FileDownloadGoalHandle> goal_handle)
+  {
+    // the transfer overlaps with disk io on its own thread
+    std::thread(&FTPPlugin::execute_download, this, goal_handle).detach();
+  }
+
+  void execute_download(const std::shared_ptr<FileDownloadGoalHandle> goal_handle)
+  {
+    auto goal = goal_handle->get_goal();
+    auto result = std::make_shared<FileDownload::Result>();
+
+    FILE * out = nullptr;
+    if (!goal->local_path.empty()) {
+      out = std::fopen(goal->local_path.c_str(), "wb");
+      if (out == nullptr) {
+        result->r_errno = errno;
+        goal_handle->abort(result);
+        return;
+      }
+    }
+
+    auto finish = [&](bool ok, uint64_t transferred) {
+        close_file(goal->file_path);
+        wait_completion(OPEN_TIMEOUT_MS);
+
+        if (out != nullptr) {
+          std::fclose(out);
+        }
+
+        result->success = ok;
+        result->r_errno = r_errno;
+        result->size = transferred;
+
+        if (goal_handle->is_canceling()) {
+          goal_handle->canceled(result);
+        } else if (ok) {
+          goal_handle->succeed(result);
+        } else {
+          goal_handle->abort(result);
+        }
+      };
+
+    bool ok = open_file(goal->file_path, mavros_msgs::srv::FileOpen::Request::MODE_READ);
+    if (ok) {
+      ok = wait_completion(OPEN_TIMEOUT_MS);
+    }
+    if (!ok) {
+      finish(false, 0);
+      return;
+    }
+
+    const uint64_t file_size = open_size;
+    uint64_t offset = 0;
+
+    while (ok && offset < file_size && rclcpp::ok()) {
+      if (goal_handle->is_canceling()) {
+        break;
+      }
+
+      ok = read_file(goal->file_path, offset, DOWNLOAD_CHUNK);
+      if (ok) {
+        ok = wait_completion(compute_rw_timeout(DOWNLOAD_CHUNK));
+      }
+      if (!ok || read_buffer.empty()) {
+        break;
+      }
+
+      auto feedback = std::make_shared<FileDownload::Feedback>();
+      feedback->offset = offset;
+      feedback->file_size = file_size;
+
+      if (out != nullptr) {
+        // direct-to-disk: data never accumulates in memory
+        ok = std::fwrite(read_buffer.data(), 1, read_buffer.size(), out) ==
+          read_buffer.size();
+      } else {
+        feedback->chunk = read_buffer;
+      }
+
+      goal_handle->publish_feedback(feedback);
+
+      offset += read_buffer.size();
+      read_buffer.clear();
+    }
+
+    finish(ok, offset);
+  }
+
 #undef SERVICE_IDLE_CHECK
 
   /**
@@ -137,6 +137,12 @@ private:
       return;
     }
 
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::RXLIST;
     wp_count = 0;
     restart_timeout_timer();
@@ -169,6 +175,12 @@ private:
     }
 
     // Full waypoint update
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::TXLIST;
 
     send_waypoints.clear();
@@ -201,6 +213,12 @@ private:
       return;
     }
 
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::CLEAR;
     restart_timeout_timer();
 
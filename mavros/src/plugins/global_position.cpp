@@ -186,12 +186,51 @@ private:
   Eigen::Vector3d ecef_origin {};       //!< geocentric origin of map frame [m]
   Eigen::Vector3d local_ecef {};        //!< local ECEF coordinates on map frame [m]
 
+  // Incremental projection cache: the geoid separation varies over
+  // ~100 km scales and the map-origin ECEF->ENU rotation is fixed
+  // once the origin is set, so neither needs recomputing at fix rate.
+  static constexpr double GEOID_CACHE_DEG = 0.01;   //!< ~1.1 km
+  bool geoid_cache_valid = false;
+  double geoid_cache_lat = 0.0;
+  double geoid_cache_lon = 0.0;
+  double geoid_cache_sep = 0.0;
+
+  bool ecef_rot_valid = false;
+  Eigen::Matrix3d ecef_enu_rot;
+
+  double cached_geoid_offset(const sensor_msgs::msg::NavSatFix & fix)
+  {
+    if (!geoid_cache_valid ||
+      std::abs(fix.latitude - geoid_cache_lat) > GEOID_CACHE_DEG ||
+      std::abs(fix.longitude - geoid_cache_lon) > GEOID_CACHE_DEG)
+    {
+      geoid_cache_sep = uas->data.geoid_to_ellipsoid_height(fix);
+      geoid_cache_lat = fix.latitude;
+      geoid_cache_lon = fix.longitude;
+      geoid_cache_valid = true;
+    }
+
+    return geoid_cache_sep;
+  }
+
+  void update_ecef_rotation()
+  {
+    // probe the transform with basis vectors to cache the rotation
+    for (int i = 0; i < 3; i++) {
+      Eigen::Vector3d basis = Eigen::Vector3d::Zero();
+      basis(i) = 1.0;
+      ecef_enu_rot.col(i) = ftf::transform_frame_ecef_enu(basis, map_origin);
+    }
+
+    ecef_rot_valid = true;
+  }
+
   template<typename MsgT>
   inline void fill_lla(const MsgT & msg, sensor_msgs::msg::NavSatFix & fix)
   {
     fix.latitude = msg.lat / 1E7;       // deg
     fix.longitude = msg.lon / 1E7;      // deg
-    fix.altitude = msg.alt / 1E3 + uas->data.geoid_to_ellipsoid_height(fix);   // in meters
+    fix.altitude = msg.alt / 1E3 + cached_geoid_offset(fix);   // in meters
   }
 
   inline void fill_unknown_cov(sensor_msgs::msg::NavSatFix & fix)
@@ -374,7 +413,7 @@ private:
        * in spherical coordinates, with the orientation in ENU (just like what is applied
        * on Gazebo)
        */
-      GeographicLib::Geocentric map(GeographicLib::Constants::WGS84_a(),
+      static const GeographicLib::Geocentric map(GeographicLib::Constants::WGS84_a(),
         GeographicLib::Constants::WGS84_f());
 
       /**
@@ -396,6 +435,7 @@ private:
         map_origin.z() = fix.altitude;
 
         ecef_origin = map_point;    // Local position is zero
+        update_ecef_rotation();
         is_map_init = true;
       }
     } catch (const std::exception & e) {
@@ -404,11 +444,16 @@ private:
 
     // Compute the local coordinates in ECEF
     local_ecef = map_point - ecef_origin;
-    // Compute the local coordinates in ENU
-    odom.pose.pose.position = tf2::toMsg(
-      ftf::transform_frame_ecef_enu(
-        local_ecef,
-        map_origin));
+    // Compute the local coordinates in ENU; the rotation of the
+    // fixed map origin is cached, so this is one 3x3 multiply
+    if (ecef_rot_valid) {
+      odom.pose.pose.position = tf2::toMsg(Eigen::Vector3d(ecef_enu_rot * local_ecef));
+    } else {
+      odom.pose.pose.position = tf2::toMsg(
+        ftf::transform_frame_ecef_enu(
+          local_ecef,
+          map_origin));
+    }
 
     /**
      * @brief By default, we are using the relative altitude instead of the geocentric
@@ -452,7 +497,7 @@ private:
       transform.transform.translation.y = odom.pose.pose.position.y;
       transform.transform.translation.z = odom.pose.pose.position.z;
 
-      uas->tf2_broadcaster.sendTransform(transform);
+      uas->send_transform(transform);
     }
   }
 
@@ -490,7 +535,7 @@ private:
       transform.transform.translation.y = global_offset.pose.position.y;
       transform.transform.translation.z = global_offset.pose.position.z;
 
-      uas->tf2_broadcaster.sendTransform(transform);
+      uas->send_transform(transform);
     }
   }
 
@@ -551,6 +596,7 @@ private:
       RCLCPP_ERROR_STREAM(get_logger(), "GP: Caught exception: " << e.what());
     }
 
+    update_ecef_rotation();
     is_map_init = true;
   }
 
@@ -65,6 +65,15 @@ public:
       node->create_wall_timer(REQUEST_POLL_TIME, std::bind(&HomePositionPlugin::timeout_cb, this));
     poll_timer->cancel();
 
+    // one-shot prompt refresh for event-driven requests
+    refresh_timer =
+      node->create_wall_timer(
+      100ms, [this]() {
+        refresh_timer->cancel();
+        timeout_cb();
+      });
+    refresh_timer->cancel();
+
     enable_connection_cb();
   }
 
@@ -72,6 +81,7 @@ public:
   {
     return {
       make_handler(&HomePositionPlugin::handle_home_position),
+      make_handler(&HomePositionPlugin::handle_heartbeat),
     };
   }
 
@@ -81,6 +91,10 @@ private:
   rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr update_srv;
 
   rclcpp::TimerBase::SharedPtr poll_timer;
+  rclcpp::TimerBase::SharedPtr refresh_timer;
+
+  //! armed state tracked for event-driven home refresh
+  bool last_armed = false;
 
   const std::chrono::nanoseconds REQUEST_POLL_TIME = 10s;
 
@@ -191,6 +205,22 @@ private:
     res->success = call_get_home_position();
   }
 
+  void handle_heartbeat(
+    const mavlink::mavlink_message_t * msg [[maybe_unused]],
+    mavlink::minimal::msg::HEARTBEAT & hb,
+    plugin::filter::SystemAndOk filter [[maybe_unused]])
+  {
+    using mavlink::minimal::MAV_MODE_FLAG;
+
+    // home is (re)set around arming transitions: request it once,
+    // event driven, instead of polling the link forever
+    const bool armed = !!(hb.base_mode & utils::enum_value(MAV_MODE_FLAG::SAFETY_ARMED));
+    if (armed != last_armed) {
+      last_armed = armed;
+      refresh_timer->reset();
+    }
+  }
+
   void timeout_cb()
   {
     RCLCPP_INFO(get_logger(), "HP: requesting home position");
@@ -200,8 +230,12 @@ private:
   void connection_cb(bool connected) override
   {
     if (connected) {
+      // prompt request at connect; the slow poll stays only as a
+      // degraded fallback until HOME_POSITION arrives
+      refresh_timer->reset();
       poll_timer->reset();
     } else {
+      refresh_timer->cancel();
       poll_timer->cancel();
     }
   }
@@ -252,7 +252,7 @@ private:
      *  @snippet src/plugins/imu.cpp pub_enu
      */
     // [pub_enu]
-    imu_pub->publish(imu_enu_msg);
+    plugin::publish_loaned(imu_pub, imu_enu_msg);
     // [pub_enu]
   }
 
@@ -285,7 +285,7 @@ private:
     imu_msg.linear_acceleration_covariance = linear_acceleration_cov;
 
     // Publish message [ENU frame]
-    imu_raw_pub->publish(imu_msg);
+    plugin::publish_loaned(imu_raw_pub, imu_msg);
   }
 
   /**
@@ -343,8 +343,8 @@ private:
      *  @snippet src/plugins/imu.cpp ned->baselink->enu
      */
     // [ned->baselink->enu]
-    auto enu_baselink_orientation = ftf::transform_orientation_aircraft_baselink(
-      ftf::transform_orientation_ned_enu(ned_aircraft_orientation));
+    auto enu_baselink_orientation =
+      ftf::transform_orientation_ned_aircraft_enu_baselink(ned_aircraft_orientation);
     // [ned->baselink->enu]
 
     /** The angular velocity expressed in the aircraft frame.
@@ -394,8 +394,8 @@ private:
      *  It is required to change this to aircraft->base_link:
      *  @snippet src/plugins/imu.cpp ned->baselink->enu
      */
-    auto enu_baselink_orientation = ftf::transform_orientation_aircraft_baselink(
-      ftf::transform_orientation_ned_enu(ned_aircraft_orientation));
+    auto enu_baselink_orientation =
+      ftf::transform_orientation_ned_aircraft_enu_baselink(ned_aircraft_orientation);
 
     /** The angular velocity expressed in the aircraft frame.
      *  It is required to apply the static rotation to get it into the base_link frame:
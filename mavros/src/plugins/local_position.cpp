@@ -132,7 +132,7 @@ private:
       transform.transform.translation.y = odom.pose.pose.position.y;
       transform.transform.translation.z = odom.pose.pose.position.z;
       transform.transform.rotation = odom.pose.pose.orientation;
-      uas->tf2_broadcaster.sendTransform(transform);
+      uas->send_transform(transform);
     }
   }
 
@@ -170,14 +170,14 @@ private:
 
     // publish odom if we don't have LOCAL_POSITION_NED_COV
     if (!has_local_position_ned_cov) {
-      local_odom->publish(odom);
+      plugin::publish_loaned(local_odom, odom);
     }
 
     // publish pose always
     auto pose = geometry_msgs::msg::PoseStamped();
     pose.header = odom.header;
     pose.pose = odom.pose.pose;
-    local_position->publish(pose);
+    plugin::publish_loaned(local_position, pose);
 
     // publish velocity always
     // velocity in the body frame
@@ -262,7 +262,7 @@ private:
       auto pose = geometry_msgs::msg::PoseStamped();
       pose.header = odom.header;
       pose.pose = odom.pose.pose;
-      local_position->publish(pose);
+      plugin::publish_loaned(local_position, pose);
 
       auto twist = geometry_msgs::msg::TwistStamped();
       twist.header.stamp = odom.header.stamp;
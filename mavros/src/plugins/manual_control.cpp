@@ -22,6 +22,12 @@
 
 #include <mavros_msgs/msg/manual_control.hpp>
 
+#include <atomic>
+
+#include <chrono>
+
+#include <thread>
+
 namespace mavros
 {
 namespace std_plugins
@@ -39,10 +45,52 @@ public:
   : Plugin(uas_, "manual_control")
   {
     control_pub = node->create_publisher<mavros_msgs::msg::ManualControl>("~/control", 10);
-    send_sub =
-      node->create_subscription<mavros_msgs::msg::ManualControl>(
-      "~/send", 10,
-      std::bind(&ManualControlPlugin::send_cb, this, _1));
+
+    // direct dispatch: the send subscription gets its own callback
+    // group spun by a dedicated high-priority thread, so stick input
+    // never waits behind a loaded shared executor
+    node->declare_parameter("direct_dispatch", false);
+    bool direct = false;
+    node->get_parameter("direct_dispatch", direct);
+
+    if (direct) {
+      direct_group = node->create_callback_group(
+        rclcpp::CallbackGroupType::MutuallyExclusive, false);
+
+      rclcpp::SubscriptionOptions sub_options;
+      sub_options.callback_group = direct_group;
+
+      send_sub =
+        node->create_subscription<mavros_msgs::msg::ManualControl>(
+        "~/send", rclcpp::SensorDataQoS(),
+        std::bind(&ManualControlPlugin::send_cb, this, _1), sub_options);
+
+      direct_exec.add_callback_group(direct_group, node->get_node_base_interface());
+      direct_exit = false;
+      direct_thread = std::thread(
+        [this]() {
+          mavconn::utils::set_this_thread_name("manual-ctl");
+          mavconn::utils::set_this_thread_priority(SCHED_FIFO, 20);   // best effort
+
+          while (!direct_exit && rclcpp::ok()) {
+            direct_exec.spin_once(std::chrono::milliseconds(100));
+          }
+        });
+    } else {
+      send_sub =
+        node->create_subscription<mavros_msgs::msg::ManualControl>(
+        "~/send", 10,
+        std::bind(&ManualControlPlugin::send_cb, this, _1));
+    }
+  }
+
+  ~ManualControlPlugin() override
+  {
+    if (direct_thread.joinable()) {
+      direct_exit = true;
+      direct_exec.cancel();
+      direct_thread.join();
+    }
   }
 
   Subscriptions get_subscriptions() override
@@ -56,6 +104,18 @@ private:
   rclcpp::Publisher<mavros_msgs::msg::ManualControl>::SharedPtr control_pub;
   rclcpp::Subscription<mavros_msgs::msg::ManualControl>::SharedPtr send_sub;
 
+  // direct dispatch state (see ctor)
+  rclcpp::CallbackGroup::SharedPtr direct_group;
+  rclcpp::executors::SingleThreadedExecutor direct_exec;
+  std::thread direct_thread;
+  std::atomic<bool> direct_exit {false};
+
+  //! preallocated wire struct for the passthrough path
+  mavlink::common::msg::MANUAL_CONTROL send_msg {};
+
+  //! end-to-end passthrough latency [us], see diagnostics/logs
+  std::atomic<uint64_t> last_dispatch_us {0};
+
   /* -*- rx handlers -*- */
 
   void handle_manual_control(
@@ -79,15 +139,22 @@ private:
 
   void send_cb(const mavros_msgs::msg::ManualControl::SharedPtr req)
   {
-    mavlink::common::msg::MANUAL_CONTROL msg = {};
-    msg.target = uas->get_tgt_system();
-    msg.x = req->x;
-    msg.y = req->y;
-    msg.z = req->z;
-    msg.r = req->r;
-    msg.buttons = req->buttons;
-
-    uas->send_message(msg);
+    const auto t0 = std::chrono::steady_clock::now();
+
+    // field stores into the preallocated struct, straight to the link
+    send_msg.target = uas->get_tgt_system();
+    send_msg.x = req->x;
+    send_msg.y = req->y;
+    send_msg.z = req->z;
+    send_msg.r = req->r;
+    send_msg.buttons = req->buttons;
+
+    uas->send_message(send_msg);
+
+    last_dispatch_us.store(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t0).count(),
+      std::memory_order_relaxed);
   }
 };
 
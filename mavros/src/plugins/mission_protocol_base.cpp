@@ -13,6 +13,8 @@
  * @author Charlie Burge <charlieburge@yahoo.com>
  */
 
+#include <cstring>
+
 #include "mavros/mission_protocol_base.hpp"
 
 using namespace mavros;          // NOLINT
@@ -29,6 +31,12 @@ std::ostream & mavros::plugin::operator<<(std::ostream & os, const MissionItem &
   return os;
 }
 
+// shared transfer scheduler state (see header)
+std::mutex MissionBase::link_mutex;
+std::condition_variable MissionBase::link_cv;
+std::deque<const MissionBase *> MissionBase::link_queue;
+const MissionBase * MissionBase::link_owner = nullptr;
+
 void MissionBase::handle_mission_item(
   const mavlink::mavlink_message_t * msg [[maybe_unused]],
   MISSION_ITEM & wpi,
@@ -210,6 +218,25 @@ void MissionBase::handle_mission_count(
     // FCU report of MISSION_REQUEST_LIST
     RCLCPP_DEBUG(get_logger(), "%s: count %d", log_prefix, mcnt.count);
 
+    // Answer from cache only when MISSION_CHECKSUM proves the
+    // content unchanged since the cache was filled: an edited
+    // mission of equal length must still be re-downloaded, so a
+    // bare count match never short-circuits the transfer.
+    if (enable_mission_cache && cache_valid &&
+      cache_checksum_valid && fcu_checksum_valid &&
+      fcu_mission_checksum == cache_checksum &&
+      mcnt.count == waypoints.size())
+    {
+      RCLCPP_INFO(
+        get_logger(), "%s: checksum 0x%08x matches cached list (%zu), using cache",
+        log_prefix, fcu_mission_checksum, waypoints.size());
+
+      request_mission_done();
+      lock.unlock();
+      publish_waypoints();
+      return;
+    }
+
     wp_count = mcnt.count;
     wp_cur_id = 0;
 
@@ -291,6 +318,9 @@ void MissionBase::handle_mission_ack(
     go_idle();
     waypoints = send_waypoints;
     send_waypoints.clear();
+    cache_valid = true;
+    snapshot_cache_checksum();
+    mission_generation++;
 
     if (wp_state == WP::TXWPINT) {
       mission_item_int_support_confirmed = true;
@@ -328,6 +358,9 @@ void MissionBase::handle_mission_ack(
         log_prefix << ": clear failed: " << utils::to_string(ack_type));
     } else {
       waypoints.clear();
+      cache_valid = true;
+      snapshot_cache_checksum();
+      mission_generation++;
       lock.unlock();
       publish_waypoints();
       RCLCPP_INFO(get_logger(), "%s: mission cleared", log_prefix);
@@ -339,6 +372,34 @@ void MissionBase::handle_mission_ack(
   }
 }
 
+void MissionBase::handle_mission_checksum_raw(
+  const mavlink::mavlink_message_t * msg, const mavconn::Framing framing)
+{
+  if (framing != mavconn::Framing::ok) {
+    return;
+  }
+
+  // MISSION_CHECKSUM wire layout: uint32 checksum, uint8 mission_type;
+  // the parser zero-fills the truncated payload tail
+  uint32_t checksum;
+  std::memcpy(&checksum, _MAV_PAYLOAD(msg), sizeof(checksum));
+  const uint8_t type = _MAV_PAYLOAD(msg)[4];
+
+  if (type != utils::enum_value(mission_type)) {
+    return;
+  }
+
+  unique_lock lock(mutex);
+
+  if (fcu_checksum_valid && fcu_mission_checksum != checksum) {
+    // content changed on the FCU side
+    cache_checksum_valid = false;
+  }
+
+  fcu_mission_checksum = checksum;
+  fcu_checksum_valid = true;
+}
+
 void MissionBase::handle_mission_current(
   const mavlink::mavlink_message_t * msg [[maybe_unused]],
   mavlink::common::msg::MISSION_CURRENT & mcur,
@@ -392,7 +453,7 @@ void MissionBase::timeout_cb()
   unique_lock lock(mutex);
 
   // run once
-  timeout_timer->cancel();
+  uas->transactions().cancel(timeout_txn);
 
   if (wp_retries > 0) {
     wp_retries--;
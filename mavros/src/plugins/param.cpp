@@ -21,6 +21,7 @@
 #include <unordered_map>
 #include <list>
 #include <memory>
+#include <cstring>
 #include <vector>
 
 #include "rcpputils/asserts.hpp"
@@ -30,6 +31,8 @@
 
 #include "mavros_msgs/srv/param_pull.hpp"
 #include "mavros_msgs/srv/param_set_v2.hpp"
+#include "mavros_msgs/srv/param_snapshot.hpp"
+#include "mavros_msgs/msg/param_event_batch.hpp"
 #include "mavros_msgs/msg/param_event.hpp"
 
 namespace mavros
@@ -424,6 +427,12 @@ public:
     LIST_TIMEOUT(30s),
     PARAM_TIMEOUT(1s),
     RETRIES_COUNT(3),
+    param_request_window(8),
+    cache_warm(false),
+    use_ftp_pull(false),
+    ftp_pull_failed(false),
+    ftp_seq(0),
+    ftp_session(0),
     param_count(-1),
     param_state(PR::IDLE),
     is_timedout(false),
@@ -433,6 +442,23 @@ public:
     auto qos = rclcpp::ParametersQoS().get_rmw_qos_profile();
 
     param_event_pub = node->create_publisher<mavros_msgs::msg::ParamEvent>("~/event", event_qos);
+
+    // >0: coalesce events within this window [s] into ~/event_batch
+    // (the per-event topic stays for compatibility)
+    node->declare_parameter("event_batch_window", 0.0);
+    double batch_window = 0.0;
+    node->get_parameter("event_batch_window", batch_window);
+    if (batch_window > 0.0) {
+      event_batch_pub = node->create_publisher<mavros_msgs::msg::ParamEventBatch>(
+        "~/event_batch", event_qos);
+      event_batch_timer = node->create_wall_timer(
+        std::chrono::duration<double>(batch_window),
+        std::bind(&ParamPlugin::flush_event_batch, this));
+    }
+
+    snapshot_srv = node->create_service<mavros_msgs::srv::ParamSnapshot>(
+      "~/snapshot",
+      std::bind(&ParamPlugin::snapshot_cb, this, _1, _2));
     std_event_pub = node->create_publisher<rcl_interfaces::msg::ParameterEvent>(
       PSN::events,
       event_qos);
@@ -472,9 +498,14 @@ public:
       node->create_wall_timer(BOOTUP_TIME, std::bind(&ParamPlugin::schedule_cb, this));
     schedule_timer->cancel();
 
-    timeout_timer =
-      node->create_wall_timer(PARAM_TIMEOUT, std::bind(&ParamPlugin::timeout_cb, this));
-    timeout_timer->cancel();
+    // timeout bookkeeping runs on the shared transaction engine
+    timeout_txn = uas->transactions().create(
+      PARAM_TIMEOUT, std::bind(&ParamPlugin::timeout_cb, this));
+
+    // QGC-style packed parameter download via MAVLink-FTP
+    node->declare_parameter("param_use_ftp", false);
+    // directory for the persistent parameter cache ("" disables)
+    node->declare_parameter("param_cache_dir", "");
 
     enable_connection_cb();
   }
@@ -483,6 +514,7 @@ public:
   {
     return {
       make_handler(&ParamPlugin::handle_param_value),
+      make_handler(&ParamPlugin::handle_file_transfer_protocol),
     };
   }
 
@@ -507,10 +539,48 @@ private:
   rclcpp::Service<rcl_interfaces::srv::ListParameters>::SharedPtr list_parameters_srv;
 
   rclcpp::Publisher<mavros_msgs::msg::ParamEvent>::SharedPtr param_event_pub;
+  rclcpp::Publisher<mavros_msgs::msg::ParamEventBatch>::SharedPtr event_batch_pub;
+  rclcpp::TimerBase::SharedPtr event_batch_timer;
+  rclcpp::Service<mavros_msgs::srv::ParamSnapshot>::SharedPtr snapshot_srv;
+  mavros_msgs::msg::ParamEventBatch event_batch;
+
+  void queue_event(const mavros_msgs::msg::ParamEvent & evt)
+  {
+    // NOTE: called with mutex held
+    if (event_batch_pub) {
+      event_batch.events.push_back(evt);
+    }
+  }
+
+  void flush_event_batch()
+  {
+    lock_guard lock(mutex);
+
+    if (!event_batch_pub || event_batch.events.empty()) {
+      return;
+    }
+
+    event_batch.header.stamp = node->now();
+    event_batch_pub->publish(event_batch);
+    event_batch.events.clear();
+  }
+
+  void snapshot_cb(
+    const mavros_msgs::srv::ParamSnapshot::Request::SharedPtr req [[maybe_unused]],
+    mavros_msgs::srv::ParamSnapshot::Response::SharedPtr res)
+  {
+    lock_guard lock(mutex);
+
+    res->success = (param_state == PR::IDLE) && !parameters.empty();
+    res->params.reserve(parameters.size());
+    for (auto & kv : parameters) {
+      res->params.push_back(kv.second.to_event_msg());
+    }
+  }
   rclcpp::Publisher<rcl_interfaces::msg::ParameterEvent>::SharedPtr std_event_pub;
 
   rclcpp::TimerBase::SharedPtr schedule_timer;   //!< for startup schedule fetch
-  rclcpp::TimerBase::SharedPtr timeout_timer;   //!< for timeout resend
+  uint64_t timeout_txn;   //!< transaction slot for timeout resend
 
   const std::chrono::nanoseconds BOOTUP_TIME;
   const std::chrono::nanoseconds LIST_TIMEOUT;
@@ -523,11 +593,62 @@ private:
     RXLIST,
     RXPARAM,
     RXPARAM_TIMEDOUT,
+    RXPCK,
     TXPARAM
   };
 
   std::unordered_map<std::string, Parameter> parameters;
   std::list<uint16_t> parameters_missing_idx;
+
+  // Bulk pull over MAVLink-FTP (@PARAM/param.pck): one ~20 kB
+  // transfer instead of a PARAM_VALUE stream. Minimal dedicated FTP
+  // read path; any failure latches a fallback to the message-based
+  // protocol.
+  static constexpr auto PARAM_PCK_PATH = "@PARAM/param.pck";
+
+  struct FtpPayloadHeader
+  {
+    uint16_t seqNumber;
+    uint8_t session;
+    uint8_t opcode;
+    uint8_t size;
+    uint8_t req_opcode;
+    uint8_t padding[2];
+    uint32_t offset;
+    uint8_t data[];
+  };
+
+  enum FtpOpcode : uint8_t
+  {
+    kCmdNone = 0,
+    kCmdTerminateSession = 1,
+    kCmdOpenFileRO = 4,
+    kCmdReadFile = 5,
+    kRspAck = 128,
+    kRspNak = 129,
+  };
+
+  //! FTP Nak error code for end-of-file
+  static constexpr uint8_t kErrEOF = 6;
+
+  // Persistent parameter cache: warm-starts the table from disk and
+  // lets the validation pull run as a delta update.
+  std::string cache_dir;
+  bool cache_warm;
+
+  bool use_ftp_pull;
+  bool ftp_pull_failed;
+  uint16_t ftp_seq;
+  uint8_t ftp_session;
+  std::vector<uint8_t> ftp_data;
+
+  // Sliding-window re-request pipeline: keep several
+  // PARAM_REQUEST_READ in flight for missing indices, with AIMD
+  // window sizing from observed loss.
+  static constexpr size_t WINDOW_MIN = 2;
+  static constexpr size_t WINDOW_MAX = 32;
+  size_t param_request_window;
+  std::set<uint16_t> param_requested_idx;
   std::unordered_map<std::string, std::shared_ptr<ParamSetOpt>> set_parameters;
   ssize_t param_count;
   PR param_state;
@@ -558,6 +679,7 @@ private:
         }
 
         param_event_pub->publish(p.to_event_msg());
+        queue_event(p.to_event_msg());
         {
           rcl_interfaces::msg::ParameterEvent evt{};
           evt.stamp = p.stamp;
@@ -609,6 +731,15 @@ private:
     {
       // we received first param. setup list timeout
       if (param_state == PR::RXLIST) {
+        if (cache_warm && param_count != pmsg.param_count) {
+          // cheap validity check failed: drop the cached table
+          RCLCPP_WARN(
+            lg, "PR: cache: count mismatch (%zd != %u), invalidated",
+            param_count, pmsg.param_count);
+          cache_warm = false;
+          clear_all_parameters();
+        }
+
         param_count = pmsg.param_count;
         param_state = PR::RXPARAM;
 
@@ -655,13 +786,18 @@ private:
           lg,
           missed > 0, "PR: parameters list received, but %zd parametars are missed",
           missed);
+        save_param_cache();
         go_idle();
         list_receiving.notify_all();
 
       } else if (param_state == PR::RXPARAM_TIMEDOUT) {
-        uint16_t first_miss_idx = parameters_missing_idx.front();
-        RCLCPP_DEBUG(lg, "PR: requesting next timed out parameter idx=%u", first_miss_idx);
-        param_request_read("", first_miss_idx);
+        param_requested_idx.erase(pmsg.param_index);
+
+        // delivery: grow the window additively and top it back up
+        if (param_request_window < WINDOW_MAX) {
+          param_request_window++;
+        }
+        request_missing_window();
       }
     }
   }
@@ -678,6 +814,26 @@ private:
     uas->send_message(rql);
   }
 
+  /**
+   * Keep up to param_request_window requests for missing indices in
+   * flight; out-of-order completions are tracked against
+   * parameters_missing_idx.
+   */
+  void request_missing_window()
+  {
+    for (auto idx : parameters_missing_idx) {
+      if (param_requested_idx.size() >= param_request_window) {
+        break;
+      }
+      if (param_requested_idx.find(idx) != param_requested_idx.end()) {
+        continue;
+      }
+
+      param_requested_idx.insert(idx);
+      param_request_read("", idx);
+    }
+  }
+
   void param_request_read(const std::string & id, int16_t index = -1)
   {
     rcpputils::require_true(index >= -1);
@@ -734,6 +890,10 @@ private:
     lock_guard lock(mutex);
 
     if (connected) {
+      // warm start: publish the cached table immediately, the
+      // scheduled pull then only applies deltas
+      node->get_parameter("param_cache_dir", cache_dir);
+      cache_warm = load_param_cache();
       schedule_pull();
     } else {
       schedule_timer->cancel();
@@ -758,22 +918,374 @@ private:
     }
 
     RCLCPP_DEBUG(get_logger(), "PR: start scheduled pull");
+
+    node->get_parameter("param_use_ftp", use_ftp_pull);
+    if (use_ftp_pull && !ftp_pull_failed) {
+      start_ftp_pull();
+    } else {
+      start_message_pull();
+    }
+  }
+
+  void start_message_pull()
+  {
     param_state = PR::RXLIST;
     param_rx_retries = RETRIES_COUNT;
-    clear_all_parameters();
+    if (!cache_warm) {
+      clear_all_parameters();
+    }
 
     restart_timeout_timer();
     param_request_list();
   }
 
+  /* -*- persistent parameter cache -*- */
+
+  std::string cache_path()
+  {
+    return utils::format(
+      "%s/params_%u_%u.pcache", cache_dir.c_str(),
+      uas->get_tgt_system(), utils::enum_value(uas->get_autopilot()));
+  }
+
+  /**
+   * Cache format: "MRPC" magic, uint16 count; per parameter:
+   * uint8 name length, name, uint8 rclcpp type, 8 value bytes.
+   */
+  void save_param_cache()
+  {
+    if (cache_dir.empty()) {
+      return;
+    }
+
+    auto path = cache_path();
+    FILE * f = std::fopen(path.c_str(), "wb");
+    if (f == nullptr) {
+      RCLCPP_WARN(get_logger(), "PR: cache: can't write %s", path.c_str());
+      return;
+    }
+
+    std::fwrite("MRPC", 4, 1, f);
+    const uint16_t count = parameters.size();
+    std::fwrite(&count, sizeof(count), 1, f);
+
+    for (auto & kv : parameters) {
+      auto & p = kv.second;
+      const uint8_t name_len = p.param_id.size();
+      const uint8_t type = utils::enum_value(p.param_value.get_type());
+
+      union {
+        int64_t i;
+        double d;
+      } uv {};
+      if (p.param_value.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER) {
+        uv.i = p.param_value.get<int64_t>();
+      } else if (p.param_value.get_type() == rclcpp::ParameterType::PARAMETER_DOUBLE) {
+        uv.d = p.param_value.get<double>();
+      } else {
+        continue;
+      }
+
+      std::fwrite(&name_len, 1, 1, f);
+      std::fwrite(p.param_id.data(), 1, name_len, f);
+      std::fwrite(&type, 1, 1, f);
+      std::fwrite(&uv, 8, 1, f);
+    }
+
+    std::fclose(f);
+    RCLCPP_DEBUG(get_logger(), "PR: cache: saved %u parameters", count);
+  }
+
+  bool load_param_cache()
+  {
+    if (cache_dir.empty()) {
+      return false;
+    }
+
+    auto path = cache_path();
+    FILE * f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+      return false;
+    }
+
+    char magic[4];
+    uint16_t count = 0;
+    if (std::fread(magic, 4, 1, f) != 1 || std::memcmp(magic, "MRPC", 4) != 0 ||
+      std::fread(&count, sizeof(count), 1, f) != 1)
+    {
+      std::fclose(f);
+      return false;
+    }
+
+    auto stamp = node->now();
+    parameters.clear();
+
+    for (uint16_t idx = 0; idx < count; idx++) {
+      uint8_t name_len = 0, type = 0;
+      char name[256];
+
+      union {
+        int64_t i;
+        double d;
+      } uv {};
+
+      if (std::fread(&name_len, 1, 1, f) != 1 ||
+        std::fread(name, 1, name_len, f) != name_len ||
+        std::fread(&type, 1, 1, f) != 1 ||
+        std::fread(&uv, 8, 1, f) != 1)
+      {
+        std::fclose(f);
+        parameters.clear();
+        return false;
+      }
+
+      rclcpp::ParameterValue value;
+      if (type == utils::enum_value(rclcpp::ParameterType::PARAMETER_INTEGER)) {
+        value = rclcpp::ParameterValue(uv.i);
+      } else if (type == utils::enum_value(rclcpp::ParameterType::PARAMETER_DOUBLE)) {
+        value = rclcpp::ParameterValue(uv.d);
+      } else {
+        std::fclose(f);
+        parameters.clear();
+        return false;
+      }
+
+      std::string param_id(name, name_len);
+      auto pp = parameters.emplace(param_id, Parameter(param_id, idx, count, value));
+      pp.first->second.stamp = stamp;
+      param_event_pub->publish(pp.first->second.to_event_msg());
+      queue_event(pp.first->second.to_event_msg());
+    }
+
+    std::fclose(f);
+    param_count = count;
+
+    RCLCPP_INFO(
+      get_logger(), "PR: cache: warm start with %u parameters from %s",
+      count, path.c_str());
+    return true;
+  }
+
+  /* -*- bulk pull over MAVLink-FTP -*- */
+
+  void start_ftp_pull()
+  {
+    RCLCPP_INFO(get_logger(), "PR: bulk pull of %s", PARAM_PCK_PATH);
+
+    param_state = PR::RXPCK;
+    param_rx_retries = RETRIES_COUNT;
+    clear_all_parameters();
+
+    ftp_data.clear();
+    ftp_session = 0;
+
+    restart_timeout_timer();
+    ftp_send_open();
+  }
+
+  void ftp_abort_to_message_pull(const char * reason)
+  {
+    RCLCPP_WARN(get_logger(), "PR: bulk pull failed (%s), falling back", reason);
+
+    ftp_pull_failed = true;
+    start_message_pull();
+  }
+
+  void ftp_send(mavlink::common::msg::FILE_TRANSFER_PROTOCOL & ftp, FtpPayloadHeader * hdr)
+  {
+    hdr->seqNumber = ftp_seq++;
+    hdr->req_opcode = kCmdNone;
+    uas->msg_set_target(ftp);
+    ftp.target_network = 0;
+
+    uas->send_message(ftp);
+  }
+
+  void ftp_send_open()
+  {
+    mavlink::common::msg::FILE_TRANSFER_PROTOCOL ftp{};
+    auto hdr = reinterpret_cast<FtpPayloadHeader *>(ftp.payload.data());
+
+    const std::string path(PARAM_PCK_PATH);
+    hdr->opcode = kCmdOpenFileRO;
+    hdr->size = path.size();
+    std::memcpy(hdr->data, path.data(), path.size());
+
+    ftp_send(ftp, hdr);
+  }
+
+  void ftp_send_read()
+  {
+    mavlink::common::msg::FILE_TRANSFER_PROTOCOL ftp{};
+    auto hdr = reinterpret_cast<FtpPayloadHeader *>(ftp.payload.data());
+
+    hdr->opcode = kCmdReadFile;
+    hdr->session = ftp_session;
+    hdr->offset = ftp_data.size();
+    hdr->size = 239;    // payload capacity minus header
+
+    ftp_send(ftp, hdr);
+  }
+
+  void ftp_send_terminate()
+  {
+    mavlink::common::msg::FILE_TRANSFER_PROTOCOL ftp{};
+    auto hdr = reinterpret_cast<FtpPayloadHeader *>(ftp.payload.data());
+
+    hdr->opcode = kCmdTerminateSession;
+    hdr->session = ftp_session;
+
+    ftp_send(ftp, hdr);
+  }
+
+  void handle_file_transfer_protocol(
+    const mavlink::mavlink_message_t * msg [[maybe_unused]],
+    mavlink::common::msg::FILE_TRANSFER_PROTOCOL & ftp,
+    plugin::filter::SystemAndOk filter [[maybe_unused]])
+  {
+    lock_guard lock(mutex);
+
+    // the ftp plugin owns all other transfers
+    if (param_state != PR::RXPCK) {
+      return;
+    }
+
+    auto hdr = reinterpret_cast<const FtpPayloadHeader *>(ftp.payload.data());
+
+    if (hdr->opcode == kRspAck && hdr->req_opcode == kCmdOpenFileRO) {
+      ftp_session = hdr->session;
+      restart_timeout_timer();
+      ftp_send_read();
+    } else if (hdr->opcode == kRspAck && hdr->req_opcode == kCmdReadFile) {
+      if (hdr->offset != ftp_data.size()) {
+        // stale or duplicated chunk
+        return;
+      }
+
+      ftp_data.insert(ftp_data.end(), hdr->data, hdr->data + hdr->size);
+      restart_timeout_timer();
+      ftp_send_read();
+    } else if (hdr->opcode == kRspNak && hdr->req_opcode == kCmdReadFile &&
+      hdr->size >= 1 && hdr->data[0] == kErrEOF)
+    {
+      ftp_send_terminate();
+      uas->transactions().cancel(timeout_txn);
+
+      if (decode_param_pck()) {
+        RCLCPP_INFO(
+          get_logger(), "PR: bulk pull done, %zu parameters (%zu bytes)",
+          parameters.size(), ftp_data.size());
+        save_param_cache();
+        go_idle();
+        list_receiving.notify_all();
+      } else {
+        ftp_abort_to_message_pull("decode error");
+      }
+    } else if (hdr->opcode == kRspNak) {
+      ftp_abort_to_message_pull("request refused");
+    }
+  }
+
+  /**
+   * Decode ArduPilot packed parameter file:
+   * uint16 magic (0x671B), uint16 num_params, uint16 total_params;
+   * then per parameter:
+   * - uint8: AP type in the low nibble (1 int8, 2 int16, 3 int32,
+   *   4 float), flags in the high nibble;
+   * - uint8: chars shared with the previous name in the low nibble,
+   *   count of new chars - 1 in the high nibble;
+   * - the new name chars, then the little-endian value.
+   * Zero bytes between entries are alignment padding.
+   */
+  bool decode_param_pck()
+  {
+    if (ftp_data.size() < 6) {
+      return false;
+    }
+
+    const uint16_t magic = ftp_data[0] | (ftp_data[1] << 8);
+    const uint16_t num_params = ftp_data[2] | (ftp_data[3] << 8);
+    const uint16_t total_params = ftp_data[4] | (ftp_data[5] << 8);
+
+    if (magic != 0x671B) {
+      return false;
+    }
+
+    auto stamp = node->now();
+    std::string prev_name;
+    size_t pos = 6;
+    uint16_t decoded = 0;
+
+    while (pos < ftp_data.size() && decoded < num_params) {
+      if (ftp_data[pos] == 0) {
+        pos++;    // padding
+        continue;
+      }
+
+      if (pos + 2 > ftp_data.size()) {
+        return false;
+      }
+
+      const uint8_t ptype = ftp_data[pos] & 0x0f;
+      const uint8_t common_len = ftp_data[pos + 1] & 0x0f;
+      const uint8_t new_len = (ftp_data[pos + 1] >> 4) + 1;
+      pos += 2;
+
+      static constexpr size_t value_sizes[] = {0, 1, 2, 4, 4};
+      if (ptype < 1 || ptype > 4 ||
+        pos + new_len + value_sizes[ptype] > ftp_data.size() ||
+        common_len > prev_name.size())
+      {
+        return false;
+      }
+
+      std::string name = prev_name.substr(0, common_len) +
+        std::string(reinterpret_cast<const char *>(&ftp_data[pos]), new_len);
+      pos += new_len;
+
+      union {
+        uint32_t u32;
+        int32_t i32;
+        float f;
+      } uv {};
+      std::memcpy(&uv.u32, &ftp_data[pos], value_sizes[ptype]);
+      pos += value_sizes[ptype];
+
+      rclcpp::ParameterValue value;
+      switch (ptype) {
+        case 1: value = rclcpp::ParameterValue(static_cast<int>(int8_t(uv.u32))); break;
+        case 2: value = rclcpp::ParameterValue(static_cast<int>(int16_t(uv.u32))); break;
+        case 3: value = rclcpp::ParameterValue(static_cast<int>(uv.i32)); break;
+        default: value = rclcpp::ParameterValue(static_cast<double>(uv.f)); break;
+      }
+
+      auto pp = parameters.emplace(name, Parameter(name, decoded, total_params, value));
+      pp.first->second.stamp = stamp;
+      param_event_pub->publish(pp.first->second.to_event_msg());
+      queue_event(pp.first->second.to_event_msg());
+
+      prev_name = std::move(name);
+      decoded++;
+    }
+
+    param_count = total_params;
+    return decoded == num_params;
+  }
+
   void timeout_cb()
   {
     lock_guard lock(mutex);
-    timeout_timer->cancel();
+    uas->transactions().cancel(timeout_txn);
 
     auto lg = get_logger();
 
-    if (param_state == PR::RXLIST && param_rx_retries > 0) {
+    if (param_state == PR::RXPCK) {
+      // robustness beats speed here: no chunk retry bookkeeping,
+      // any stall falls back to the message-based protocol
+      ftp_abort_to_message_pull("timeout");
+      return;
+
+    } else if (param_state == PR::RXLIST && param_rx_retries > 0) {
       param_rx_retries--;
       RCLCPP_WARN(lg, "PR: request list timeout, retries left %zu", param_rx_retries);
 
@@ -793,13 +1305,19 @@ private:
 
       param_state = PR::RXPARAM_TIMEDOUT;
       uint16_t first_miss_idx = parameters_missing_idx.front();
+
+      // loss observed: halve the window (multiplicative decrease)
+      param_request_window =
+        (param_request_window / 2 > WINDOW_MIN) ? param_request_window / 2 : WINDOW_MIN;
+      param_requested_idx.clear();
+
       if (param_rx_retries > 0) {
         param_rx_retries--;
         RCLCPP_WARN(
           lg, "PR: request param #%u timeout, retries left %zu, and %zu params still missing",
           first_miss_idx, param_rx_retries, parameters_missing_idx.size());
         restart_timeout_timer();
-        param_request_read("", first_miss_idx);
+        request_missing_window();
 
       } else {
         RCLCPP_ERROR(lg, "PR: request param #%u completely missing.", first_miss_idx);
@@ -807,12 +1325,11 @@ private:
         restart_timeout_timer();
         if (!parameters_missing_idx.empty()) {
           param_rx_retries = RETRIES_COUNT;
-          first_miss_idx = parameters_missing_idx.front();
 
           RCLCPP_WARN(
-            lg, "PR: %zu params still missing, trying to request next: #%u",
-            parameters_missing_idx.size(), first_miss_idx);
-          param_request_read("", first_miss_idx);
+            lg, "PR: %zu params still missing, requesting a window of them",
+            parameters_missing_idx.size());
+          request_missing_window();
         }
       }
 
@@ -848,13 +1365,14 @@ private:
   void restart_timeout_timer()
   {
     is_timedout = false;
-    timeout_timer->reset();
+    uas->transactions().arm(timeout_txn);
   }
 
   void go_idle()
   {
+    param_requested_idx.clear();
     param_state = PR::IDLE;
-    timeout_timer->cancel();
+    uas->transactions().cancel(timeout_txn);
   }
 
   bool wait_fetch_all()
@@ -136,6 +136,12 @@ private:
       return;
     }
 
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::RXLIST;
     wp_count = 0;
     restart_timeout_timer();
@@ -168,6 +174,12 @@ private:
     }
 
     // Full waypoint update
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::TXLIST;
 
     send_waypoints.clear();
@@ -200,6 +212,12 @@ private:
       return;
     }
 
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::CLEAR;
     restart_timeout_timer();
 
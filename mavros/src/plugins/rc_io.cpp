@@ -46,6 +46,25 @@ public:
   {
     rc_in_pub = node->create_publisher<mavros_msgs::msg::RCIn>("~/in", 10);
     rc_out_pub = node->create_publisher<mavros_msgs::msg::RCOut>("~/out", 10);
+
+    // publish policies: "passthrough" (default), "on_change", "throttle"
+    std::string policy;
+    double rate;
+    node->declare_parameter("in_policy", "passthrough");
+    node->declare_parameter("in_rate", 10.0);
+    node->declare_parameter("out_policy", "passthrough");
+    node->declare_parameter("out_rate", 10.0);
+
+    auto channels_equal = [](const auto & lhs, const auto & rhs) {
+        return lhs.channels == rhs.channels;
+      };
+
+    node->get_parameter("in_policy", policy);
+    node->get_parameter("in_rate", rate);
+    rc_in_gate.configure(policy, rate, channels_equal);
+    node->get_parameter("out_policy", policy);
+    node->get_parameter("out_rate", rate);
+    rc_out_gate.configure(policy, rate, channels_equal);
     override_sub = node->create_subscription<mavros_msgs::msg::OverrideRCIn>(
       "~/override", 10, std::bind(
         &RCIOPlugin::override_cb, this,
@@ -73,6 +92,9 @@ private:
 
   rclcpp::Publisher<mavros_msgs::msg::RCIn>::SharedPtr rc_in_pub;
   rclcpp::Publisher<mavros_msgs::msg::RCOut>::SharedPtr rc_out_pub;
+
+  plugin::PublishGate<mavros_msgs::msg::RCIn> rc_in_gate;
+  plugin::PublishGate<mavros_msgs::msg::RCOut> rc_out_gate;
   rclcpp::Subscription<mavros_msgs::msg::OverrideRCIn>::SharedPtr override_sub;
 
   /* -*- rx handlers -*- */
@@ -113,7 +135,9 @@ private:
     rcin_msg.rssi = port.rssi;
     rcin_msg.channels = raw_rc_in;
 
-    rc_in_pub->publish(rcin_msg);
+    if (rc_in_gate.accept(rcin_msg, node->now())) {
+      rc_in_pub->publish(rcin_msg);
+    }
   }
 
   void handle_rc_channels(
@@ -173,7 +197,9 @@ private:
     rcin_msg.rssi = channels.rssi;
     rcin_msg.channels = raw_rc_in;
 
-    rc_in_pub->publish(rcin_msg);
+    if (rc_in_gate.accept(rcin_msg, node->now())) {
+      rc_in_pub->publish(rcin_msg);
+    }
   }
 
   void handle_servo_output_raw(
@@ -235,7 +261,9 @@ private:
     rcout_msg.header.stamp = uas->synchronise_stamp(time_usec);
     rcout_msg.channels = raw_rc_out;
 
-    rc_out_pub->publish(rcout_msg);
+    if (rc_out_gate.accept(rcout_msg, node->now())) {
+      rc_out_pub->publish(rcout_msg);
+    }
   }
 
   /* -*- callbacks -*- */
@@ -49,6 +49,10 @@ public:
 
     auto sensor_qos = rclcpp::SensorDataQoS();
 
+    // >0: transmit the newest setpoint from a dedicated thread at
+    // exactly this rate instead of on subscription callbacks
+    node->declare_parameter("paced_tx_rate", 0.0);
+
     accel_sub = node->create_subscription<geometry_msgs::msg::Vector3Stamped>(
       "~/accel", sensor_qos, std::bind(
         &SetpointAccelerationPlugin::accel_cb, this,
@@ -102,12 +106,35 @@ private:
 
   /* -*- callbacks -*- */
 
+  //! paced transmission of the newest acceleration setpoint
+  plugin::SetpointPacer<geometry_msgs::msg::Vector3Stamped> pacer;
+
   void accel_cb(const geometry_msgs::msg::Vector3Stamped::SharedPtr req)
+  {
+    double rate = 0.0;
+    node->get_parameter("paced_tx_rate", rate);
+
+    if (rate > 0.0) {
+      if (!pacer.is_running()) {
+        pacer.start(
+          rate, [this](const geometry_msgs::msg::Vector3Stamped & sp) {
+            dispatch_setpoint(sp);
+          });
+      }
+
+      pacer.update(*req);
+      return;
+    }
+
+    dispatch_setpoint(*req);
+  }
+
+  void dispatch_setpoint(const geometry_msgs::msg::Vector3Stamped & req)
   {
     Eigen::Vector3d accel_enu;
 
-    tf2::fromMsg(req->vector, accel_enu);
-    send_setpoint_acceleration(req->header.stamp, accel_enu);
+    tf2::fromMsg(req.vector, accel_enu);
+    send_setpoint_acceleration(req.header.stamp, accel_enu);
   }
 };
 
@@ -33,6 +33,10 @@
 #include "geometry_msgs/msg/twist_stamped.hpp"
 #include "mavros_msgs/msg/thrust.hpp"
 
+#include <atomic>
+
+#include <cmath>
+
 namespace mavros
 {
 namespace std_plugins
@@ -69,35 +73,75 @@ public:
         reverse_thrust = p.as_bool();
       });
 
+    // ApproximateTime queues, allocates and locks per sample and adds
+    // up to a queue depth of latency; set this to return to it.
+    node->declare_parameter("use_message_filters", false);
+    node->get_parameter("use_message_filters", use_message_filters);
+
     node_declate_and_watch_parameter(
-      "use_quaternion", false, [&](const rclcpp::Parameter & p) {
+      "use_quaternion", false, [&, qos](const rclcpp::Parameter & p) {
         auto use_quaternion = p.as_bool();
 
         pose_sub.unsubscribe();
         twist_sub.unsubscribe();
         sync_pose.reset();
         sync_twist.reset();
+        pose_raw_sub.reset();
+        twist_raw_sub.reset();
 
         if (use_quaternion) {
-          /**
-           * @brief Use message_filters to sync attitude and thrust msg coming from different topics
-           */
-          pose_sub.subscribe(node, "~/attitude", qos.get_rmw_qos_profile());
-
-          sync_pose = std::make_unique<SyncPoseThrust>(SyncPoseThrustPolicy(10), pose_sub, th_sub);
-          sync_pose->registerCallback(&SetpointAttitudePlugin::attitude_pose_cb, this);
-
+          if (use_message_filters) {
+            /**
+             * @brief Use message_filters to sync attitude and thrust msg
+             * coming from different topics
+             */
+            pose_sub.subscribe(node, "~/attitude", qos.get_rmw_qos_profile());
+
+            sync_pose =
+            std::make_unique<SyncPoseThrust>(SyncPoseThrustPolicy(10), pose_sub, th_sub);
+            sync_pose->registerCallback(
+              [this](const geometry_msgs::msg::PoseStamped::SharedPtr pose_msg,
+              const mavros_msgs::msg::Thrust::SharedPtr thrust_msg) {
+                attitude_pose_cb(*pose_msg, *thrust_msg);
+              });
+          } else {
+            pose_raw_sub = node->create_subscription<geometry_msgs::msg::PoseStamped>(
+              "~/attitude", qos,
+              [this](const geometry_msgs::msg::PoseStamped::SharedPtr msg) {
+                pair_pose(*msg);
+              });
+          }
         } else {
-          twist_sub.subscribe(node, "~/cmd_vel", qos.get_rmw_qos_profile());
-
-          sync_twist =
-          std::make_unique<SyncTwistThrust>(SyncTwistThrustPolicy(10), twist_sub, th_sub);
-          sync_twist->registerCallback(&SetpointAttitudePlugin::attitude_twist_cb, this);
+          if (use_message_filters) {
+            twist_sub.subscribe(node, "~/cmd_vel", qos.get_rmw_qos_profile());
+
+            sync_twist =
+            std::make_unique<SyncTwistThrust>(SyncTwistThrustPolicy(10), twist_sub, th_sub);
+            sync_twist->registerCallback(
+              [this](const geometry_msgs::msg::TwistStamped::SharedPtr req,
+              const mavros_msgs::msg::Thrust::SharedPtr thrust_msg) {
+                attitude_twist_cb(*req, *thrust_msg);
+              });
+          } else {
+            twist_raw_sub = node->create_subscription<geometry_msgs::msg::TwistStamped>(
+              "~/cmd_vel", qos,
+              [this](const geometry_msgs::msg::TwistStamped::SharedPtr msg) {
+                pair_twist(*msg);
+              });
+          }
         }
       });
 
-    // thrust msg subscriber to sync
-    th_sub.subscribe(node, "~/thrust", qos.get_rmw_qos_profile());
+    if (use_message_filters) {
+      // thrust msg subscriber to sync
+      th_sub.subscribe(node, "~/thrust", qos.get_rmw_qos_profile());
+    } else {
+      thrust_raw_sub = node->create_subscription<mavros_msgs::msg::Thrust>(
+        "~/thrust", qos,
+        [this](const mavros_msgs::msg::Thrust::SharedPtr msg) {
+          pair_thrust(*msg);
+        });
+    }
   }
 
   Subscriptions get_subscriptions() override
@@ -115,6 +159,102 @@ private:
   std::unique_ptr<SyncPoseThrust> sync_pose;
   std::unique_ptr<SyncTwistThrust> sync_twist;
 
+  rclcpp::Subscription<geometry_msgs::msg::PoseStamped>::SharedPtr pose_raw_sub;
+  rclcpp::Subscription<geometry_msgs::msg::TwistStamped>::SharedPtr twist_raw_sub;
+  rclcpp::Subscription<mavros_msgs::msg::Thrust>::SharedPtr thrust_raw_sub;
+
+  bool use_message_filters = false;
+
+  /* -*- latest-value pairing cell -*-
+   *
+   * Default pairing: each input stores its newest sample under a
+   * spinlock (critical section is a message copy), and whichever
+   * input arrives last fires the setpoint immediately if its partner
+   * is within the staleness bound — no queue, no queue-depth of
+   * latency.
+   */
+  static constexpr double PAIR_STALENESS_SEC = 0.1;
+
+  std::atomic_flag cell_lock = ATOMIC_FLAG_INIT;
+  geometry_msgs::msg::PoseStamped cell_pose;
+  geometry_msgs::msg::TwistStamped cell_twist;
+  mavros_msgs::msg::Thrust cell_thrust;
+  bool cell_have_pose = false;
+  bool cell_have_twist = false;
+  bool cell_have_thrust = false;
+
+  static bool pair_fresh(
+    const builtin_interfaces::msg::Time & a,
+    const builtin_interfaces::msg::Time & b)
+  {
+    return std::abs((rclcpp::Time(a) - rclcpp::Time(b)).seconds()) <= PAIR_STALENESS_SEC;
+  }
+
+  void pair_pose(const geometry_msgs::msg::PoseStamped & msg)
+  {
+    geometry_msgs::msg::PoseStamped pose;
+    mavros_msgs::msg::Thrust thrust;
+    bool ready;
+
+    while (cell_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    cell_pose = msg;
+    cell_have_pose = true;
+    ready = cell_have_thrust;
+    pose = cell_pose;
+    thrust = cell_thrust;
+    cell_lock.clear(std::memory_order_release);
+
+    if (ready && pair_fresh(pose.header.stamp, thrust.header.stamp)) {
+      attitude_pose_cb(pose, thrust);
+    }
+  }
+
+  void pair_twist(const geometry_msgs::msg::TwistStamped & msg)
+  {
+    geometry_msgs::msg::TwistStamped twist;
+    mavros_msgs::msg::Thrust thrust;
+    bool ready;
+
+    while (cell_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    cell_twist = msg;
+    cell_have_twist = true;
+    ready = cell_have_thrust;
+    twist = cell_twist;
+    thrust = cell_thrust;
+    cell_lock.clear(std::memory_order_release);
+
+    if (ready && pair_fresh(twist.header.stamp, thrust.header.stamp)) {
+      attitude_twist_cb(twist, thrust);
+    }
+  }
+
+  void pair_thrust(const mavros_msgs::msg::Thrust & msg)
+  {
+    geometry_msgs::msg::PoseStamped pose;
+    geometry_msgs::msg::TwistStamped twist;
+    mavros_msgs::msg::Thrust thrust;
+    bool have_pose, have_twist;
+
+    while (cell_lock.test_and_set(std::memory_order_acquire)) {
+    }
+    cell_thrust = msg;
+    cell_have_thrust = true;
+    have_pose = cell_have_pose;
+    have_twist = cell_have_twist;
+    pose = cell_pose;
+    twist = cell_twist;
+    thrust = cell_thrust;
+    cell_lock.clear(std::memory_order_release);
+
+    if (have_pose && pair_fresh(pose.header.stamp, thrust.header.stamp)) {
+      attitude_pose_cb(pose, thrust);
+    } else if (have_twist && pair_fresh(twist.header.stamp, thrust.header.stamp)) {
+      attitude_twist_cb(twist, thrust);
+    }
+  }
+
   bool reverse_thrust;
   float normalized_thrust;
 
@@ -196,26 +336,26 @@ private:
   /* -*- callbacks -*- */
 
   void attitude_pose_cb(
-    const geometry_msgs::msg::PoseStamped::SharedPtr pose_msg,
-    const mavros_msgs::msg::Thrust::SharedPtr thrust_msg)
+    const geometry_msgs::msg::PoseStamped & pose_msg,
+    const mavros_msgs::msg::Thrust & thrust_msg)
   {
     Eigen::Affine3d tr;
-    tf2::fromMsg(pose_msg->pose, tr);
+    tf2::fromMsg(pose_msg.pose, tr);
 
-    if (is_normalized(thrust_msg->thrust)) {
-      send_attitude_quaternion(pose_msg->header.stamp, tr, thrust_msg->thrust);
+    if (is_normalized(thrust_msg.thrust)) {
+      send_attitude_quaternion(pose_msg.header.stamp, tr, thrust_msg.thrust);
     }
   }
 
   void attitude_twist_cb(
-    const geometry_msgs::msg::TwistStamped::SharedPtr req,
-    const mavros_msgs::msg::Thrust::SharedPtr thrust_msg)
+    const geometry_msgs::msg::TwistStamped & req,
+    const mavros_msgs::msg::Thrust & thrust_msg)
   {
     Eigen::Vector3d ang_vel;
-    tf2::fromMsg(req->twist.angular, ang_vel);
+    tf2::fromMsg(req.twist.angular, ang_vel);
 
-    if (is_normalized(thrust_msg->thrust)) {
-      send_attitude_ang_velocity(req->header.stamp, ang_vel, thrust_msg->thrust);
+    if (is_normalized(thrust_msg.thrust)) {
+      send_attitude_ang_velocity(req.header.stamp, ang_vel, thrust_msg.thrust);
     }
   }
 };
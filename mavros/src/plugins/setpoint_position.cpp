@@ -68,6 +68,10 @@ public:
 
     auto sensor_qos = rclcpp::SensorDataQoS();
 
+    // >0: transmit the newest setpoint from a dedicated thread at
+    // exactly this rate instead of on subscription callbacks
+    node->declare_parameter("paced_tx_rate", 0.0);
+
     setpoint_sub = node->create_subscription<geometry_msgs::msg::PoseStamped>(
       "~/local", sensor_qos, std::bind(
         &SetpointPositionPlugin::setpoint_cb, this,
@@ -173,12 +177,35 @@ private:
 
   /* -*- callbacks -*- */
 
+  //! paced transmission of the newest local setpoint
+  plugin::SetpointPacer<geometry_msgs::msg::PoseStamped> pacer;
+
   void setpoint_cb(const geometry_msgs::msg::PoseStamped::SharedPtr req)
+  {
+    double rate = 0.0;
+    node->get_parameter("paced_tx_rate", rate);
+
+    if (rate > 0.0) {
+      if (!pacer.is_running()) {
+        pacer.start(
+          rate, [this](const geometry_msgs::msg::PoseStamped & sp) {
+            dispatch_setpoint(sp);
+          });
+      }
+
+      pacer.update(*req);
+      return;
+    }
+
+    dispatch_setpoint(*req);
+  }
+
+  void dispatch_setpoint(const geometry_msgs::msg::PoseStamped & req)
   {
     Eigen::Affine3d tr;
-    tf2::fromMsg(req->pose, tr);
+    tf2::fromMsg(req.pose, tr);
 
-    send_position_target(req->header.stamp, tr);
+    send_position_target(req.header.stamp, tr);
   }
 
   /**
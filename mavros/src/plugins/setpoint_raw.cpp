@@ -55,6 +55,10 @@ public:
     node->declare_parameter("thrust_scaling");
     // node->declare_parameter("thrust_scaling", 1.0);
 
+    // >0: transmit the newest local setpoint from a dedicated thread
+    // at exactly this rate instead of on subscription callbacks
+    node->declare_parameter("paced_tx_rate", 0.0);
+
     local_sub = node->create_subscription<mavros_msgs::msg::PositionTarget>(
       "~/local", sensor_qos, std::bind(
         &SetpointRawPlugin::local_cb, this,
@@ -93,6 +97,8 @@ private:
   friend class plugin::SetAttitudeTargetMixin<SetpointRawPlugin>;
 
   rclcpp::Subscription<mavros_msgs::msg::PositionTarget>::SharedPtr local_sub;
+  //! paced local setpoint transmission (see paced_tx_rate)
+  plugin::SetpointPacer<mavros_msgs::msg::PositionTarget> local_pacer;
   rclcpp::Subscription<mavros_msgs::msg::GlobalPositionTarget>::SharedPtr global_sub;
   rclcpp::Subscription<mavros_msgs::msg::AttitudeTarget>::SharedPtr attitude_sub;
 
@@ -192,8 +198,29 @@ private:
   /* -*- callbacks -*- */
 
   void local_cb(const mavros_msgs::msg::PositionTarget::SharedPtr req)
+  {
+    double rate = 0.0;
+    node->get_parameter("paced_tx_rate", rate);
+
+    if (rate > 0.0) {
+      if (!local_pacer.is_running()) {
+        local_pacer.start(
+          rate, [this](const mavros_msgs::msg::PositionTarget & sp) {
+            send_local(sp);
+          });
+      }
+
+      local_pacer.update(*req);
+      return;
+    }
+
+    send_local(*req);
+  }
+
+  void send_local(const mavros_msgs::msg::PositionTarget & req_msg)
   {
     using mavros_msgs::msg::PositionTarget;
+    const auto * req = &req_msg;
 
     Eigen::Vector3d position, velocity, af;
     float yaw, yaw_rate;
@@ -110,8 +110,21 @@ private:
 
   trajectory_msgs::msg::MultiDOFJointTrajectory::SharedPtr trajectory_target_msg;
 
-  V_Point::const_iterator setpoint_target;
-  V_Point::const_iterator next_setpoint_target;
+  //! One preprocessed trajectory point, ready for the mixin call.
+  struct PackedSetpoint
+  {
+    uint16_t type_mask;
+    Eigen::Vector3d position;
+    Eigen::Vector3d velocity;
+    Eigen::Vector3d af;
+    float yaw;
+    float yaw_rate;
+    std::chrono::nanoseconds time_from_start;
+  };
+
+  //! trajectory transformed and packed once at receipt
+  std::vector<PackedSetpoint> packed_trajectory;
+  size_t packed_index = 0;
 
   std::string frame_id;
   MAV_FRAME mav_frame;
@@ -169,83 +182,97 @@ private:
 
     trajectory_target_msg = req;
 
+    // Ingest: run all frame transforms once and pack the trajectory
+    // into a flat array of mavlink-ready structs; the streaming
+    // timer then only copies structs.
+    pack_trajectory(*req);
+    if (packed_trajectory.empty()) {
+      trajectory_target_msg.reset();
+      return;
+    }
+
     // Read first duration of the setpoint and set the timer
-    setpoint_target = req->points.cbegin();
-    reset_timer(setpoint_target->time_from_start);
+    packed_index = 0;
+    reset_timer(packed_trajectory.front().time_from_start);
     publish_path(req);
   }
 
-  void reference_cb()
+  void pack_trajectory(const trajectory_msgs::msg::MultiDOFJointTrajectory & traj)
   {
     using mavlink::common::POSITION_TARGET_TYPEMASK;
-    lock_guard lock(mutex);
 
-    if (!trajectory_target_msg) {
-      return;
-    }
+    packed_trajectory.clear();
+    packed_trajectory.reserve(traj.points.size());
+
+    for (const auto & p : traj.points) {
+      PackedSetpoint sp{};
+      uint16_t type_mask = 0;
+
+      if (!p.transforms.empty()) {
+        sp.position = ftf::detail::transform_static_frame(
+          ftf::to_eigen(p.transforms[0].translation), transform);
+        sp.yaw = ftf::quaternion_get_yaw(
+          ftf::detail::transform_orientation(
+            ftf::to_eigen(p.transforms[0].rotation), transform));
+      } else {
+        type_mask = type_mask | uint16_t(POSITION_TARGET_TYPEMASK::X_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::Y_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::Z_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::YAW_IGNORE);
+      }
 
-    Eigen::Vector3d position, velocity, af;
-    Eigen::Quaterniond attitude;
-    float yaw_rate = 0;
-    uint16_t type_mask = 0;
-
-    if (!setpoint_target->transforms.empty()) {
-      position =
-        ftf::detail::transform_static_frame(
-        ftf::to_eigen(
-          setpoint_target->transforms[0].translation), transform);
-      attitude =
-        ftf::detail::transform_orientation(
-        ftf::to_eigen(
-          setpoint_target->transforms[0].rotation), transform);
+      if (!p.velocities.empty()) {
+        sp.velocity = ftf::detail::transform_static_frame(
+          ftf::to_eigen(p.velocities[0].linear), transform);
+        sp.yaw_rate = p.velocities[0].angular.z;
+      } else {
+        type_mask = type_mask | uint16_t(POSITION_TARGET_TYPEMASK::VX_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::VY_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::VZ_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::YAW_RATE_IGNORE);
+      }
 
-    } else {
-      type_mask = type_mask | uint16_t(POSITION_TARGET_TYPEMASK::X_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::Y_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::Z_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::YAW_IGNORE);
-    }
+      if (!p.accelerations.empty()) {
+        sp.af = ftf::detail::transform_static_frame(
+          ftf::to_eigen(p.accelerations[0].linear), transform);
+      } else {
+        type_mask = type_mask | uint16_t(POSITION_TARGET_TYPEMASK::AX_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::AY_IGNORE) |
+          uint16_t(POSITION_TARGET_TYPEMASK::AZ_IGNORE);
+      }
 
-    if (!setpoint_target->velocities.empty()) {
-      velocity =
-        ftf::detail::transform_static_frame(
-        ftf::to_eigen(
-          setpoint_target->velocities[0].linear), transform);
-      yaw_rate = setpoint_target->velocities[0].angular.z;
+      sp.type_mask = type_mask;
+      sp.time_from_start =
+        rclcpp::Duration(p.time_from_start).to_chrono<std::chrono::nanoseconds>();
 
-    } else {
-      type_mask = type_mask | uint16_t(POSITION_TARGET_TYPEMASK::VX_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::VY_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::VZ_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::YAW_RATE_IGNORE);
+      packed_trajectory.push_back(sp);
     }
+  }
 
-    if (!setpoint_target->accelerations.empty()) {
-      af =
-        ftf::detail::transform_static_frame(
-        ftf::to_eigen(
-          setpoint_target->accelerations[0].linear), transform);
+  void reference_cb()
+  {
+    lock_guard lock(mutex);
 
-    } else {
-      type_mask = type_mask | uint16_t(POSITION_TARGET_TYPEMASK::AX_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::AY_IGNORE) |
-        uint16_t(POSITION_TARGET_TYPEMASK::AZ_IGNORE);
+    if (!trajectory_target_msg || packed_index >= packed_trajectory.size()) {
+      return;
     }
 
+    // per-tick cost is a struct copy: all Eigen math ran at ingest
+    const auto & sp = packed_trajectory[packed_index];
+
     set_position_target_local_ned(
       get_time_boot_ms(),
       utils::enum_value(mav_frame),
-      type_mask,
-      position,
-      velocity,
-      af,
-      ftf::quaternion_get_yaw(attitude),
-      yaw_rate);
-
-    next_setpoint_target = setpoint_target + 1;
-    if (next_setpoint_target != trajectory_target_msg->points.cend()) {
-      reset_timer(setpoint_target->time_from_start);
-      setpoint_target = next_setpoint_target;
+      sp.type_mask,
+      sp.position,
+      sp.velocity,
+      sp.af,
+      sp.yaw,
+      sp.yaw_rate);
+
+    packed_index++;
+    if (packed_index < packed_trajectory.size()) {
+      reset_timer(sp.time_from_start);
     } else {
       trajectory_target_msg.reset();
     }
@@ -66,6 +66,10 @@ public:
     auto sensor_qos = rclcpp::SensorDataQoS();
 
     // cmd_vel usually is the topic used for velocity control in many controllers / planners
+    // >0: transmit the newest setpoint from a dedicated thread at
+    // exactly this rate instead of on subscription callbacks
+    node->declare_parameter("paced_tx_rate", 0.0);
+
     vel_sub = node->create_subscription<geometry_msgs::msg::TwistStamped>(
       "~/cmd_vel", sensor_qos, std::bind(
         &SetpointVelocityPlugin::vel_cb, this,
@@ -133,14 +137,37 @@ private:
 
   /* -*- callbacks -*- */
 
+  //! paced transmission of the newest velocity setpoint
+  plugin::SetpointPacer<geometry_msgs::msg::TwistStamped> pacer;
+
   void vel_cb(const geometry_msgs::msg::TwistStamped::SharedPtr req)
+  {
+    double rate = 0.0;
+    node->get_parameter("paced_tx_rate", rate);
+
+    if (rate > 0.0) {
+      if (!pacer.is_running()) {
+        pacer.start(
+          rate, [this](const geometry_msgs::msg::TwistStamped & sp) {
+            dispatch_setpoint(sp);
+          });
+      }
+
+      pacer.update(*req);
+      return;
+    }
+
+    dispatch_setpoint(*req);
+  }
+
+  void dispatch_setpoint(const geometry_msgs::msg::TwistStamped & req)
   {
     Eigen::Vector3d vel_enu;
 
-    tf2::fromMsg(req->twist.linear, vel_enu);
+    tf2::fromMsg(req.twist.linear, vel_enu);
     send_setpoint_velocity(
-      req->header.stamp, vel_enu,
-      req->twist.angular.z);
+      req.header.stamp, vel_enu,
+      req.twist.angular.z);
   }
 
   void vel_unstamped_cb(const geometry_msgs::msg::Twist::SharedPtr req)
@@ -88,14 +88,17 @@ public:
 
   void tick(
     uint8_t type_, uint8_t autopilot_,
-    std::string & mode_, uint8_t system_status_)
+    const std::string & mode_, uint8_t system_status_)
   {
     std::lock_guard<std::mutex> lock(mutex);
     count_++;
 
     type = static_cast<MAV_TYPE>(type_);
     autopilot = static_cast<MAV_AUTOPILOT>(autopilot_);
-    mode = mode_;
+    if (mode != mode_) {
+      // avoid the per-heartbeat string copy on the rx path
+      mode = mode_;
+    }
     system_status = static_cast<MAV_STATE>(system_status_);
   }
 
@@ -553,6 +556,11 @@ private:
   BatteryStatusDiag batt_diag;
 
   rclcpp::TimerBase::SharedPtr timeout_timer;
+
+  // heartbeat mode string cache (rx thread only)
+  uint8_t cached_base_mode = 0;
+  uint32_t cached_custom_mode = 0;
+  std::string cached_mode;
   rclcpp::TimerBase::SharedPtr heartbeat_timer;
   rclcpp::TimerBase::SharedPtr autopilot_version_timer;
 
@@ -746,7 +754,16 @@ private:
     // Store generic info of all heartbeats seen
     auto it = find_or_create_vehicle_info(msg->sysid, msg->compid);
 
-    auto vehicle_mode = uas->str_mode_v10(hb.base_mode, hb.custom_mode);
+    // the mode string only changes on mode switches: cache it so the
+    // steady-state heartbeat path stores integers without allocating
+    if (cached_mode.empty() || hb.base_mode != cached_base_mode ||
+      hb.custom_mode != cached_custom_mode)
+    {
+      cached_mode = uas->str_mode_v10(hb.base_mode, hb.custom_mode);
+      cached_base_mode = hb.base_mode;
+      cached_custom_mode = hb.custom_mode;
+    }
+    const auto & vehicle_mode = cached_mode;
     auto stamp = node->now();
 
     // Update vehicle data
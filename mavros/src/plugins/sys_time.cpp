@@ -314,6 +314,8 @@ private:
   // Estimated statistics
   double time_offset;
   double time_skew;
+  double skew_per_ns;
+  uint64_t last_sample_local_ns;
 
   // Filter parameters
   uint32_t sequence;
@@ -363,7 +365,13 @@ private:
     const mavlink::mavlink_message_t * msg [[maybe_unused]],
     mavlink::common::msg::TIMESYNC & tsync, plugin::filter::SystemAndOk filter [[maybe_unused]])
   {
-    uint64_t now_ns = node->now().nanoseconds();
+    // the dispatch stamp carries the link's kernel rx timestamp
+    // where available, removing userspace scheduling jitter from
+    // the RTT measurement
+    uint64_t now_ns = uas->get_last_message_stamp_ns();
+    if (now_ns == 0) {
+      now_ns = node->now().nanoseconds();
+    }
 
     if (tsync.tc1 == 0) {
       send_timesync_msg(now_ns, tsync.ts1);
@@ -457,10 +465,14 @@ private:
         }
 
         // Perform filter update
-        add_sample(offset_ns);
+        add_sample(offset_ns, now_ns);
 
-        // Save time offset for other components to use
-        uas->set_time_offset(sync_converged() ? time_offset : 0);
+        // Save time offset (and drift estimate) for other components to use
+        if (sync_converged()) {
+          uas->set_time_offset_skew(time_offset, skew_per_ns, now_ns);
+        } else {
+          uas->set_time_offset(0);
+        }
 
         // Increment sequence counter after filter update
         sequence++;
@@ -498,7 +510,7 @@ private:
     dt_diag.tick(rtt_ns, remote_time_ns, time_offset);
   }
 
-  void add_sample(int64_t offset_ns)
+  void add_sample(int64_t offset_ns, uint64_t now_ns)
   {
     /* Online exponential smoothing filter. The derivative of the estimate is also
      * estimated in order to produce an estimate without steady state lag:
@@ -515,7 +527,15 @@ private:
 
       // Update the clock skew estimate
       time_skew = filter_beta * (time_offset - time_offset_prev) + (1.0 - filter_beta) * time_skew;
+
+      // Skew is ns-per-sample; normalize by the sample interval to
+      // get the drift rate used for stamp extrapolation
+      if (last_sample_local_ns != 0 && now_ns > last_sample_local_ns) {
+        skew_per_ns = time_skew / static_cast<double>(now_ns - last_sample_local_ns);
+      }
     }
+
+    last_sample_local_ns = now_ns;
   }
 
   void reset_filter()
@@ -524,6 +544,8 @@ private:
     sequence = 0;
     time_offset = 0.0;
     time_skew = 0.0;
+    skew_per_ns = 0.0;
+    last_sample_local_ns = 0;
     filter_alpha = filter_alpha_initial;
     filter_beta = filter_beta_initial;
     high_deviation_count = 0;
@@ -148,17 +148,28 @@ private:
     }
   }
 
+  //! converted list cache, rebuilt only when the mission changed
+  uint64_t wpl_cache_generation = UINT64_MAX;
+  mavros_msgs::msg::WaypointList wpl_cache;
+
   void publish_waypoints() override
   {
-    auto wpl = mavros_msgs::msg::WaypointList();
     unique_lock lock(mutex);
 
-    wpl.current_seq = wp_cur_active;
-    wpl.waypoints.reserve(waypoints.size());
-    for (auto & it : waypoints) {
-      wpl.waypoints.push_back(it);
+    if (wpl_cache_generation != mission_generation) {
+      wpl_cache.current_seq = wp_cur_active;
+      wpl_cache.waypoints.clear();
+      wpl_cache.waypoints.reserve(waypoints.size());
+      for (auto & it : waypoints) {
+        wpl_cache.waypoints.push_back(it);
+      }
+      wpl_cache_generation = mission_generation;
     }
 
+    // republish (late joiners, pull completions) is a buffer copy of
+    // the cached conversion, not a 400-item re-convert
+    auto wpl = wpl_cache;
+
     lock.unlock();
     wp_list_pub->publish(wpl);
   }
@@ -191,6 +202,12 @@ private:
       return;
     }
 
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::RXLIST;
     wp_count = 0;
     restart_timeout_timer();
@@ -233,6 +250,12 @@ private:
         return;
       }
 
+      if (!acquire_link(LIST_TIMEOUT)) {
+        RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+        res->success = false;
+        return;
+      }
+
       wp_state = WP::TXPARTIAL;
       send_waypoints = waypoints;
 
@@ -255,8 +278,13 @@ private:
       res->wp_transfered = wp_cur_id - wp_start_id + 1;
     } else {
       // Full waypoint update
-      wp_state = WP::TXLIST;
+      if (!acquire_link(LIST_TIMEOUT)) {
+        RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+        res->success = false;
+        return;
+      }
 
+      wp_state = WP::TXLIST;
       send_waypoints.clear();
       send_waypoints.reserve(req->waypoints.size());
       for (auto & wp : req->waypoints) {
@@ -289,6 +317,12 @@ private:
       return;
     }
 
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::CLEAR;
     restart_timeout_timer();
 
@@ -310,6 +344,12 @@ private:
       return;
     }
 
+    if (!acquire_link(LIST_TIMEOUT)) {
+      RCLCPP_ERROR(get_logger(), "%s: link busy, transfer timed out", log_prefix);
+      res->success = false;
+      return;
+    }
+
     wp_state = WP::SET_CUR;
     wp_set_active = req->wp_seq;
     restart_timeout_timer();
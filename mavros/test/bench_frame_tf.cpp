@@ -0,0 +1,133 @@
+/*
+ * Copyright 2021 Vladimir Ermakov.
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+/**
+ * Microbenchmarks for the frame conversion and quaternion helpers —
+ * the most-called math in the codebase — providing ns/op baselines
+ * as regression gates for the vectorization work.
+ *
+ * Build with -DMAVROS_BUILD_BENCHMARKS=ON (requires google-benchmark).
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <mavros/frame_tf.hpp>
+#include <mavros/utils.hpp>
+
+using namespace mavros;  // NOLINT
+
+static const Eigen::Quaterniond test_q =
+  ftf::quaternion_from_rpy(0.1, -0.2, 1.3);
+static const Eigen::Vector3d test_v(1.0, -2.0, 3.0);
+
+static ftf::Covariance6d make_cov6()
+{
+  ftf::Covariance6d cov;
+  for (size_t i = 0; i < cov.size(); i++) {
+    cov[i] = 0.01 * i;
+  }
+  return cov;
+}
+
+static ftf::Covariance9d make_cov9()
+{
+  ftf::Covariance9d cov;
+  for (size_t i = 0; i < cov.size(); i++) {
+    cov[i] = 0.01 * i;
+  }
+  return cov;
+}
+
+static void bench_quaternion_from_rpy(benchmark::State & state)
+{
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ftf::quaternion_from_rpy(0.1, -0.2, 1.3));
+  }
+}
+BENCHMARK(bench_quaternion_from_rpy);
+
+static void bench_transform_orientation_ned_enu(benchmark::State & state)
+{
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ftf::transform_orientation_ned_enu(test_q));
+  }
+}
+BENCHMARK(bench_transform_orientation_ned_enu);
+
+static void bench_transform_orientation_combined(benchmark::State & state)
+{
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      ftf::transform_orientation_ned_aircraft_enu_baselink(test_q));
+  }
+}
+BENCHMARK(bench_transform_orientation_combined);
+
+static void bench_transform_frame_ned_enu(benchmark::State & state)
+{
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ftf::transform_frame_ned_enu(test_v));
+  }
+}
+BENCHMARK(bench_transform_frame_ned_enu);
+
+static void bench_transform_frame_batch(benchmark::State & state)
+{
+  std::vector<Eigen::Vector3d> points(state.range(0), test_v);
+
+  for (auto _ : state) {
+    ftf::transform_frame_ned_enu(points.data(), points.size());
+    benchmark::DoNotOptimize(points.data());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(bench_transform_frame_batch)->Arg(16)->Arg(72);
+
+static void bench_transform_frame_cov6(benchmark::State & state)
+{
+  const auto cov = make_cov6();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ftf::transform_frame_ned_enu(cov));
+  }
+}
+BENCHMARK(bench_transform_frame_cov6);
+
+static void bench_transform_frame_cov9(benchmark::State & state)
+{
+  const auto cov = make_cov9();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ftf::transform_frame_ned_enu(cov));
+  }
+}
+BENCHMARK(bench_transform_frame_cov9);
+
+static void bench_transform_frame_cov6_q(benchmark::State & state)
+{
+  const auto cov = make_cov6();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ftf::transform_frame(cov, test_q));
+  }
+}
+BENCHMARK(bench_transform_frame_cov6_q);
+
+static void bench_sensor_orientation_matching(benchmark::State & state)
+{
+  using mavlink::common::MAV_SENSOR_ORIENTATION;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      utils::sensor_orientation_matching(
+        MAV_SENSOR_ORIENTATION::ROTATION_ROLL_270));
+  }
+}
+BENCHMARK(bench_sensor_orientation_matching);
+
+BENCHMARK_MAIN();
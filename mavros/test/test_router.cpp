@@ -100,7 +100,9 @@ public:
         ep->id = id;
         ep->link_type = type;
         ep->url = url;
-        ep->remote_addrs = remotes;
+        for (auto addr : remotes) {
+          ep->remote_addrs.emplace(addr, 1);
+        }
 
         router->endpoints[id] = ep;
 
@@ -166,6 +168,12 @@ public:
     return hb;
   }
 
+  void set_addr_generation(Router::SharedPtr router, uint64_t gen)
+  {
+    router->addr_generation = gen;
+    router->addr_index_dirty = true;
+  }
+
   inline size_t get_stat_msg_routed(Router::SharedPtr router)
   {
     return router->stat_msg_routed.load();
@@ -397,11 +405,6 @@ TEST_F(TestRouter, endpoint_recv_message)
 
   auto uas1 = getep(router, 1000);
 
-  uas1->stale_addrs.emplace(0x0100);
-  uas1->stale_addrs.emplace(0x01BF);
-
-  ASSERT_NE(uas1->stale_addrs.end(), uas1->stale_addrs.find(0x0100));
-  ASSERT_NE(uas1->stale_addrs.end(), uas1->stale_addrs.find(0x01BF));
   ASSERT_NE(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x0000));
   ASSERT_EQ(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x0100));
   ASSERT_EQ(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x01BF));
@@ -412,8 +415,6 @@ TEST_F(TestRouter, endpoint_recv_message)
 
   uas1->recv_message(&hbmsg, fr);
 
-  ASSERT_EQ(uas1->stale_addrs.end(), uas1->stale_addrs.find(0x0100));
-  ASSERT_EQ(uas1->stale_addrs.end(), uas1->stale_addrs.find(0x01BF));
   ASSERT_NE(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x0000));
   ASSERT_NE(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x0100));
   ASSERT_NE(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x01BF));
@@ -423,6 +424,31 @@ TEST_F(TestRouter, endpoint_recv_message)
   ASSERT_EQ(size_t(1), get_stat_msg_dropped(router));
 }
 
+TEST_F(TestRouter, stale_addr_lazy_expiry)
+{
+  auto router = std::make_shared<Router>("test_mavros_router");
+
+  router->set_parameters(
+    std::vector<rclcpp::Parameter>{
+        rclcpp::Parameter("uas_urls", std::vector<std::string>{"/uas1"})
+      });
+
+  auto uas1 = getep(router, 1000);
+
+  // addr stamped at generation 1
+  uas1->remote_addrs.emplace(0x0100, 1);
+
+  // two generations without traffic: expired at the next rebuild
+  set_addr_generation(router, 3);
+
+  auto hb = make_heartbeat();
+  auto hbmsg = convert_message(hb, 0x02BF);
+  router->route_message(uas1, &hbmsg, Framing::ok);
+
+  ASSERT_EQ(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x0100));
+  ASSERT_NE(uas1->remote_addrs.end(), uas1->remote_addrs.find(0x0000));
+}
+
 #if 0  // TODO(vooon):
 TEST_F(TestRouter, uas_recv_message)
 {
@@ -164,3 +164,91 @@ def outl_plugins_xml(dir: str, lib_path: str):
 def outl_glob_files(dir: str, glob: str = "*.cpp"):
     for f in sorted((cwd() / dir).glob(glob)):
         outl(str(f.relative_to(cwd())))
+
+
+@attr.s(auto_attribs=True)
+class ConvField:
+    """
+    One field of a mavlink <-> ROS conversion table.
+
+    type_ is the shared C++ scalar type when the field is
+    layout-compatible on both sides (memcpy eligible); leave it None
+    for fields that need per-field code (scaling, renames of
+    incompatible types).
+    """
+    ros: str
+    mav: str = None
+    type_: str = None
+    to_ros: str = None
+    to_mav: str = None
+
+    def __attrs_post_init__(self):
+        if self.mav is None:
+            self.mav = self.ros
+
+
+def outl_convert_fn(name: str, ros_t: str, mav_t: str,
+                    fields: typing.List[ConvField]):
+    """
+    Emit a conversion function pair for @mav_t <-> @ros_t.
+
+    Consecutive layout-compatible fields (same scalar type, no custom
+    expressions) are grouped into static_assert-guarded memcpy runs;
+    everything else falls back to per-field assignments. This gives
+    plugins one generated, bug-free converter instead of hand-written
+    field-by-field copies.
+    """
+    def flush_run(run, direction):
+        if not run:
+            return
+        if len(run) == 1:
+            f = run[0]
+            if direction == 'to_ros':
+                outl(f"rmsg.{f.ros} = mmsg.{f.mav};")
+            else:
+                outl(f"mmsg.{f.mav} = rmsg.{f.ros};")
+            return
+
+        first, last = run[0], run[-1]
+        n = len(run)
+        outl(f"static_assert(sizeof(rmsg.{first.ros}) == sizeof(mmsg.{first.mav}), \"layout\");")
+        outl(f"static_assert(")
+        outl(f"  offsetof({ros_t}, {last.ros}) - offsetof({ros_t}, {first.ros}) ==")
+        outl(f"  offsetof({mav_t}, {last.mav}) - offsetof({mav_t}, {first.mav}), \"layout\");")
+        if direction == 'to_ros':
+            outl(f"std::memcpy(&rmsg.{first.ros}, &mmsg.{first.mav}, "
+                 f"sizeof(rmsg.{first.ros}) * {n});  // {first.ros}..{last.ros}")
+        else:
+            outl(f"std::memcpy(&mmsg.{first.mav}, &rmsg.{first.ros}, "
+                 f"sizeof(mmsg.{first.mav}) * {n});  // {first.ros}..{last.ros}")
+
+    for direction, ret_t, arg_t in (('to_ros', ros_t, mav_t),
+                                    ('to_mav', mav_t, ros_t)):
+        if direction == 'to_ros':
+            outl(f"inline void convert_{name}(const {mav_t} & mmsg, {ros_t} & rmsg)")
+        else:
+            outl(f"inline void convert_{name}(const {ros_t} & rmsg, {mav_t} & mmsg)")
+        outl("{")
+        run = []
+        for f in fields:
+            expr = f.to_ros if direction == 'to_ros' else f.to_mav
+            if f.type_ is not None and expr is None:
+                if run and run[-1].type_ != f.type_:
+                    flush_run(run, direction)
+                    run = []
+                run.append(f)
+                continue
+
+            flush_run(run, direction)
+            run = []
+
+            if expr is not None:
+                outl(expr + ";")
+            elif direction == 'to_ros':
+                outl(f"rmsg.{f.ros} = mmsg.{f.mav};")
+            else:
+                outl(f"mmsg.{f.mav} = rmsg.{f.ros};")
+
+        flush_run(run, direction)
+        outl("}")
+        outl("")
@@ -23,6 +23,13 @@
 #include "mavros_msgs/msg/rc_in.hpp"
 #include "mavros_msgs/msg/rc_out.hpp"
 #include "mavros_msgs/msg/adsb_vehicle.hpp"
+#include "mavros_msgs/msg/adsb_vehicle_array.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <array>
+#include <cmath>
+#include <mutex>
 
 namespace mavros
 {
@@ -31,6 +38,92 @@ namespace extra_plugins
 using mavlink::common::ADSB_EMITTER_TYPE;
 using mavlink::common::ADSB_ALTITUDE_TYPE;
 
+// Generated mavlink <-> ROS converters: the field table drives
+// mavros_cog.outl_convert_fn(), which groups layout-compatible runs
+// into guarded memcpy and emits per-field code only where units or
+// layouts diverge (see mavros_cog.py).
+// [[[cog:
+// import mavros_cog
+// from mavros_cog import ConvField as F
+//
+// FIELDS = [
+//     F('icao_address', 'ICAO_address', 'uint32_t'),
+//     F('callsign', None, None,
+//       'rmsg.callsign = mavlink::to_string(mmsg.callsign)',
+//       'mavlink::set_string_z(mmsg.callsign, rmsg.callsign)'),
+//     F('latitude', 'lat', None,
+//       'rmsg.latitude = mmsg.lat / 1e7',
+//       'mmsg.lat = rmsg.latitude * 1e7'),
+//     F('longitude', 'lon', None,
+//       'rmsg.longitude = mmsg.lon / 1e7',
+//       'mmsg.lon = rmsg.longitude * 1e7'),
+//     F('altitude', None, None,
+//       'rmsg.altitude = mmsg.altitude / 1e3',
+//       'mmsg.altitude = rmsg.altitude * 1e3'),
+//     F('altitude_type', None, 'uint8_t'),
+//     F('heading', None, None,
+//       'rmsg.heading = mmsg.heading / 1e2',
+//       'mmsg.heading = rmsg.heading * 1e2'),
+//     F('hor_velocity', None, None,
+//       'rmsg.hor_velocity = mmsg.hor_velocity / 1e2',
+//       'mmsg.hor_velocity = rmsg.hor_velocity * 1e2'),
+//     F('ver_velocity', None, None,
+//       'rmsg.ver_velocity = mmsg.ver_velocity / 1e2',
+//       'mmsg.ver_velocity = rmsg.ver_velocity * 1e2'),
+//     F('emitter_type', None, 'uint8_t'),
+//     F('tslc', None, None,
+//       'rmsg.tslc = rclcpp::Duration(mmsg.tslc, 0)',
+//       'mmsg.tslc = rmsg.tslc.sec'),
+//     F('flags', None, 'uint16_t'),
+//     F('squawk', None, 'uint16_t'),
+// ]
+//
+// mavros_cog.outl_convert_fn(
+//     'adsb_vehicle', 'mavros_msgs::msg::ADSBVehicle',
+//     'mavlink::common::msg::ADSB_VEHICLE', FIELDS)
+// ]]]
+inline void convert_adsb_vehicle(const mavlink::common::msg::ADSB_VEHICLE & mmsg, mavros_msgs::msg::ADSBVehicle & rmsg)
+{
+rmsg.icao_address = mmsg.ICAO_address;
+rmsg.callsign = mavlink::to_string(mmsg.callsign);
+rmsg.latitude = mmsg.lat / 1e7;
+rmsg.longitude = mmsg.lon / 1e7;
+rmsg.altitude = mmsg.altitude / 1e3;
+rmsg.altitude_type = mmsg.altitude_type;
+rmsg.heading = mmsg.heading / 1e2;
+rmsg.hor_velocity = mmsg.hor_velocity / 1e2;
+rmsg.ver_velocity = mmsg.ver_velocity / 1e2;
+rmsg.emitter_type = mmsg.emitter_type;
+rmsg.tslc = rclcpp::Duration(mmsg.tslc, 0);
+static_assert(sizeof(rmsg.flags) == sizeof(mmsg.flags), "layout");
+static_assert(
+  offsetof(mavros_msgs::msg::ADSBVehicle, squawk) - offsetof(mavros_msgs::msg::ADSBVehicle, flags) ==
+  offsetof(mavlink::common::msg::ADSB_VEHICLE, squawk) - offsetof(mavlink::common::msg::ADSB_VEHICLE, flags), "layout");
+std::memcpy(&rmsg.flags, &mmsg.flags, sizeof(rmsg.flags) * 2);  // flags..squawk
+}
+
+inline void convert_adsb_vehicle(const mavros_msgs::msg::ADSBVehicle & rmsg, mavlink::common::msg::ADSB_VEHICLE & mmsg)
+{
+mmsg.ICAO_address = rmsg.icao_address;
+mavlink::set_string_z(mmsg.callsign, rmsg.callsign);
+mmsg.lat = rmsg.latitude * 1e7;
+mmsg.lon = rmsg.longitude * 1e7;
+mmsg.altitude = rmsg.altitude * 1e3;
+mmsg.altitude_type = rmsg.altitude_type;
+mmsg.heading = rmsg.heading * 1e2;
+mmsg.hor_velocity = rmsg.hor_velocity * 1e2;
+mmsg.ver_velocity = rmsg.ver_velocity * 1e2;
+mmsg.emitter_type = rmsg.emitter_type;
+mmsg.tslc = rmsg.tslc.sec;
+static_assert(sizeof(rmsg.flags) == sizeof(mmsg.flags), "layout");
+static_assert(
+  offsetof(mavros_msgs::msg::ADSBVehicle, squawk) - offsetof(mavros_msgs::msg::ADSBVehicle, flags) ==
+  offsetof(mavlink::common::msg::ADSB_VEHICLE, squawk) - offsetof(mavlink::common::msg::ADSB_VEHICLE, flags), "layout");
+std::memcpy(&mmsg.flags, &rmsg.flags, sizeof(mmsg.flags) * 2);  // flags..squawk
+}
+
+// [[[end]]] (checksum: 3ccdbf743f06fa5c9ac81ff4ed48fd34)
+
 /**
  * @brief ADS-B Vehicle plugin
  * @plugin adsb
@@ -44,6 +137,21 @@ public:
   : Plugin(uas_, "adsb")
   {
     adsb_pub = node->create_publisher<mavros_msgs::msg::ADSBVehicle>("~/vehicle", 10);
+    adsb_batch_pub = node->create_publisher<mavros_msgs::msg::ADSBVehicleArray>("~/traffic", 10);
+
+    // dedup thresholds and batch output rate
+    node->declare_parameter("min_publish_interval", 1.0);   // [s]
+    node->declare_parameter("min_position_delta", 1e-4);    // [deg] ~11 m
+    node->declare_parameter("batch_rate", 1.0);             // [Hz]
+
+    double batch_rate = 1.0;
+    node->get_parameter("min_publish_interval", min_publish_interval);
+    node->get_parameter("min_position_delta", min_position_delta);
+    node->get_parameter("batch_rate", batch_rate);
+
+    batch_timer = node->create_wall_timer(
+      std::chrono::duration<double>(1.0 / batch_rate),
+      std::bind(&ADSBPlugin::batch_timer_cb, this));
     adsb_sub =
       node->create_subscription<mavros_msgs::msg::ADSBVehicle>(
       "~/send", 10,
@@ -59,7 +167,90 @@ public:
 
 private:
   rclcpp::Publisher<mavros_msgs::msg::ADSBVehicle>::SharedPtr adsb_pub;
+  rclcpp::Publisher<mavros_msgs::msg::ADSBVehicleArray>::SharedPtr adsb_batch_pub;
   rclcpp::Subscription<mavros_msgs::msg::ADSBVehicle>::SharedPtr adsb_sub;
+  rclcpp::TimerBase::SharedPtr batch_timer;
+
+  /* -*- traffic dedup -*-
+   *
+   * Near airports the same ICAO addresses arrive several times per
+   * second; an open-addressed cache keyed by ICAO drops reports that
+   * neither moved past the position threshold nor exceeded the
+   * heartbeat interval since the last accepted one. Accepted reports
+   * also accumulate into the batched ~/traffic array sample.
+   */
+  struct TrackedVehicle
+  {
+    bool used = false;
+    uint32_t icao = 0;
+    double latitude = 0.0;
+    double longitude = 0.0;
+    rclcpp::Time last_pub {};
+  };
+
+  //! power of two; enough for dense terminal-area traffic
+  static constexpr size_t TRACK_CACHE_SIZE = 256;
+  std::array<TrackedVehicle, TRACK_CACHE_SIZE> track_cache;
+
+  double min_publish_interval = 1.0;
+  double min_position_delta = 1e-4;
+
+  std::mutex batch_mutex;
+  mavros_msgs::msg::ADSBVehicleArray batch;
+
+  //! @return true when the report changed enough to republish
+  bool accept_vehicle(const mavros_msgs::msg::ADSBVehicle & v, const rclcpp::Time & now)
+  {
+    size_t idx = (v.icao_address * 2654435761u) & (TRACK_CACHE_SIZE - 1);
+
+    for (size_t probe = 0; probe < TRACK_CACHE_SIZE; probe++, idx = (idx + 1) &
+      (TRACK_CACHE_SIZE - 1))
+    {
+      auto & entry = track_cache[idx];
+
+      if (!entry.used) {
+        entry.used = true;
+        entry.icao = v.icao_address;
+        entry.latitude = v.latitude;
+        entry.longitude = v.longitude;
+        entry.last_pub = now;
+        return true;
+      }
+
+      if (entry.icao != v.icao_address) {
+        continue;
+      }
+
+      const bool moved =
+        std::abs(v.latitude - entry.latitude) > min_position_delta ||
+        std::abs(v.longitude - entry.longitude) > min_position_delta;
+      const bool stale = (now - entry.last_pub).seconds() >= min_publish_interval;
+
+      if (moved || stale) {
+        entry.latitude = v.latitude;
+        entry.longitude = v.longitude;
+        entry.last_pub = now;
+        return true;
+      }
+
+      return false;
+    }
+
+    return true;    // cache full: fail open
+  }
+
+  void batch_timer_cb()
+  {
+    std::lock_guard<std::mutex> lock(batch_mutex);
+
+    if (batch.vehicles.empty()) {
+      return;
+    }
+
+    batch.header.stamp = node->now();
+    adsb_batch_pub->publish(batch);
+    batch.vehicles.clear();
+  }
 
   void handle_adsb(
     const mavlink::mavlink_message_t * msg [[maybe_unused]],
@@ -70,51 +261,7 @@ private:
     auto adsb_msg = mavros_msgs::msg::ADSBVehicle();
 
     adsb_msg.header.stamp = node->now();    // TODO(vooon): request add time_boot_ms to msg definition
-    // [[[cog:
-    // def ent(ros, mav=None, scale=None, to_ros=None, to_mav=None):
-    //     return (ros, mav or ros, scale, to_ros, to_mav)
-    //
-    // TR_TAB = (
-    // ent('icao_address', 'ICAO_address'),
-    // ent('callsign', to_ros='mavlink::to_string({mm}.{mav})',
-    //   to_mav='mavlink::set_string_z({mm}.{mav}, {rmp}->{ros})'),
-    // ent('latitude', 'lat', '1e7'),
-    // ent('longitude', 'lon', '1e7'),
-    // ent('altitude', 'altitude', '1e3'),
-    // ent('altitude_type', ),
-    // ent('heading', scale='1e2'),
-    // ent('hor_velocity', scale='1e2'),
-    // ent('ver_velocity', scale='1e2'),
-    // ent('altitude_type'),
-    // ent('emitter_type'),
-    // ent('tslc', to_ros='rclcpp::Duration({mm}.{mav}, 0)',
-    //   to_mav='{mm}.{mav} = {rmp}->{ros}.sec'),
-    // ent('flags'),
-    // ent('squawk'),
-    // )
-    //
-    // for ros, mav, scale, to_ros, _ in TR_TAB:
-    //     if to_ros is None:
-    //         scale_ex = '' if scale is None else ' / ' + scale
-    //         cog.outl(f"""adsb_msg.{ros} = adsb.{mav}{scale_ex};""")
-    //     else:
-    //         cog.outl(f"""adsb_msg.{ros} = {to_ros.format(mm='adsb', **locals())};""")
-    // ]]]
-    adsb_msg.icao_address = adsb.ICAO_address;
-    adsb_msg.callsign = mavlink::to_string(adsb.callsign);
-    adsb_msg.latitude = adsb.lat / 1e7;
-    adsb_msg.longitude = adsb.lon / 1e7;
-    adsb_msg.altitude = adsb.altitude / 1e3;
-    adsb_msg.altitude_type = adsb.altitude_type;
-    adsb_msg.heading = adsb.heading / 1e2;
-    adsb_msg.hor_velocity = adsb.hor_velocity / 1e2;
-    adsb_msg.ver_velocity = adsb.ver_velocity / 1e2;
-    adsb_msg.altitude_type = adsb.altitude_type;
-    adsb_msg.emitter_type = adsb.emitter_type;
-    adsb_msg.tslc = rclcpp::Duration(adsb.tslc, 0);
-    adsb_msg.flags = adsb.flags;
-    adsb_msg.squawk = adsb.squawk;
-    // [[[end]]] (checksum: ae8f818682cc2c23db50504f5af97127)
+    convert_adsb_vehicle(adsb, adsb_msg);
 
     RCLCPP_DEBUG_STREAM(
       get_logger(),
@@ -122,6 +269,15 @@ private:
         " emitter: " << utils::to_string_enum<ADSB_EMITTER_TYPE>(adsb.emitter_type) <<
         " flags: 0x" << std::hex << adsb.flags);
 
+    if (!accept_vehicle(adsb_msg, adsb_msg.header.stamp)) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(batch_mutex);
+      batch.vehicles.push_back(adsb_msg);
+    }
+
     adsb_pub->publish(adsb_msg);
   }
 
@@ -129,29 +285,7 @@ private:
   {
     mavlink::common::msg::ADSB_VEHICLE adsb{};
 
-    // [[[cog:
-    // for ros, mav, scale, _, to_mav in TR_TAB:
-    //     if to_mav is None:
-    //         scale_ex = '' if scale is None else ' * ' + scale
-    //         cog.outl(f"""adsb.{mav} = req->{ros}{scale_ex};""")
-    //     else:
-    //         cog.outl(to_mav.format(mm='adsb', rmp='req', **locals()) + ';')
-    // ]]]
-    adsb.ICAO_address = req->icao_address;
-    mavlink::set_string_z(adsb.callsign, req->callsign);
-    adsb.lat = req->latitude * 1e7;
-    adsb.lon = req->longitude * 1e7;
-    adsb.altitude = req->altitude * 1e3;
-    adsb.altitude_type = req->altitude_type;
-    adsb.heading = req->heading * 1e2;
-    adsb.hor_velocity = req->hor_velocity * 1e2;
-    adsb.ver_velocity = req->ver_velocity * 1e2;
-    adsb.altitude_type = req->altitude_type;
-    adsb.emitter_type = req->emitter_type;
-    adsb.tslc = req->tslc.sec;
-    adsb.flags = req->flags;
-    adsb.squawk = req->squawk;
-    // [[[end]]] (checksum: e586b680a3d86ec594e5b7f4a59bbe6c)
+    convert_adsb_vehicle(*req, adsb);
 
     RCLCPP_DEBUG_STREAM(
       get_logger(),
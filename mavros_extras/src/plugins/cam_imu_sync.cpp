@@ -14,9 +14,14 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <array>
+#include <atomic>
+#include <utility>
+
 #include <mavros/mavros_plugin.h>
 
 #include <mavros_msgs/CamIMUStamp.h>
+#include <std_msgs/UInt32.h>
 
 namespace mavros
 {
@@ -42,6 +47,15 @@ public:
     PluginBase::initialize(uas_);
 
     cam_imu_pub = cam_imu_sync_nh.advertise<mavros_msgs::CamIMUStamp>("cam_imu_stamp", 10);
+
+    // stamped lookup: consumers ask by frame sequence id and get the
+    // trigger stamp recomputed against the current (drift
+    // compensated) timesync model, instead of each reimplementing
+    // the correction per frame
+    corrected_pub = cam_imu_sync_nh.advertise<mavros_msgs::CamIMUStamp>(
+      "cam_imu_stamp_corrected", 10);
+    lookup_sub = cam_imu_sync_nh.subscribe(
+      "stamp_lookup", 10, &CamIMUSyncPlugin::lookup_cb, this);
   }
 
   Subscriptions get_subscriptions() override
@@ -55,11 +69,22 @@ private:
   ros::NodeHandle cam_imu_sync_nh;
 
   ros::Publisher cam_imu_pub;
+  ros::Publisher corrected_pub;
+  ros::Subscriber lookup_sub;
+
+  //! lock-free ring of recent (seq, raw trigger time) pairs
+  static constexpr size_t RING_SIZE = 1024;     // power of two
+  std::array<std::pair<uint32_t, uint64_t>, RING_SIZE> trigger_ring {};
+  std::atomic<size_t> ring_head {0};
 
   void handle_cam_trig(
     const mavlink::mavlink_message_t * msg,
     mavlink::common::msg::CAMERA_TRIGGER & ctrig)
   {
+    // record raw trigger time for later corrected lookups
+    const size_t idx = ring_head.fetch_add(1, std::memory_order_relaxed) & (RING_SIZE - 1);
+    trigger_ring[idx] = std::make_pair(ctrig.seq, ctrig.time_usec);
+
     auto sync_msg = boost::make_shared<mavros_msgs::CamIMUStamp>();
 
     sync_msg->frame_stamp = m_uas->synchronise_stamp(ctrig.time_usec);
@@ -67,6 +92,55 @@ private:
 
     cam_imu_pub.publish(sync_msg);
   }
+
+  void lookup_cb(const std_msgs::UInt32::ConstPtr & req)
+  {
+    const uint32_t seq = req->data;
+
+    // exact match first, else interpolate between the neighbors of a
+    // missed trigger
+    uint64_t time_usec = 0;
+    uint32_t below_seq = 0, above_seq = UINT32_MAX;
+    uint64_t below_us = 0, above_us = 0;
+
+    for (const auto & entry : trigger_ring) {
+      if (entry.second == 0) {
+        continue;
+      }
+
+      if (entry.first == seq) {
+        time_usec = entry.second;
+        break;
+      }
+      if (entry.first < seq && entry.first >= below_seq) {
+        below_seq = entry.first;
+        below_us = entry.second;
+      }
+      if (entry.first > seq && entry.first <= above_seq) {
+        above_seq = entry.first;
+        above_us = entry.second;
+      }
+    }
+
+    if (time_usec == 0 && below_us != 0 && above_us != 0) {
+      // linear interpolation over the missing trigger interval
+      time_usec = below_us +
+        (above_us - below_us) * uint64_t(seq - below_seq) / (above_seq - below_seq);
+    }
+
+    if (time_usec == 0) {
+      ROS_WARN_NAMED("cam_imu_sync", "CAM: no trigger recorded around seq %u", seq);
+      return;
+    }
+
+    auto sync_msg = boost::make_shared<mavros_msgs::CamIMUStamp>();
+
+    // recomputed against the current offset + skew estimate
+    sync_msg->frame_stamp = m_uas->synchronise_stamp(time_usec);
+    sync_msg->frame_seq_id = seq;
+
+    corrected_pub.publish(sync_msg);
+  }
 };
 }       // namespace extra_plugins
 }       // namespace mavros
@@ -14,6 +14,8 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <array>
+#include <cstring>
 #include <mavros/mavros_plugin.h>
 
 #include <mavros_msgs/DebugValue.h>
@@ -65,6 +67,76 @@ private:
   ros::Publisher named_value_float_pub;
   ros::Publisher named_value_int_pub;
 
+  /* -*- named stream interning -*- */
+
+  /**
+   * Named debug streams are interned on first sight: the raw 10-byte
+   * wire name is the key of a small open-addressed table holding the
+   * materialized name string (SSO: no per-message allocation) and a
+   * per-name topic publisher. Steady-state named-value traffic never
+   * touches std::string construction or hashing of heap strings.
+   */
+  struct NamedStream
+  {
+    bool used = false;
+    uint64_t key_hi = 0;
+    uint16_t key_lo = 0;
+    std::string name;
+    ros::Publisher pub;
+  };
+
+  //! power of two; typical autopilots emit a few dozen streams
+  static constexpr size_t NAME_TABLE_SIZE = 64;
+
+  std::array<NamedStream, NAME_TABLE_SIZE> float_streams;
+  std::array<NamedStream, NAME_TABLE_SIZE> int_streams;
+
+  NamedStream * intern_name(
+    std::array<NamedStream, NAME_TABLE_SIZE> & table,
+    const std::array<char, 10> & raw, const char * topic_prefix)
+  {
+    uint64_t key_hi = 0;
+    uint16_t key_lo = 0;
+    std::memcpy(&key_hi, raw.data(), 8);
+    std::memcpy(&key_lo, raw.data() + 8, 2);
+
+    // splitmix-style scramble of the packed name
+    uint64_t h = key_hi ^ (uint64_t(key_lo) << 48) ^ 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+
+    for (size_t probe = 0; probe < NAME_TABLE_SIZE; probe++) {
+      auto & entry = table[(h + probe) & (NAME_TABLE_SIZE - 1)];
+
+      if (entry.used && entry.key_hi == key_hi && entry.key_lo == key_lo) {
+        return &entry;
+      }
+
+      if (!entry.used) {
+        entry.used = true;
+        entry.key_hi = key_hi;
+        entry.key_lo = key_lo;
+        entry.name = mavlink::to_string(raw);
+
+        // per-name topic: sanitize for topic grammar
+        std::string topic = entry.name.empty() ? std::string("UNK") : entry.name;
+        for (auto & c : topic) {
+          if (!isalnum(c)) {
+            c = '_';
+          }
+        }
+
+        entry.pub = debug_nh.advertise<mavros_msgs::DebugValue>(
+          std::string(topic_prefix) + "/" + topic, 10);
+        return &entry;
+      }
+    }
+
+    ROS_WARN_ONCE_NAMED("debug_value", "DV: named stream table full");
+    return nullptr;
+  }
+
   /* -*- helpers -*- */
 
   /**
@@ -212,6 +284,10 @@ private:
 
     debug_logger(value.get_name(), *dv_msg);
     named_value_float_pub.publish(dv_msg);
+
+    if (auto * stream = intern_name(float_streams, value.name, "named_value_float")) {
+      stream->pub.publish(dv_msg);
+    }
   }
 
   /**
@@ -238,6 +314,10 @@ private:
 
     debug_logger(value.get_name(), *dv_msg);
     named_value_int_pub.publish(dv_msg);
+
+    if (auto * stream = intern_name(int_streams, value.name, "named_value_int")) {
+      stream->pub.publish(dv_msg);
+    }
   }
 
   /* -*- callbacks -*- */
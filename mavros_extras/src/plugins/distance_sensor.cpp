@@ -15,7 +15,11 @@
  */
 #include <unordered_map>
 #include <mavros/utils.h>
+#include <array>
+
 #include <mavros/mavros_plugin.h>
+
+#include "range_pipeline.hpp"
 #include <eigen_conversions/eigen_msg.h>
 
 #include <sensor_msgs/Range.h>
@@ -66,6 +70,12 @@ public:
 
   // topic handle
   ros::Publisher pub;
+
+  // compiled publish state (see plugin initialize()): the shared
+  // range pipeline holds the preallocated message, the transform is
+  // prefilled for configured orientations
+  RangePipeline pipeline;
+  geometry_msgs::TransformStamped transform_msg;
   ros::Subscriber sub;
   std::string topic_name;
 
@@ -150,6 +160,20 @@ public:
 
       if (it) {
         sensor_map[it->sensor_id] = it;
+        sensor_table[it->sensor_id] = it.get();
+
+        // precompute everything that does not change per message
+        it->pipeline.configure(
+          it->pub, it->frame_id, sensor_msgs::Range::INFRARED,
+          it->field_of_view, 0.0f, 0.0f);
+        if (it->send_tf && it->orientation >= 0) {
+          tf::quaternionEigenToMsg(
+            utils::sensor_orientation_matching(
+              static_cast<mavlink::common::MAV_SENSOR_ORIENTATION>(it->orientation)),
+            it->transform_msg.transform.rotation);
+          tf::vectorEigenToMsg(it->position, it->transform_msg.transform.translation);
+          it->transform_msg.child_frame_id = it->frame_id;
+        }
       } else {
         ROS_ERROR_NAMED("distance_sensor", "DS: bad config for %s", pair.first.c_str());
       }
@@ -171,6 +195,8 @@ private:
   std::string base_frame_id;
 
   std::unordered_map<uint8_t, DistanceSensorItem::Ptr> sensor_map;
+  //! direct dispatch: sensor id indexes its compiled item
+  std::array<DistanceSensorItem *, 256> sensor_table {};
 
   /* -*- low-level send -*- */
   void distance_sensor(
@@ -227,16 +253,14 @@ private:
     using mavlink::common::MAV_SENSOR_ORIENTATION;
     using mavlink::common::MAV_DISTANCE_SENSOR;
 
-    auto it = sensor_map.find(dist_sen.id);
-    if (it == sensor_map.end()) {
+    auto * sensor = sensor_table[dist_sen.id];
+    if (sensor == nullptr) {
       ROS_ERROR_NAMED(
         "distance_sensor",
         "DS: no mapping for sensor id: %d, type: %d, orientation: %d",
         dist_sen.id, dist_sen.type, dist_sen.orientation);
       return;
     }
-
-    auto sensor = it->second;
     if (sensor->is_subscriber) {
       ROS_ERROR_ONCE_NAMED(
         "distance_sensor",
@@ -256,22 +280,19 @@ private:
       return;
     }
 
-    auto range = boost::make_shared<sensor_msgs::Range>();
-
-    range->header = m_uas->synchronized_header(sensor->frame_id, dist_sen.time_boot_ms);
-
-    range->min_range = dist_sen.min_distance * 1E-2;            // in meters
-    range->max_range = dist_sen.max_distance * 1E-2;
-    range->field_of_view = sensor->field_of_view;
+    // wire-reported bounds, then store-and-publish via the pipeline
+    sensor->pipeline.set_bounds(
+      dist_sen.min_distance * 1E-2,               // in meters
+      dist_sen.max_distance * 1E-2);
 
     switch (dist_sen.type) {
       case enum_value(MAV_DISTANCE_SENSOR::LASER):
       case enum_value(MAV_DISTANCE_SENSOR::RADAR):
       case enum_value(MAV_DISTANCE_SENSOR::UNKNOWN):
-        range->radiation_type = sensor_msgs::Range::INFRARED;
+        sensor->pipeline.set_radiation_type(sensor_msgs::Range::INFRARED);
         break;
       case enum_value(MAV_DISTANCE_SENSOR::ULTRASOUND):
-        range->radiation_type = sensor_msgs::Range::ULTRASOUND;
+        sensor->pipeline.set_radiation_type(sensor_msgs::Range::ULTRASOUND);
         break;
       default:
         ROS_ERROR_NAMED(
@@ -281,28 +302,33 @@ private:
         return;
     }
 
-    range->range = dist_sen.current_distance * 1E-2;                    // in meters
 
     if (sensor->send_tf) {
-      /* variables init */
-      auto q =
-        utils::sensor_orientation_matching(
-        static_cast<MAV_SENSOR_ORIENTATION>(dist_sen.orientation));
+      if (sensor->orientation >= 0) {
+        // rotation/translation precompiled at registration
+        sensor->transform_msg.header =
+          m_uas->synchronized_header(base_frame_id, dist_sen.time_boot_ms);
+        m_uas->tf2_broadcaster.sendTransform(sensor->transform_msg);
+      } else {
+        auto q =
+          utils::sensor_orientation_matching(
+          static_cast<MAV_SENSOR_ORIENTATION>(dist_sen.orientation));
 
-      geometry_msgs::TransformStamped transform;
+        geometry_msgs::TransformStamped transform;
 
-      transform.header = m_uas->synchronized_header(base_frame_id, dist_sen.time_boot_ms);
-      transform.child_frame_id = sensor->frame_id;
+        transform.header = m_uas->synchronized_header(base_frame_id, dist_sen.time_boot_ms);
+        transform.child_frame_id = sensor->frame_id;
 
-      /* rotation and position set */
-      tf::quaternionEigenToMsg(q, transform.transform.rotation);
-      tf::vectorEigenToMsg(sensor->position, transform.transform.translation);
+        tf::quaternionEigenToMsg(q, transform.transform.rotation);
+        tf::vectorEigenToMsg(sensor->position, transform.transform.translation);
 
-      /* transform broadcast */
-      m_uas->tf2_broadcaster.sendTransform(transform);
+        m_uas->tf2_broadcaster.sendTransform(transform);
+      }
     }
 
-    sensor->pub.publish(range);
+    sensor->pipeline.publish(
+      m_uas->synchronized_header(sensor->frame_id, dist_sen.time_boot_ms),
+      dist_sen.current_distance * 1E-2);                                // in meters
   }
 };
 
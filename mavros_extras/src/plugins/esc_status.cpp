@@ -69,6 +69,40 @@ private:
   uint8_t _max_esc_status_index;
   const uint8_t batch_size = 4;
 
+  // Coalescing state: one bit per 4-ESC wire batch. The aggregate
+  // publishes once every batch of the sweep arrived; seeing a batch
+  // again first means the previous sweep lost its tail, so the stale
+  // aggregate is bounded to one sweep and flushed instead of held.
+  uint8_t _info_seen_mask = 0;
+  uint8_t _status_seen_mask = 0;
+
+  uint8_t expected_batch_mask() const
+  {
+    const uint8_t nbatches = (_max_esc_count + batch_size - 1) / batch_size;
+    return (1 << nbatches) - 1;
+  }
+
+  //! @return true when the whole sweep is assembled (or went stale)
+  bool coalesce_batch(uint8_t & seen_mask, const uint8_t index)
+  {
+    const uint8_t bit = 1 << (index / batch_size);
+    bool flush = false;
+
+    if (seen_mask & bit) {
+      // new sweep started before the old one completed
+      flush = true;
+      seen_mask = 0;
+    }
+
+    seen_mask |= bit;
+    if (_max_esc_count > 0 && seen_mask == expected_batch_mask()) {
+      flush = true;
+      seen_mask = 0;
+    }
+
+    return flush;
+  }
+
   void handle_esc_info(
     const mavlink::mavlink_message_t * msg,
     mavlink::common::msg::ESC_INFO & esc_info)
@@ -101,7 +135,7 @@ private:
 
     _max_esc_info_index = std::max(_max_esc_info_index, esc_info.index);
 
-    if (_max_esc_info_index == esc_info.index) {
+    if (coalesce_batch(_info_seen_mask, esc_info.index)) {
       esc_info_pub.publish(_esc_info);
     }
   }
@@ -129,7 +163,7 @@ private:
 
     _max_esc_status_index = std::max(_max_esc_status_index, esc_status.index);
 
-    if (_max_esc_status_index == esc_status.index) {
+    if (coalesce_batch(_status_seen_mask, esc_status.index)) {
       esc_status_pub.publish(_esc_status);
     }
   }
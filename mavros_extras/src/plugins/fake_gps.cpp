@@ -210,6 +210,31 @@ private:
   /**
    * @brief Send fake GPS coordinates through HIL_GPS or GPS_INPUT Mavlink msg
    */
+  // Geoid separation cache: the egm96 cubic interpolation is the
+  // dominant per-message GeographicLib cost, while indoor swarm
+  // trajectories stay well inside one geoid grid cell. Linearize by
+  // caching the separation until the fix moves past ~1 km.
+  static constexpr double GEOID_CACHE_DEG = 0.01;
+  bool geoid_cache_valid = false;
+  double geoid_cache_lat = 0.0;
+  double geoid_cache_lon = 0.0;
+  double geoid_cache_sep = 0.0;
+
+  double cached_geoid_separation(const double lat, const double lon)
+  {
+    if (!geoid_cache_valid ||
+      std::abs(lat - geoid_cache_lat) > GEOID_CACHE_DEG ||
+      std::abs(lon - geoid_cache_lon) > GEOID_CACHE_DEG)
+    {
+      geoid_cache_sep = GeographicLib::Geoid::ELLIPSOIDTOGEOID * (*m_uas->egm96_5)(lat, lon);
+      geoid_cache_lat = lat;
+      geoid_cache_lon = lon;
+      geoid_cache_valid = true;
+    }
+
+    return geoid_cache_sep;
+  }
+
   void send_fake_gps(const ros::Time & stamp, const Eigen::Vector3d & ecef_offset)
   {
     // Throttle incoming messages to 5hz
@@ -262,8 +287,8 @@ private:
       hil_gps.time_usec = stamp.toNSec() / 1000;                        // [useconds]
       hil_gps.lat = geodetic.x() * 1e7;                         // [degrees * 1e7]
       hil_gps.lon = geodetic.y() * 1e7;                         // [degrees * 1e7]
-      hil_gps.alt = (geodetic.z() + GeographicLib::Geoid::ELLIPSOIDTOGEOID *
-        (*m_uas->egm96_5)(geodetic.x(), geodetic.y())) * 1e3;                           // [meters * 1e3]
+      hil_gps.alt =
+        (geodetic.z() + cached_geoid_separation(geodetic.x(), geodetic.y())) * 1e3;     // [meters * 1e3]
       hil_gps.vel = vel.block<2, 1>(0, 0).norm();                       // [cm/s]
       hil_gps.vn = vel.x();                                     // [cm/s]
       hil_gps.ve = vel.y();                                     // [cm/s]
@@ -309,8 +334,8 @@ private:
       gps_input.vert_accuracy = vert_accuracy;                  // [m] will either use the static parameter value, or the dynamic covariance from function mocap_pose_cov_cb() bellow
       gps_input.lat = geodetic.x() * 1e7;                       // [degrees * 1e7]
       gps_input.lon = geodetic.y() * 1e7;                       // [degrees * 1e7]
-      gps_input.alt = (geodetic.z() + GeographicLib::Geoid::ELLIPSOIDTOGEOID *
-        (*m_uas->egm96_5)(geodetic.x(), geodetic.y()));                         // [meters]
+      gps_input.alt =
+        geodetic.z() + cached_geoid_separation(geodetic.x(), geodetic.y());     // [meters]
       gps_input.vn = vel.x();                                   // [m/s]
       gps_input.ve = vel.y();                                   // [m/s]
       gps_input.vd = vel.z();                                   // [m/s]
@@ -65,41 +65,88 @@ private:
    * Message specification: https://mavlink.io/en/messages/common.html#GPS_RTCM_DATA
    * @param msg		Received ROS msg
    */
-  void rtcm_cb(const mavros_msgs::RTCM::ConstPtr & msg)
+  /**
+   * Length of the RTCM3 message starting at @p data: 0xD3 preamble,
+   * 10-bit payload length, payload, 3-byte CRC. 0 when @p data does
+   * not frame cleanly within @p avail bytes.
+   */
+  static size_t rtcm3_frame_len(const uint8_t * data, size_t avail)
+  {
+    if (avail < 6 || data[0] != 0xD3) {
+      return 0;
+    }
+
+    const size_t total = (((data[1] & 0x03) << 8) | data[2]) + 6;
+    return (total <= avail) ? total : 0;
+  }
+
+  //! Send one logical correction blob, fragmenting when needed.
+  void send_rtcm_blob(const uint8_t * data, size_t size, uint8_t seq)
   {
     mavlink::common::msg::GPS_RTCM_DATA rtcm_data = {};
     const size_t max_frag_len = rtcm_data.data.size();
 
-    uint8_t seq_u5 = uint8_t(msg->header.seq & 0x1F) << 3;
+    const uint8_t seq_u5 = uint8_t(seq & 0x1F) << 3;
 
-    if (msg->data.size() > 4 * max_frag_len) {
+    if (size > 4 * max_frag_len) {
       ROS_FATAL("gps_rtk: RTCM message received is bigger than the maximal possible size.");
       return;
     }
 
-    auto data_it = msg->data.begin();
-    auto end_it = msg->data.end();
-
-    if (msg->data.size() <= max_frag_len) {
-      rtcm_data.len = msg->data.size();
+    if (size <= max_frag_len) {
+      rtcm_data.len = size;
       rtcm_data.flags = seq_u5;
-      std::copy(data_it, end_it, rtcm_data.data.begin());
+      std::copy(data, data + size, rtcm_data.data.begin());
       std::fill(rtcm_data.data.begin() + rtcm_data.len, rtcm_data.data.end(), 0);
       UAS_FCU(m_uas)->send_message(rtcm_data);
     } else {
-      for (uint8_t fragment_id = 0; fragment_id < 4 && data_it < end_it; fragment_id++) {
-        uint8_t len = std::min((size_t) std::distance(data_it, end_it), max_frag_len);
+      size_t off = 0;
+      for (uint8_t fragment_id = 0; fragment_id < 4 && off < size; fragment_id++) {
+        uint8_t len = std::min(size - off, max_frag_len);
         rtcm_data.flags = 1;                                                    // LSB set indicates message is fragmented
         rtcm_data.flags |= fragment_id << 1;                                    // Next 2 bits are fragment id
         rtcm_data.flags |= seq_u5;                                      // Next 5 bits are sequence id
         rtcm_data.len = len;
 
-        std::copy(data_it, data_it + len, rtcm_data.data.begin());
+        std::copy(data + off, data + off + len, rtcm_data.data.begin());
         std::fill(rtcm_data.data.begin() + len, rtcm_data.data.end(), 0);
         UAS_FCU(m_uas)->send_message(rtcm_data);
-        std::advance(data_it, len);
+        off += len;
+      }
+    }
+  }
+
+  void rtcm_cb(const mavros_msgs::RTCM::ConstPtr & msg)
+  {
+    // Split the blob at RTCM3 message boundaries when it frames
+    // cleanly: fragments then never straddle messages unnecessarily
+    // and a lost fragment costs one correction, not the whole blob.
+    // All resulting wire messages are enqueued back-to-back on this
+    // thread, so their relative timing is preserved by the Tx queue.
+    const uint8_t * data = msg->data.data();
+    size_t remaining = msg->data.size();
+
+    size_t nframes = 0;
+    for (size_t off = 0; off < remaining; nframes++) {
+      const size_t flen = rtcm3_frame_len(data + off, remaining - off);
+      if (flen == 0) {
+        nframes = 0;
+        break;
       }
+      off += flen;
     }
+
+    if (nframes > 1) {
+      uint8_t seq = msg->header.seq;
+      for (size_t off = 0; off < remaining; seq++) {
+        const size_t flen = rtcm3_frame_len(data + off, remaining - off);
+        send_rtcm_blob(data + off, flen, seq);
+        off += flen;
+      }
+      return;
+    }
+
+    send_rtcm_blob(data, remaining, msg->header.seq);
   }
 
   /* MAvlink msg handlers */
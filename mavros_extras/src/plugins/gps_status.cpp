@@ -14,6 +14,7 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <array>
 #include <mavros/mavros_plugin.h>
 #include <mavros_msgs/GPSRAW.h>
 #include <mavros_msgs/GPSRTK.h>
@@ -43,6 +44,9 @@ public:
 
     gps1_raw_pub = gpsstatus_nh.advertise<mavros_msgs::GPSRAW>("gps1/raw", 10);
     gps2_raw_pub = gpsstatus_nh.advertise<mavros_msgs::GPSRAW>("gps2/raw", 10);
+
+    receivers[0].pub = &gps1_raw_pub;
+    receivers[1].pub = &gps2_raw_pub;
     gps1_rtk_pub = gpsstatus_nh.advertise<mavros_msgs::GPSRTK>("gps1/rtk", 10);
     gps2_rtk_pub = gpsstatus_nh.advertise<mavros_msgs::GPSRTK>("gps2/rtk", 10);
   }
@@ -62,6 +66,34 @@ private:
 
   ros::Publisher gps1_raw_pub;
   ros::Publisher gps2_raw_pub;
+
+  // fixed two-slot receiver registry: preallocated message plus the
+  // bound publisher per receiver, so the per-message path is field
+  // stores and a publish with no construction or branching on source
+  struct ReceiverSlot
+  {
+    mavros_msgs::GPSRAW msg;
+    ros::Publisher * pub = nullptr;
+  };
+  std::array<ReceiverSlot, 2> receivers;
+
+  //! common field stores shared by both wire message layouts
+  template<typename MsgT>
+  void fill_gpsraw(ReceiverSlot & slot, MsgT & mav_msg)
+  {
+    auto & ros_msg = slot.msg;
+
+    ros_msg.header = m_uas->synchronized_header("/wgs84", mav_msg.time_usec);
+    ros_msg.fix_type = mav_msg.fix_type;
+    ros_msg.lat = mav_msg.lat;
+    ros_msg.lon = mav_msg.lon;
+    ros_msg.alt = mav_msg.alt;
+    ros_msg.eph = mav_msg.eph;
+    ros_msg.epv = mav_msg.epv;
+    ros_msg.vel = mav_msg.vel;
+    ros_msg.cog = mav_msg.cog;
+    ros_msg.satellites_visible = mav_msg.satellites_visible;
+  }
   ros::Publisher gps1_rtk_pub;
   ros::Publisher gps2_rtk_pub;
 
@@ -73,26 +105,18 @@ private:
     const mavlink::mavlink_message_t * msg,
     mavlink::common::msg::GPS_RAW_INT & mav_msg)
   {
-    auto ros_msg = boost::make_shared<mavros_msgs::GPSRAW>();
-    ros_msg->header = m_uas->synchronized_header("/wgs84", mav_msg.time_usec);
-    ros_msg->fix_type = mav_msg.fix_type;
-    ros_msg->lat = mav_msg.lat;
-    ros_msg->lon = mav_msg.lon;
-    ros_msg->alt = mav_msg.alt;
-    ros_msg->eph = mav_msg.eph;
-    ros_msg->epv = mav_msg.epv;
-    ros_msg->vel = mav_msg.vel;
-    ros_msg->cog = mav_msg.cog;
-    ros_msg->satellites_visible = mav_msg.satellites_visible;
-    ros_msg->alt_ellipsoid = mav_msg.alt_ellipsoid;
-    ros_msg->h_acc = mav_msg.h_acc;
-    ros_msg->v_acc = mav_msg.v_acc;
-    ros_msg->vel_acc = mav_msg.vel_acc;
-    ros_msg->hdg_acc = mav_msg.hdg_acc;
-    ros_msg->dgps_numch = UINT8_MAX;                    // information not available in GPS_RAW_INT mavlink message
-    ros_msg->dgps_age = UINT32_MAX;                     // information not available in GPS_RAW_INT mavlink message
-
-    gps1_raw_pub.publish(ros_msg);
+    auto & slot = receivers[0];
+
+    fill_gpsraw(slot, mav_msg);
+    slot.msg.alt_ellipsoid = mav_msg.alt_ellipsoid;
+    slot.msg.h_acc = mav_msg.h_acc;
+    slot.msg.v_acc = mav_msg.v_acc;
+    slot.msg.vel_acc = mav_msg.vel_acc;
+    slot.msg.hdg_acc = mav_msg.hdg_acc;
+    slot.msg.dgps_numch = UINT8_MAX;                    // information not available in GPS_RAW_INT mavlink message
+    slot.msg.dgps_age = UINT32_MAX;                     // information not available in GPS_RAW_INT mavlink message
+
+    slot.pub->publish(slot.msg);
   }
 
   /**
@@ -102,26 +126,18 @@ private:
     const mavlink::mavlink_message_t * msg,
     mavlink::common::msg::GPS2_RAW & mav_msg)
   {
-    auto ros_msg = boost::make_shared<mavros_msgs::GPSRAW>();
-    ros_msg->header = m_uas->synchronized_header("/wgs84", mav_msg.time_usec);
-    ros_msg->fix_type = mav_msg.fix_type;
-    ros_msg->lat = mav_msg.lat;
-    ros_msg->lon = mav_msg.lon;
-    ros_msg->alt = mav_msg.alt;
-    ros_msg->eph = mav_msg.eph;
-    ros_msg->epv = mav_msg.epv;
-    ros_msg->vel = mav_msg.vel;
-    ros_msg->cog = mav_msg.cog;
-    ros_msg->satellites_visible = mav_msg.satellites_visible;
-    ros_msg->alt_ellipsoid = INT32_MAX;                 // information not available in GPS2_RAW mavlink message
-    ros_msg->h_acc = UINT32_MAX;                        // information not available in GPS2_RAW mavlink message
-    ros_msg->v_acc = UINT32_MAX;                        // information not available in GPS2_RAW mavlink message
-    ros_msg->vel_acc = UINT32_MAX;                      // information not available in GPS2_RAW mavlink message
-    ros_msg->hdg_acc = UINT32_MAX;                      // information not available in GPS2_RAW mavlink message
-    ros_msg->dgps_numch = mav_msg.dgps_numch;
-    ros_msg->dgps_age = mav_msg.dgps_age;
-
-    gps2_raw_pub.publish(ros_msg);
+    auto & slot = receivers[1];
+
+    fill_gpsraw(slot, mav_msg);
+    slot.msg.alt_ellipsoid = INT32_MAX;                 // information not available in GPS2_RAW mavlink message
+    slot.msg.h_acc = UINT32_MAX;                        // information not available in GPS2_RAW mavlink message
+    slot.msg.v_acc = UINT32_MAX;                        // information not available in GPS2_RAW mavlink message
+    slot.msg.vel_acc = UINT32_MAX;                      // information not available in GPS2_RAW mavlink message
+    slot.msg.hdg_acc = UINT32_MAX;                      // information not available in GPS2_RAW mavlink message
+    slot.msg.dgps_numch = mav_msg.dgps_numch;
+    slot.msg.dgps_age = mav_msg.dgps_age;
+
+    slot.pub->publish(slot.msg);
   }
 
   /**
@@ -16,6 +16,9 @@
  * in the top-level LICENSE file of the mavros repository.
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
+#include <std_msgs/Empty.h>
+#include <vector>
+
 #include <mavros/mavros_plugin.h>
 #include <eigen_conversions/eigen_msg.h>
 
@@ -53,6 +56,17 @@ public:
   {
     PluginBase::initialize(uas_);
 
+    // lockstep batching: per-step messages accumulate and go out as
+    // one vectored enqueue (single lock + io wakeup), flushed by the
+    // HIL_SENSOR sample that closes a sim step or explicitly via
+    // ~step_flush
+    hil_nh.param("batch_step", batch_step, false);
+    if (batch_step) {
+      step_msgs.reserve(STEP_CAPACITY);
+      step_flush_sub = hil_nh.subscribe(
+        "step_flush", 1, &HilPlugin::step_flush_cb, this);
+    }
+
     hil_state_quaternion_sub = hil_nh.subscribe("state", 10, &HilPlugin::state_quat_cb, this);
     hil_gps_sub = hil_nh.subscribe("gps", 10, &HilPlugin::gps_cb, this);
     hil_sensor_sub = hil_nh.subscribe("imu_ned", 10, &HilPlugin::sensor_cb, this);
@@ -138,6 +152,56 @@ private:
    * @brief Send hil_state_quaternion to FCU.
    * Message specification: @p https://mavlink.io/en/messages/common.html#HIL_STATE_QUATERNION
    */
+  /* -*- lockstep batching -*- */
+
+  static constexpr size_t STEP_CAPACITY = 8;
+
+  bool batch_step = false;
+  ros::Subscriber step_flush_sub;
+  //! seq/finalize state of the pre-serialized batch stream
+  mavlink::mavlink_status_t hil_status {};
+  //! serialized wire messages of the current sim step
+  std::vector<mavlink::mavlink_message_t> step_msgs;
+
+  //! enqueue or send one wire message depending on mode
+  template<typename MsgT>
+  void hil_send(MsgT & msg)
+  {
+    if (!batch_step) {
+      UAS_FCU(m_uas)->send_message_ignore_drop(msg);
+      return;
+    }
+
+    // pre-serialize into the step batch; no per-field revalidation
+    mavlink::mavlink_message_t wire{};
+    mavlink::MsgMap map(wire);
+    auto mi = msg.get_message_info();
+
+    msg.serialize(map);
+    mavlink::mavlink_finalize_message_buffer(
+      &wire, UAS_FCU(m_uas)->get_system_id(), UAS_FCU(m_uas)->get_component_id(),
+      &hil_status, mi.min_length, mi.length, mi.crc_extra);
+
+    if (step_msgs.size() < STEP_CAPACITY) {
+      step_msgs.push_back(wire);
+    }
+  }
+
+  void flush_step()
+  {
+    if (step_msgs.empty()) {
+      return;
+    }
+
+    UAS_FCU(m_uas)->send_messages(step_msgs.data(), step_msgs.size());
+    step_msgs.clear();
+  }
+
+  void step_flush_cb(const std_msgs::Empty::ConstPtr &)
+  {
+    flush_step();
+  }
+
   void state_quat_cb(const mavros_msgs::HilStateQuaternion::ConstPtr & req)
   {
     mavlink::common::msg::HIL_STATE_QUATERNION state_quat = {};
@@ -184,7 +248,7 @@ private:
     state_quat.zacc = lin_acc.z();
     // [[[end]]] (checksum: a29598b834ac1ec32ede01595aa5b3ac)
 
-    UAS_FCU(m_uas)->send_message_ignore_drop(state_quat);
+    hil_send(state_quat);
   }
 
   /**
@@ -218,7 +282,7 @@ private:
     // [[[end]]] (checksum: a283bcc78f496cead2e9f893200d825d)
     gps.satellites_visible = req->satellites_visible;
 
-    UAS_FCU(m_uas)->send_message_ignore_drop(gps);
+    hil_send(gps);
   }
 
   /**
@@ -265,7 +329,12 @@ private:
     sensor.fields_updated = req->fields_updated;
     // [[[end]]] (checksum: 316bef821ad6fc33d9726a1c8e8c5404)
 
-    UAS_FCU(m_uas)->send_message_ignore_drop(sensor);
+    hil_send(sensor);
+
+    if (batch_step) {
+      // HIL_SENSOR closes a lockstep sim step
+      flush_step();
+    }
   }
 
   /**
@@ -309,7 +378,7 @@ private:
     // [[[end]]] (checksum: acbfae28f4f3bb8ca135423efaaa479e)
     of.temperature = req->temperature * 100.0f;                 // in centi-degrees celsius
 
-    UAS_FCU(m_uas)->send_message_ignore_drop(of);
+    hil_send(of);
   }
 
   /**
@@ -346,7 +415,7 @@ private:
     rcin.chan12_raw = channels[11];
     // [[[end]]] (checksum: 8d6860789d596dc39e81b351c3a50fcd)
 
-    UAS_FCU(m_uas)->send_message_ignore_drop(rcin);
+    hil_send(rcin);
   }
 };
 }       // namespace std_plugins
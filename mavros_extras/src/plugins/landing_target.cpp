@@ -131,6 +131,12 @@ private:
 
   ros::Publisher land_target_pub;
   ros::Publisher lt_marker_pub;
+
+  // pooled output messages (see handle_landing_target)
+  geometry_msgs::PoseStamped pose_msg;
+  geometry_msgs::TransformStamped tf_msg;
+  geometry_msgs::Vector3Stamped lt_marker_msg;
+  uint8_t tf_target_num = 255;
   ros::Subscriber land_target_sub;
   ros::Subscriber pose_sub;
 
@@ -332,34 +338,42 @@ private:
       rpy.z(), land_target.size_x, land_target.size_y,
       utils::to_string(static_cast<LANDING_TARGET_TYPE>(land_target.type)).c_str());
 
-    auto pose = boost::make_shared<geometry_msgs::PoseStamped>();
-    pose->header = m_uas->synchronized_header(frame_id, land_target.time_usec);
+    // pooled messages: per-track work is field stores
+    pose_msg.header = m_uas->synchronized_header(frame_id, land_target.time_usec);
 
-    tf::pointEigenToMsg(position, pose->pose.position);
-    tf::quaternionEigenToMsg(orientation, pose->pose.orientation);
+    tf::pointEigenToMsg(position, pose_msg.pose.position);
+    tf::quaternionEigenToMsg(orientation, pose_msg.pose.orientation);
 
-    land_target_pub.publish(pose);
+    land_target_pub.publish(pose_msg);
 
     if (send_tf) {
-      geometry_msgs::TransformStamped transform;
-
-      transform.header.stamp = pose->header.stamp;
-      transform.header.frame_id = "landing_target_" + boost::lexical_cast<std::string>(
-        land_target.target_num);
-      transform.child_frame_id = tf_child_frame_id;
-
-      transform.transform.rotation = pose->pose.orientation;
-      tf::vectorEigenToMsg(position, transform.transform.translation);
-
-      m_uas->tf2_broadcaster.sendTransform(transform);
+      // static parts of the transform are prepared once per target id
+      if (tf_msg.header.frame_id.empty() ||
+        tf_target_num != land_target.target_num)
+      {
+        tf_msg.header.frame_id = "landing_target_" + std::to_string(land_target.target_num);
+        tf_msg.child_frame_id = tf_child_frame_id;
+        tf_target_num = land_target.target_num;
+      }
+
+      tf_msg.header.stamp = pose_msg.header.stamp;
+      tf_msg.transform.rotation = pose_msg.pose.orientation;
+      tf::vectorEigenToMsg(position, tf_msg.transform.translation);
+
+      m_uas->tf2_broadcaster.sendTransform(tf_msg);
     }
 
-    auto tg_size_msg = boost::make_shared<geometry_msgs::Vector3Stamped>();
-    Eigen::Vector3d target_size(target_size_x, target_size_y, 0.0);
-
-    tf::vectorEigenToMsg(target_size, tg_size_msg->vector);
+    // visualization only when someone watches; the size vector is
+    // static configuration, prepared once
+    if (lt_marker_pub.getNumSubscribers() > 0) {
+      if (lt_marker_msg.vector.x == 0.0 && lt_marker_msg.vector.y == 0.0) {
+        tf::vectorEigenToMsg(
+          Eigen::Vector3d(target_size_x, target_size_y, 0.0), lt_marker_msg.vector);
+      }
 
-    lt_marker_pub.publish(tg_size_msg);
+      lt_marker_msg.header.stamp = pose_msg.header.stamp;
+      lt_marker_pub.publish(lt_marker_msg);
+    }
   }
 
   /* -*- callbacks -*- */
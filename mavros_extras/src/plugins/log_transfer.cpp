@@ -1,3 +1,12 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
 #include <mavros/mavros_plugin.h>
 #include <mavros_msgs/LogData.h>
 #include <mavros_msgs/LogEntry.h>
@@ -22,6 +31,14 @@ public:
     log_entry_pub = nh.advertise<mavros_msgs::LogEntry>("raw/log_entry", 1000);
     log_data_pub = nh.advertise<mavros_msgs::LogData>("raw/log_data", 1000);
 
+    // non-empty: log_request_data also streams straight into
+    // <download_dir>/log_<id>.bin via the download engine
+    nh.param<std::string>("download_dir", download_dir, "");
+
+    dl_timer = nh.createTimer(
+      ros::Duration(1.0), &LogTransferPlugin::dl_timer_cb, this);
+    dl_timer.stop();
+
     log_request_list_srv = nh.advertiseService(
       "raw/log_request_list",
       &LogTransferPlugin::log_request_list_cb, this);
@@ -46,6 +63,182 @@ private:
   ros::Publisher log_entry_pub, log_data_pub;
   ros::ServiceServer log_request_list_srv, log_request_data_srv, log_request_end_srv;
 
+  /* -*- streaming download engine -*-
+   *
+   * The FCU streams LOG_DATA for a whole requested range, so the
+   * engine requests the full range once, writes every 90-byte chunk
+   * directly into an mmap'd destination file, tracks arrival in a
+   * chunk bitmap and selectively re-requests gap ranges when the
+   * stream stalls. Progress and throughput are logged each second.
+   */
+  static constexpr size_t DL_CHUNK = 90;        //!< LOG_DATA payload size
+  static constexpr double DL_STALL_SEC = 2.0;
+
+  std::string download_dir;
+  std::mutex dl_mutex;
+  int dl_fd = -1;
+  uint8_t * dl_map = nullptr;
+  size_t dl_size = 0;
+  uint16_t dl_log_id = 0;
+  uint32_t dl_base = 0;
+  std::vector<bool> dl_chunks;
+  size_t dl_received = 0;
+  ros::Time dl_last_data;
+  ros::Time dl_start;
+  ros::Timer dl_timer;
+
+  bool dl_active() const
+  {
+    return dl_map != nullptr;
+  }
+
+  void dl_start_download(uint16_t id, uint32_t offset, uint32_t count)
+  {
+    dl_finish(false);
+
+    auto path = download_dir + "/log_" + std::to_string(id) + ".bin";
+    dl_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (dl_fd < 0 || ::ftruncate(dl_fd, count) != 0) {
+      ROS_ERROR_NAMED("log_transfer", "LOG: can't create %s", path.c_str());
+      if (dl_fd >= 0) {
+        ::close(dl_fd);
+        dl_fd = -1;
+      }
+      return;
+    }
+
+    dl_map = static_cast<uint8_t *>(
+      ::mmap(nullptr, count, PROT_WRITE, MAP_SHARED, dl_fd, 0));
+    if (dl_map == MAP_FAILED) {
+      dl_map = nullptr;
+      ::close(dl_fd);
+      dl_fd = -1;
+      ROS_ERROR_NAMED("log_transfer", "LOG: mmap failed for %s", path.c_str());
+      return;
+    }
+
+    dl_size = count;
+    dl_log_id = id;
+    dl_base = offset;
+    dl_chunks.assign((count + DL_CHUNK - 1) / DL_CHUNK, false);
+    dl_received = 0;
+    dl_start = dl_last_data = ros::Time::now();
+    dl_timer.start();
+
+    ROS_INFO_NAMED(
+      "log_transfer", "LOG: downloading log %u (%zu bytes) to %s",
+      id, dl_size, path.c_str());
+  }
+
+  void dl_store_chunk(uint32_t ofs, const uint8_t * data, size_t len)
+  {
+    if (ofs < dl_base) {
+      return;
+    }
+
+    const size_t pos = ofs - dl_base;
+    if (pos >= dl_size) {
+      return;
+    }
+
+    const size_t ncopy = std::min(len, dl_size - pos);
+    std::memcpy(dl_map + pos, data, ncopy);
+
+    const size_t chunk = pos / DL_CHUNK;
+    if (!dl_chunks[chunk]) {
+      dl_chunks[chunk] = true;
+      dl_received += ncopy;
+    }
+
+    dl_last_data = ros::Time::now();
+
+    if (dl_received >= dl_size) {
+      dl_finish(true);
+    }
+  }
+
+  void dl_request_range(uint32_t ofs, uint32_t count)
+  {
+    mavlink::common::msg::LOG_REQUEST_DATA msg = {};
+    m_uas->msg_set_target(msg);
+    msg.id = dl_log_id;
+    msg.ofs = ofs;
+    msg.count = count;
+
+    UAS_FCU(m_uas)->send_message_ignore_drop(msg);
+  }
+
+  void dl_timer_cb(const ros::TimerEvent &)
+  {
+    std::lock_guard<std::mutex> lock(dl_mutex);
+
+    if (!dl_active()) {
+      dl_timer.stop();
+      return;
+    }
+
+    const auto now = ros::Time::now();
+    const double elapsed = (now - dl_start).toSec();
+
+    ROS_INFO_NAMED(
+      "log_transfer", "LOG: %zu/%zu bytes (%.1f kB/s)",
+      dl_received, dl_size,
+      (elapsed > 0.0) ? dl_received / elapsed / 1e3 : 0.0);
+
+    if ((now - dl_last_data).toSec() < DL_STALL_SEC) {
+      return;
+    }
+
+    // stream stalled: selectively re-request the first gap range
+    size_t begin = dl_chunks.size();
+    for (size_t i = 0; i < dl_chunks.size(); i++) {
+      if (!dl_chunks[i]) {
+        begin = i;
+        break;
+      }
+    }
+
+    if (begin == dl_chunks.size()) {
+      dl_finish(true);
+      return;
+    }
+
+    size_t end = begin;
+    while (end < dl_chunks.size() && !dl_chunks[end]) {
+      end++;
+    }
+
+    const uint32_t ofs = dl_base + begin * DL_CHUNK;
+    const uint32_t count = std::min<size_t>((end - begin) * DL_CHUNK, dl_size - begin * DL_CHUNK);
+
+    ROS_WARN_NAMED(
+      "log_transfer", "LOG: stream stalled, re-requesting [%u, %u)",
+      ofs, ofs + count);
+    dl_last_data = now;
+    dl_request_range(ofs, count);
+  }
+
+  void dl_finish(bool complete)
+  {
+    if (!dl_active()) {
+      return;
+    }
+
+    ::msync(dl_map, dl_size, MS_ASYNC);
+    ::munmap(dl_map, dl_size);
+    ::close(dl_fd);
+    dl_map = nullptr;
+    dl_fd = -1;
+    dl_timer.stop();
+
+    if (complete) {
+      const double elapsed = (ros::Time::now() - dl_start).toSec();
+      ROS_INFO_NAMED(
+        "log_transfer", "LOG: download of log %u complete (%.1f kB/s)",
+        dl_log_id, (elapsed > 0.0) ? dl_size / elapsed / 1e3 : 0.0);
+    }
+  }
+
   void handle_log_entry(const mavlink::mavlink_message_t *, mavlink::common::msg::LOG_ENTRY & le)
   {
     auto msg = boost::make_shared<mavros_msgs::LogEntry>();
@@ -60,6 +253,13 @@ private:
 
   void handle_log_data(const mavlink::mavlink_message_t *, mavlink::common::msg::LOG_DATA & ld)
   {
+    {
+      std::lock_guard<std::mutex> lock(dl_mutex);
+      if (dl_active() && ld.id == dl_log_id) {
+        dl_store_chunk(ld.ofs, ld.data.data(), std::min<size_t>(ld.count, ld.data.max_size()));
+      }
+    }
+
     auto msg = boost::make_shared<mavros_msgs::LogData>();
     msg->header.stamp = ros::Time::now();
     msg->id = ld.id;
@@ -101,6 +301,11 @@ private:
     msg.ofs = req.offset;
     msg.count = req.count;
 
+    if (!download_dir.empty() && req.count != UINT32_MAX) {
+      std::lock_guard<std::mutex> lock(dl_mutex);
+      dl_start_download(req.id, req.offset, req.count);
+    }
+
     res.success = true;
     try {
       UAS_FCU(m_uas)->send_message(msg);
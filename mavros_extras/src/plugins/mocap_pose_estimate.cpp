@@ -52,6 +52,10 @@ public:
     /** @note For Optitrack ROS package, subscribe to PoseStamped topic */
     mp_nh.param("use_pose", use_pose, true);
 
+    // input decimation: e.g. a 240 Hz Vicon stream resampled down
+    // to what the FCU consumes (0: forward everything)
+    mp_nh.param("max_rate", max_rate, 0.0);
+
     if (use_tf && !use_pose) {
       mocap_tf_sub = mp_nh.subscribe("tf", 1, &MocapPoseEstimatePlugin::mocap_tf_cb, this);
     } else if (use_pose && !use_tf) {
@@ -90,8 +94,33 @@ private:
   }
 
   /* -*- mid-level helpers -*- */
+  // Input decimation: forward the sample only when enough time
+  // passed since the last accepted one. Stamp-based selection is
+  // jitter resistant — a late sample still counts against its own
+  // stamp, not the wall clock of its arrival.
+  double max_rate = 0.0;        //!< ~max_rate parameter, 0: off
+  ros::Time last_accepted;
+
+  bool accept_sample(const ros::Time & stamp)
+  {
+    if (max_rate <= 0.0) {
+      return true;
+    }
+
+    if (!last_accepted.isZero() && (stamp - last_accepted).toSec() < 1.0 / max_rate) {
+      return false;
+    }
+
+    last_accepted = stamp;
+    return true;
+  }
+
   void mocap_pose_cb(const geometry_msgs::PoseStamped::ConstPtr & pose)
   {
+    if (!accept_sample(pose->header.stamp)) {
+      return;
+    }
+
     Eigen::Quaterniond q_enu;
 
     tf::quaternionMsgToEigen(pose->pose.orientation, q_enu);
@@ -113,6 +142,10 @@ private:
   /* -*- callbacks -*- */
   void mocap_tf_cb(const geometry_msgs::TransformStamped::ConstPtr & trans)
   {
+    if (!accept_sample(trans->header.stamp)) {
+      return;
+    }
+
     Eigen::Quaterniond q_enu;
 
     tf::quaternionMsgToEigen(trans->transform.rotation, q_enu);
@@ -14,6 +14,7 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <mutex>
 #include <mavros/mavros_plugin.h>
 
 #include <mavros_msgs/CommandLong.h>
@@ -56,6 +57,14 @@ public:
       "configure", &MountControlPlugin::mount_configure_cb,
       this);
 
+    // coalescing transmitter: >0 sends the latest command at a fixed
+    // rate and drops near-identical intermediate ones
+    mount_nh.param("tx_rate", tx_rate, 0.0);
+    mount_nh.param("change_threshold", change_threshold, 0.5);  // [deg]
+    if (tx_rate > 0.0) {
+      tx_timer = mount_nh.createTimer(
+        ros::Duration(1.0 / tx_rate), &MountControlPlugin::tx_timer_cb, this);
+    }
   }
 
   Subscriptions get_subscriptions() override
@@ -68,6 +77,16 @@ public:
 private:
   ros::NodeHandle nh;
   ros::NodeHandle mount_nh;
+
+  // coalescing transmitter state (tx_rate > 0)
+  double tx_rate = 0.0;
+  double change_threshold = 0.5;
+  ros::Timer tx_timer;
+  std::mutex slot_mutex;
+  mavros_msgs::MountControl pending;
+  bool have_pending = false;
+  mavros_msgs::MountControl last_sent;
+  bool sent_valid = false;
   ros::Subscriber command_sub;
   ros::Publisher mount_orientation_pub;
   ros::ServiceServer configure_srv;
@@ -83,12 +102,14 @@ private:
     const mavlink::mavlink_message_t * msg,
     mavlink::common::msg::MOUNT_ORIENTATION & mo)
   {
+    // reused message: the republish path does not allocate
     auto q = ftf::quaternion_from_rpy(Eigen::Vector3d(mo.roll, mo.pitch, mo.yaw) * M_PI / 180.0);
-    geometry_msgs::Quaternion quaternion_msg;
-    tf::quaternionEigenToMsg(q, quaternion_msg);
-    mount_orientation_pub.publish(quaternion_msg);
+    tf::quaternionEigenToMsg(q, orientation_msg);
+    mount_orientation_pub.publish(orientation_msg);
   }
 
+  geometry_msgs::Quaternion orientation_msg;
+
   /**
    * @brief Send mount control commands to vehicle
    *
@@ -96,23 +117,65 @@ private:
    * @param req	received MountControl msg
    */
   void command_cb(const mavros_msgs::MountControl::ConstPtr & req)
+  {
+    if (tx_rate > 0.0) {
+      // latest-value slot; the paced timer transmits it
+      std::lock_guard<std::mutex> lock(slot_mutex);
+      pending = *req;
+      have_pending = true;
+      return;
+    }
+
+    send_mount_control(*req);
+  }
+
+  void send_mount_control(const mavros_msgs::MountControl & req)
   {
     mavlink::common::msg::COMMAND_LONG cmd {};
 
     cmd.target_system = m_uas->get_tgt_system();
     cmd.target_component = m_uas->get_tgt_component();
     cmd.command = enum_value(MAV_CMD::DO_MOUNT_CONTROL);
-    cmd.param1 = req->pitch;
-    cmd.param2 = req->roll;
-    cmd.param3 = req->yaw;
-    cmd.param4 = req->altitude;             //
-    cmd.param5 = req->latitude;             // lattitude in degrees * 1E7
-    cmd.param6 = req->longitude;             // longitude in degrees * 1E7
-    cmd.param7 = req->mode;             // MAV_MOUNT_MODE
+    cmd.param1 = req.pitch;
+    cmd.param2 = req.roll;
+    cmd.param3 = req.yaw;
+    cmd.param4 = req.altitude;              //
+    cmd.param5 = req.latitude;              // lattitude in degrees * 1E7
+    cmd.param6 = req.longitude;             // longitude in degrees * 1E7
+    cmd.param7 = req.mode;              // MAV_MOUNT_MODE
 
     UAS_FCU(m_uas)->send_message_ignore_drop(cmd);
   }
 
+  void tx_timer_cb(const ros::TimerEvent &)
+  {
+    mavros_msgs::MountControl req;
+
+    {
+      std::lock_guard<std::mutex> lock(slot_mutex);
+      if (!have_pending) {
+        return;
+      }
+      req = pending;
+      have_pending = false;
+    }
+
+    // drop near-identical commands: a 50 Hz tracking loop settles on
+    // the target most of the time
+    if (sent_valid &&
+      std::abs(req.pitch - last_sent.pitch) < change_threshold &&
+      std::abs(req.roll - last_sent.roll) < change_threshold &&
+      std::abs(req.yaw - last_sent.yaw) < change_threshold &&
+      req.mode == last_sent.mode)
+    {
+      return;
+    }
+
+    last_sent = req;
+    sent_valid = true;
+    send_mount_control(req);
+  }
+
   bool mount_configure_cb(
     mavros_msgs::MountConfigure::Request & req,
     mavros_msgs::MountConfigure::Response & res)
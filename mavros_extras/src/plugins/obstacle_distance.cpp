@@ -65,6 +65,22 @@ private:
 
   mavlink::common::MAV_FRAME frame;
 
+  //! reused wire message; every distance slot is rewritten per scan
+  mavlink::common::msg::OBSTACLE_DISTANCE obstacle {};
+
+  /**
+   * Meters to centimeter wire value with branchless validity
+   * clamping: NaN and out-of-range inputs map to the UINT16_MAX
+   * "unknown" sentinel. Keeps the conversion loop vectorizable.
+   */
+  static inline uint16_t distance_to_cm(const float range_m)
+  {
+    const float cm = range_m * 1e2f;
+    // NaN fails both comparisons and lands on the sentinel
+    const bool valid = (cm >= 0.0f) & (cm < static_cast<float>(UINT16_MAX));
+    return valid ? static_cast<uint16_t>(cm) : UINT16_MAX;
+  }
+
   /**
    * @brief Send obstacle distance array to the FCU.
    *
@@ -73,17 +89,14 @@ private:
    */
   void obstacle_cb(const sensor_msgs::LaserScan::ConstPtr & req)
   {
-    mavlink::common::msg::OBSTACLE_DISTANCE obstacle {};
-
     if (req->ranges.size() <= obstacle.distances.size()) {
-      // all distances from sensor will fit in obstacle distance message
-      for (int i = 0; i < req->ranges.size(); i++) {
-        float distance_cm = req->ranges[i] * 1e2;
-        if (std::isnan(distance_cm) || distance_cm >= UINT16_MAX || distance_cm < 0) {
-          obstacle.distances[i] = UINT16_MAX;
-        } else {
-          obstacle.distances[i] = static_cast<uint16_t>(distance_cm);
-        }
+      // all distances from sensor will fit in obstacle distance message;
+      // fixed-size loop over the contiguous arrays, branchless per lane
+      const size_t n = req->ranges.size();
+      const float * ranges = req->ranges.data();
+
+      for (size_t i = 0; i < n; i++) {
+        obstacle.distances[i] = distance_to_cm(ranges[i]);
       }
       std::fill(
         obstacle.distances.begin() + req->ranges.size(),
@@ -100,10 +113,9 @@ private:
         for (size_t j = 0; j < scale_factor; j++) {
           size_t req_index = i * scale_factor + j;
           if (req_index < req->ranges.size()) {
-            float distance_cm = req->ranges[req_index] * 1e2;
-            if (!std::isnan(distance_cm) && distance_cm < UINT16_MAX && distance_cm > 0) {
-              obstacle.distances[i] =
-                std::min(obstacle.distances[i], static_cast<uint16_t>(distance_cm));
+            const uint16_t distance_cm = distance_to_cm(req->ranges[req_index]);
+            if (distance_cm != 0) {     // zero stays invalid here, as before
+              obstacle.distances[i] = std::min(obstacle.distances[i], distance_cm);
             }
           }
         }
@@ -16,6 +16,8 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <unordered_map>
+
 #include <mavros/mavros_plugin.h>
 #include <tf2_eigen/tf2_eigen.h>
 #include <boost/algorithm/string.hpp>
@@ -85,8 +87,27 @@ private:
   std::string fcu_odom_parent_id_des;                           //!< desired orientation of the fcu odometry message's parent frame
   std::string fcu_odom_child_id_des;                            //!< desired orientation of the fcu odometry message's child frame
 
+  //! Cached transform with time-based invalidation (see below)
+  struct CachedTransform
+  {
+    Eigen::Affine3d tf;
+    ros::Time stamp;
+    bool valid = false;
+  };
+
+  //! resolved transform per frame pair, keyed "target\0source"
+  std::unordered_map<std::string, CachedTransform> tf_cache;
+
+  //! how long a resolved transform is trusted before re-asking tf2
+  static constexpr double TF_CACHE_SEC = 1.0;
+
   /**
    * @brief Lookup static transform with error handling
+   *
+   * The frame pairs used here are static transforms, so the resolved
+   * value is cached and tf2 (mutex + tree walk) is only consulted
+   * once per invalidation window instead of per 100 Hz message.
+   *
    * @param[in] &target The parent frame of the transformation you want to get
    * @param[in] &source The child frame of the transformation you want to get
    * @param[in,out] &tf_source2target The affine transform from the source to target
@@ -95,11 +116,23 @@ private:
     const std::string & target, const std::string & source,
     Eigen::Affine3d & tf_source2target)
   {
+    const auto now = ros::Time::now();
+    auto & entry = tf_cache[target + '\0' + source];
+
+    if (entry.valid && (now - entry.stamp).toSec() < TF_CACHE_SEC) {
+      tf_source2target = entry.tf;
+      return;
+    }
+
     try {
       // transform lookup at current time.
       tf_source2target = tf2::transformToEigen(
         m_uas->tf2_buffer.lookupTransform(
           target, source, ros::Time(0)));
+
+      entry.tf = tf_source2target;
+      entry.stamp = now;
+      entry.valid = true;
     } catch (tf2::TransformException & ex) {
       ROS_ERROR_THROTTLE_NAMED(1, "odom", "ODOM: Ex: %s", ex.what());
       return;
@@ -14,6 +14,10 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
 #include <mavros/mavros_plugin.h>
 
 #include <mavros_msgs/OnboardComputerStatus.h>
@@ -41,6 +45,17 @@ public:
     PluginBase::initialize(uas_);
 
     status_sub = status_nh.subscribe("status", 10, &OnboardComputerStatusPlugin::status_cb, this);
+
+    // built-in sampler: fills ONBOARD_COMPUTER_STATUS from /proc and
+    // the thermal zones in-process, replacing the external psutil node
+    double sample_rate = 0.0;
+    status_nh.param("sample_rate", sample_rate, 0.0);
+    if (sample_rate > 0.0) {
+      parse_buf.reserve(8192);
+      sample_timer = status_nh.createTimer(
+        ros::Duration(1.0 / sample_rate),
+        &OnboardComputerStatusPlugin::sample_timer_cb, this);
+    }
   }
 
   Subscriptions get_subscriptions() override
@@ -51,6 +66,133 @@ public:
 private:
   ros::NodeHandle status_nh;
   ros::Subscriber status_sub;
+  ros::Timer sample_timer;
+
+  //! reused read buffer for /proc files
+  std::string parse_buf;
+
+  // previous /proc/stat counters for delta-based CPU load
+  struct CpuTimes
+  {
+    uint64_t busy = 0;
+    uint64_t total = 0;
+  };
+  std::array<CpuTimes, 8> prev_cpu {};    //!< [0]: aggregate, 1..: cores
+
+  //! read a whole (small) pseudo file into the reused buffer
+  bool read_proc(const char * path)
+  {
+    FILE * f = std::fopen(path, "r");
+    if (f == nullptr) {
+      return false;
+    }
+
+    parse_buf.resize(parse_buf.capacity());
+    const size_t n = std::fread(&parse_buf[0], 1, parse_buf.size() - 1, f);
+    std::fclose(f);
+
+    parse_buf.resize(n);
+    return n > 0;
+  }
+
+  //! delta-based load of cpu line @p idx (0: aggregate), 0..100
+  uint8_t cpu_load(const char * line, size_t idx)
+  {
+    unsigned long long user = 0, nice = 0, system = 0, idle = 0,
+      iowait = 0, irq = 0, softirq = 0;
+    std::sscanf(
+      line, "%*s %llu %llu %llu %llu %llu %llu %llu",
+      &user, &nice, &system, &idle, &iowait, &irq, &softirq);
+
+    const uint64_t busy = user + nice + system + irq + softirq;
+    const uint64_t total = busy + idle + iowait;
+
+    auto & prev = prev_cpu[idx];
+    const uint64_t d_total = total - prev.total;
+    const uint64_t d_busy = busy - prev.busy;
+    prev.busy = busy;
+    prev.total = total;
+
+    if (prev.total == total || d_total == 0) {
+      return 0;
+    }
+
+    return static_cast<uint8_t>(100 * d_busy / d_total);
+  }
+
+  void sample_timer_cb(const ros::TimerEvent &)
+  {
+    mavlink::common::msg::ONBOARD_COMPUTER_STATUS status {};
+
+    status.time_usec = ros::Time::now().toNSec() / 1000;
+    status.type = 0;    // mission computer
+    std::fill(status.cpu_cores.begin(), status.cpu_cores.end(), UINT8_MAX);
+    std::fill(status.cpu_combined.begin(), status.cpu_combined.end(), UINT8_MAX);
+    std::fill(status.gpu_cores.begin(), status.gpu_cores.end(), UINT8_MAX);
+    std::fill(status.gpu_combined.begin(), status.gpu_combined.end(), UINT8_MAX);
+    std::fill(status.temperature_core.begin(), status.temperature_core.end(), INT8_MAX);
+    std::fill(status.fan_speed.begin(), status.fan_speed.end(), INT16_MAX);
+    std::fill(status.storage_type.begin(), status.storage_type.end(), UINT32_MAX);
+    std::fill(status.link_type.begin(), status.link_type.end(), UINT32_MAX);
+    status.temperature_board = INT8_MAX;
+
+    // /proc/stat: aggregate plus per-core deltas
+    if (read_proc("/proc/stat")) {
+      size_t cpu_idx = 0;
+      size_t pos = 0;
+
+      while (pos < parse_buf.size() && cpu_idx < prev_cpu.size()) {
+        if (parse_buf.compare(pos, 3, "cpu") != 0) {
+          break;
+        }
+
+        const char * line = parse_buf.c_str() + pos;
+        const uint8_t load = cpu_load(line, cpu_idx);
+
+        if (cpu_idx == 0) {
+          status.cpu_combined[0] = load;
+        } else if (cpu_idx - 1 < status.cpu_cores.size()) {
+          status.cpu_cores[cpu_idx - 1] = load;
+        }
+        cpu_idx++;
+
+        const size_t eol = parse_buf.find('\n', pos);
+        if (eol == std::string::npos) {
+          break;
+        }
+        pos = eol + 1;
+      }
+
+      // uptime from the btime field would need another read; use the
+      // monotonic clock instead
+      status.uptime = ros::WallTime::now().toSec();
+    }
+
+    // /proc/meminfo: MemTotal / MemAvailable [MiB]
+    if (read_proc("/proc/meminfo")) {
+      uint64_t mem_total_kb = 0, mem_avail_kb = 0;
+
+      const size_t t = parse_buf.find("MemTotal:");
+      if (t != std::string::npos) {
+        mem_total_kb = std::strtoull(parse_buf.c_str() + t + 9, nullptr, 10);
+      }
+      const size_t a = parse_buf.find("MemAvailable:");
+      if (a != std::string::npos) {
+        mem_avail_kb = std::strtoull(parse_buf.c_str() + a + 13, nullptr, 10);
+      }
+
+      status.ram_total = mem_total_kb / 1024;
+      status.ram_usage = (mem_total_kb - mem_avail_kb) / 1024;
+    }
+
+    // first thermal zone as board temperature [degC]
+    if (read_proc("/sys/class/thermal/thermal_zone0/temp")) {
+      status.temperature_board =
+        static_cast<int8_t>(std::strtol(parse_buf.c_str(), nullptr, 10) / 1000);
+    }
+
+    UAS_FCU(m_uas)->send_message_ignore_drop(status);
+  }
 
   /**
    * @brief Send onboard computer status to FCU and groundstation
@@ -109,8 +251,6 @@ private:
     std::copy(req->link_rx_max.cbegin(), req->link_rx_max.cend(), status.link_rx_max.begin());
     // [[[end]]] (checksum: 98538293a5932dfb5952d4badd311b39)
 
-    std::cout << "timestamp: " << status.time_usec << "\n";
-
     UAS_FCU(m_uas)->send_message_ignore_drop(status, req->component);
   }
 };
@@ -1,5 +1,11 @@
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <mavros/mavros_plugin.h>
 #include <mavros_msgs/PlayTuneV2.h>
+#include <std_msgs/String.h>
 #include <cstring>
 
 namespace mavros
@@ -16,6 +22,17 @@ public:
   {
     PluginBase::initialize(uas_);
     sub = nh.subscribe("play_tune", 1, &PlayTunePlugin::callback, this);
+
+    // Named-tune registry: ~tunes/<name> holds the tune string (or a
+    // '|'-separated segment list); each entry is precompiled into
+    // ready PLAY_TUNE_V2 wire structs at startup, so playing an
+    // alert melody is one cheap indexed request on ~play_named.
+    load_tune_registry();
+    named_sub = nh.subscribe("play_named", 10, &PlayTunePlugin::named_cb, this);
+
+    segment_timer = nh.createTimer(
+      ros::Duration(0.1), &PlayTunePlugin::segment_timer_cb, this);
+    segment_timer.stop();
   }
 
   Subscriptions get_subscriptions() override
@@ -26,6 +43,98 @@ public:
 private:
   ros::NodeHandle nh;
   ros::Subscriber sub;
+  ros::Subscriber named_sub;
+  ros::Timer segment_timer;
+
+  //! inter-segment pacing [s]
+  static constexpr double SEGMENT_PACE_SEC = 0.5;
+
+  //! tune name -> precompiled wire messages, one per segment
+  std::unordered_map<std::string, std::vector<mavlink::common::msg::PLAY_TUNE_V2>> tune_registry;
+
+  //! segments queued for paced transmission
+  std::deque<mavlink::common::msg::PLAY_TUNE_V2> segment_queue;
+
+  void load_tune_registry()
+  {
+    ros::NodeHandle tunes_nh(nh, "tunes");
+
+    std::vector<std::string> names;
+    if (!tunes_nh.getParamNames(names)) {
+      return;
+    }
+
+    XmlRpc::XmlRpcValue dict;
+    if (!tunes_nh.getParam("", dict) ||
+      dict.getType() != XmlRpc::XmlRpcValue::TypeStruct)
+    {
+      return;
+    }
+
+    for (auto & pair : dict) {
+      if (pair.second.getType() != XmlRpc::XmlRpcValue::TypeString) {
+        continue;
+      }
+
+      const std::string tune_str = static_cast<std::string>(pair.second);
+      auto & segments = tune_registry[pair.first];
+
+      // precompile each '|'-separated segment into wire payload bytes
+      size_t begin = 0;
+      while (begin <= tune_str.size()) {
+        size_t end = tune_str.find('|', begin);
+        if (end == std::string::npos) {
+          end = tune_str.size();
+        }
+
+        mavlink::common::msg::PLAY_TUNE_V2 msg{};
+        m_uas->msg_set_target(msg);
+        msg.format = 1;   // QBASIC1.1
+        mavlink::set_string_z(msg.tune, tune_str.substr(begin, end - begin));
+        segments.push_back(msg);
+
+        begin = end + 1;
+      }
+
+      ROS_INFO_NAMED(
+        "play_tune", "PT: registered tune '%s' (%zu segments)",
+        pair.first.c_str(), segments.size());
+    }
+  }
+
+  void named_cb(const std_msgs::String::ConstPtr & req)
+  {
+    auto it = tune_registry.find(req->data);
+    if (it == tune_registry.end()) {
+      ROS_WARN_NAMED("play_tune", "PT: unknown tune '%s'", req->data.c_str());
+      return;
+    }
+
+    // queue the precompiled segments; the scheduler paces them out
+    for (const auto & segment : it->second) {
+      segment_queue.push_back(segment);
+    }
+
+    segment_timer.setPeriod(ros::Duration(0.0), true);
+    segment_timer.start();
+  }
+
+  void segment_timer_cb(const ros::TimerEvent &)
+  {
+    if (segment_queue.empty()) {
+      segment_timer.stop();
+      return;
+    }
+
+    UAS_FCU(m_uas)->send_message_ignore_drop(segment_queue.front());
+    segment_queue.pop_front();
+
+    if (segment_queue.empty()) {
+      segment_timer.stop();
+    } else {
+      segment_timer.setPeriod(ros::Duration(SEGMENT_PACE_SEC), true);
+    }
+  }
 
   void callback(const mavros_msgs::PlayTuneV2::ConstPtr & tune)
   {
@@ -16,6 +16,7 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <algorithm>
 #include <mavros/mavros_plugin.h>
 
 #include <mavros_msgs/OpticalFlowRad.h>
@@ -46,6 +47,9 @@ public:
   {
     PluginBase::initialize(uas_);
 
+    // integrate flow for this long before publishing (0: per sample)
+    flow_nh.param("accumulate_window_us", accumulate_window_us, 0);
+
     flow_nh.param<std::string>("frame_id", frame_id, "px4flow");
 
     /**
@@ -87,6 +91,20 @@ private:
   ros::Publisher temp_pub;
   ros::Subscriber flow_rad_sub;
 
+  // preallocated message set; per-sample work is field stores
+  mavros_msgs::OpticalFlowRad flow_rad_out;
+  sensor_msgs::Temperature temp_out;
+  sensor_msgs::Range range_out;
+  float last_temperature = -1000.0f;
+
+  // integrated-sample accumulation (accumulate_window_us parameter)
+  int accumulate_window_us = 0;
+  uint32_t acc_time_us = 0;
+  uint32_t acc_distance_time_us = 0;
+  Eigen::Vector3d acc_xy {0.0, 0.0, 0.0};
+  Eigen::Vector3d acc_gyro {0.0, 0.0, 0.0};
+  uint8_t acc_min_quality = UINT8_MAX;
+
   void handle_optical_flow_rad(
     const mavlink::mavlink_message_t * msg,
     mavlink::common::msg::OPTICAL_FLOW_RAD & flow_rad)
@@ -110,32 +128,58 @@ private:
         flow_rad.integrated_ygyro,
         flow_rad.integrated_zgyro));
 
-    auto flow_rad_msg = boost::make_shared<mavros_msgs::OpticalFlowRad>();
+    // optional accumulation: integrate flow over a window before
+    // publishing, matching how VIO consumes it
+    if (accumulate_window_us > 0) {
+      acc_xy += int_xy;
+      acc_gyro += int_gyro;
+      acc_time_us += flow_rad.integration_time_us;
+      acc_distance_time_us += flow_rad.time_delta_distance_us;
+      acc_min_quality = std::min(acc_min_quality, flow_rad.quality);
+
+      if (acc_time_us < uint32_t(accumulate_window_us)) {
+        return;
+      }
 
-    flow_rad_msg->header = header;
-    flow_rad_msg->integration_time_us = flow_rad.integration_time_us;
+      int_xy = acc_xy;
+      int_gyro = acc_gyro;
+      flow_rad.integration_time_us = acc_time_us;
+      flow_rad.time_delta_distance_us = acc_distance_time_us;
+      flow_rad.quality = acc_min_quality;
 
-    flow_rad_msg->integrated_x = int_xy.x();
-    flow_rad_msg->integrated_y = int_xy.y();
+      acc_xy.setZero();
+      acc_gyro.setZero();
+      acc_time_us = 0;
+      acc_distance_time_us = 0;
+      acc_min_quality = UINT8_MAX;
+    }
 
-    flow_rad_msg->integrated_xgyro = int_gyro.x();
-    flow_rad_msg->integrated_ygyro = int_gyro.y();
-    flow_rad_msg->integrated_zgyro = int_gyro.z();
+    flow_rad_out.header = header;
+    flow_rad_out.integration_time_us = flow_rad.integration_time_us;
 
-    flow_rad_msg->temperature = flow_rad.temperature / 100.0f;                  // in degrees celsius
-    flow_rad_msg->time_delta_distance_us = flow_rad.time_delta_distance_us;
-    flow_rad_msg->distance = flow_rad.distance;
-    flow_rad_msg->quality = flow_rad.quality;
+    flow_rad_out.integrated_x = int_xy.x();
+    flow_rad_out.integrated_y = int_xy.y();
 
-    flow_rad_pub.publish(flow_rad_msg);
+    flow_rad_out.integrated_xgyro = int_gyro.x();
+    flow_rad_out.integrated_ygyro = int_gyro.y();
+    flow_rad_out.integrated_zgyro = int_gyro.z();
 
-    // Temperature
-    auto temp_msg = boost::make_shared<sensor_msgs::Temperature>();
+    flow_rad_out.temperature = flow_rad.temperature / 100.0f;                   // in degrees celsius
+    flow_rad_out.time_delta_distance_us = flow_rad.time_delta_distance_us;
+    flow_rad_out.distance = flow_rad.distance;
+    flow_rad_out.quality = flow_rad.quality;
 
-    temp_msg->header = header;
-    temp_msg->temperature = flow_rad_msg->temperature;
+    flow_rad_pub.publish(flow_rad_out);
 
-    temp_pub.publish(temp_msg);
+    // Temperature: only when it actually changed
+    if (flow_rad_out.temperature != last_temperature) {
+      last_temperature = flow_rad_out.temperature;
+
+      temp_out.header = header;
+      temp_out.temperature = flow_rad_out.temperature;
+
+      temp_pub.publish(temp_out);
+    }
 
     // Rangefinder
     /**
@@ -146,17 +190,15 @@ private:
      * @todo: suggest modification on MAVLink OPTICAL_FLOW_RAD msg
      * which removes sonar data fields from it
      */
-    auto range_msg = boost::make_shared<sensor_msgs::Range>();
-
-    range_msg->header = header;
+    range_out.header = header;
 
-    range_msg->radiation_type = sensor_msgs::Range::ULTRASOUND;
-    range_msg->field_of_view = ranger_fov;
-    range_msg->min_range = ranger_min_range;
-    range_msg->max_range = ranger_max_range;
-    range_msg->range = flow_rad.distance;
+    range_out.radiation_type = sensor_msgs::Range::ULTRASOUND;
+    range_out.field_of_view = ranger_fov;
+    range_out.min_range = ranger_min_range;
+    range_out.max_range = ranger_max_range;
+    range_out.range = flow_rad.distance;
 
-    range_pub.publish(range_msg);
+    range_pub.publish(range_out);
   }
 
   void send_cb(const mavros_msgs::OpticalFlowRad::ConstPtr msg)
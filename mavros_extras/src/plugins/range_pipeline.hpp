@@ -0,0 +1,93 @@
+/**
+ * @brief Shared range sensor publishing pipeline
+ * @file range_pipeline.hpp
+ * @author Vladimir Ermakov <vooon341@gmail.com>
+ *
+ * @addtogroup plugin
+ * @{
+ */
+/*
+ * Copyright 2021 Vladimir Ermakov.
+ *
+ * This file is part of the mavros package and subject to the license terms
+ * in the top-level LICENSE file of the mavros repository.
+ * https://github.com/mavlink/mavros/tree/master/LICENSE.md
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+
+#include <ros/ros.h>
+#include <sensor_msgs/Range.h>
+
+namespace mavros
+{
+namespace extra_plugins
+{
+
+/**
+ * @brief Preallocated range publishing pipeline.
+ *
+ * RANGEFINDER and DISTANCE_SENSOR conversion duplicated per-message
+ * Range construction in two plugins. The pipeline holds one
+ * preallocated message with all static fields configured once, so
+ * the per-message hot path is a branchless clamp, two field stores
+ * and a publish.
+ */
+class RangePipeline
+{
+public:
+  void configure(
+    ros::Publisher pub_, const std::string & frame_id,
+    uint8_t radiation_type, float field_of_view,
+    float min_range, float max_range)
+  {
+    pub = pub_;
+
+    msg.header.frame_id = frame_id;
+    msg.radiation_type = radiation_type;
+    msg.field_of_view = field_of_view;
+    msg.min_range = min_range;
+    msg.max_range = max_range;
+  }
+
+  //! update the per-message bounds (wire-reported, DISTANCE_SENSOR)
+  void set_bounds(float min_range, float max_range)
+  {
+    msg.min_range = min_range;
+    msg.max_range = max_range;
+  }
+
+  void set_radiation_type(uint8_t radiation_type)
+  {
+    msg.radiation_type = radiation_type;
+  }
+
+  //! @brief store-and-publish with branchless range clamping
+  void publish(const ros::Time & stamp, float range)
+  {
+    msg.header.stamp = stamp;
+    // fmin/fmax lower to branchless fp min/max instructions
+    msg.range = std::min(std::max(range, msg.min_range), msg.max_range);
+
+    pub.publish(msg);
+  }
+
+  //! @brief publish with a caller-provided header
+  void publish(const std_msgs::Header & header, float range)
+  {
+    msg.header = header;
+    msg.range = std::min(std::max(range, msg.min_range), msg.max_range);
+
+    pub.publish(msg);
+  }
+
+private:
+  ros::Publisher pub;
+  sensor_msgs::Range msg;
+};
+
+}       // namespace extra_plugins
+}       // namespace mavros
@@ -15,6 +15,8 @@
  */
 
 #include <mavros/mavros_plugin.h>
+
+#include "range_pipeline.hpp"
 #include <sensor_msgs/Range.h>
 
 namespace mavros
@@ -40,6 +42,9 @@ public:
     PluginBase::initialize(uas_);
 
     rangefinder_pub = rangefinder_nh.advertise<sensor_msgs::Range>("rangefinder", 10);
+    pipeline.configure(
+      rangefinder_pub, "/rangefinder",
+      sensor_msgs::Range::INFRARED, 0.0f, 0.0f, 1000.0f);
   }
 
   Subscriptions get_subscriptions() override
@@ -53,21 +58,13 @@ private:
   ros::NodeHandle rangefinder_nh;
 
   ros::Publisher rangefinder_pub;
+  RangePipeline pipeline;
 
   void handle_rangefinder(
     const mavlink::mavlink_message_t * msg,
     mavlink::ardupilotmega::msg::RANGEFINDER & rangefinder)
   {
-    auto rangefinder_msg = boost::make_shared<sensor_msgs::Range>();
-    rangefinder_msg->header.stamp = ros::Time::now();
-    rangefinder_msg->header.frame_id = "/rangefinder";
-    rangefinder_msg->radiation_type = sensor_msgs::Range::INFRARED;
-    rangefinder_msg->field_of_view = 0;
-    rangefinder_msg->min_range = 0;
-    rangefinder_msg->max_range = 1000;
-    rangefinder_msg->range = rangefinder.distance;
-
-    rangefinder_pub.publish(rangefinder_msg);
+    pipeline.publish(ros::Time::now(), rangefinder.distance);
   }
 };
 }       // namespace extra_plugins
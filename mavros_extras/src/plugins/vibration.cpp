@@ -14,10 +14,18 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <thread>
+#include <vector>
+
 #include <mavros/mavros_plugin.h>
 #include <eigen_conversions/eigen_msg.h>
 
 #include <mavros_msgs/Vibration.h>
+#include <std_msgs/Float32MultiArray.h>
 
 namespace mavros
 {
@@ -41,15 +49,38 @@ public:
     PluginBase::initialize(uas_);
 
     vibe_nh.param<std::string>("frame_id", frame_id, "base_link");
+    vibe_nh.param("enable_spectral", enable_spectral, false);
 
     vibration_pub = vibe_nh.advertise<mavros_msgs::Vibration>("raw/vibration", 10);
+
+    if (enable_spectral) {
+      // windowed FFT band energies from HIGHRES_IMU accelerometer
+      // samples, computed off the rx thread at low rate
+      spectra_pub = vibe_nh.advertise<std_msgs::Float32MultiArray>("spectra", 5);
+      worker_exit = false;
+      worker = std::thread(&VibrationPlugin::spectral_worker, this);
+    }
+  }
+
+  ~VibrationPlugin() override
+  {
+    if (worker.joinable()) {
+      worker_exit = true;
+      worker.join();
+    }
   }
 
   Subscriptions get_subscriptions() override
   {
-    return {
+    Subscriptions ret = {
       make_handler(&VibrationPlugin::handle_vibration)
     };
+
+    if (enable_spectral) {
+      ret.push_back(make_handler(&VibrationPlugin::handle_highres_imu));
+    }
+
+    return ret;
   }
 
 private:
@@ -76,6 +107,102 @@ private:
 
     vibration_pub.publish(vibe_msg);
   }
+
+  /* -*- spectral analysis (enable_spectral) -*- */
+
+  //! samples per FFT window, power of two
+  static constexpr size_t FFT_N = 256;
+  //! ring depth, power of two
+  static constexpr size_t RING_N = 1024;
+
+  bool enable_spectral = false;
+  ros::Publisher spectra_pub;
+
+  //! per-axis accelerometer rings; single rx-thread writer
+  std::array<std::array<float, RING_N>, 3> accel_ring {};
+  std::atomic<size_t> ring_head {0};
+
+  std::atomic<bool> worker_exit {false};
+  std::thread worker;
+
+  void handle_highres_imu(
+    const mavlink::mavlink_message_t * msg,
+    mavlink::common::msg::HIGHRES_IMU & imu)
+  {
+    const size_t idx = ring_head.load(std::memory_order_relaxed) & (RING_N - 1);
+
+    accel_ring[0][idx] = imu.xacc;
+    accel_ring[1][idx] = imu.yacc;
+    accel_ring[2][idx] = imu.zacc;
+
+    ring_head.fetch_add(1, std::memory_order_release);
+  }
+
+  //! in-place radix-2 FFT over @p n complex points (n power of two)
+  static void fft_radix2(std::complex<float> * data, size_t n)
+  {
+    // bit reversal permutation
+    for (size_t i = 1, j = 0; i < n; i++) {
+      size_t bit = n >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) {
+        std::swap(data[i], data[j]);
+      }
+    }
+
+    for (size_t len = 2; len <= n; len <<= 1) {
+      const float angle = -2.0f * M_PI / len;
+      const std::complex<float> wlen(std::cos(angle), std::sin(angle));
+
+      for (size_t i = 0; i < n; i += len) {
+        std::complex<float> w(1.0f, 0.0f);
+        for (size_t k = 0; k < len / 2; k++) {
+          const auto u = data[i + k];
+          const auto v = data[i + k + len / 2] * w;
+          data[i + k] = u + v;
+          data[i + k + len / 2] = u - v;
+          w *= wlen;
+        }
+      }
+    }
+  }
+
+  void spectral_worker()
+  {
+    std::array<std::complex<float>, FFT_N> work;
+    auto spectra = boost::make_shared<std_msgs::Float32MultiArray>();
+    spectra->data.resize(3 * FFT_N / 2);
+
+    while (!worker_exit && ros::ok()) {
+      ros::Duration(1.0).sleep();
+
+      const size_t head = ring_head.load(std::memory_order_acquire);
+      if (head < FFT_N) {
+        continue;       // not enough samples yet
+      }
+
+      for (size_t axis = 0; axis < 3; axis++) {
+        // newest FFT_N samples, Hann windowed
+        for (size_t i = 0; i < FFT_N; i++) {
+          const size_t idx = (head - FFT_N + i) & (RING_N - 1);
+          const float hann =
+            0.5f * (1.0f - std::cos(2.0f * M_PI * i / (FFT_N - 1)));
+          work[i] = accel_ring[axis][idx] * hann;
+        }
+
+        fft_radix2(work.data(), FFT_N);
+
+        for (size_t bin = 0; bin < FFT_N / 2; bin++) {
+          spectra->data[axis * FFT_N / 2 + bin] = std::abs(work[bin]) / FFT_N;
+        }
+      }
+
+      spectra_pub.publish(spectra);
+    }
+  }
 };
 }       // namespace extra_plugins
 }       // namespace mavros
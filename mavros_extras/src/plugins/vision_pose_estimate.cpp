@@ -15,6 +15,7 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <cstring>
 #include <mavros/mavros_plugin.h>
 #include <mavros/setpoint_mixin.h>
 #include <eigen_conversions/eigen_msg.h>
@@ -61,10 +62,13 @@ public:
           " -> " << tf_child_frame_id);
       tf2_start("VisionPoseTF", &VisionPoseEstimatePlugin::transform_cb);
     } else {
-      vision_sub = sp_nh.subscribe("pose", 10, &VisionPoseEstimatePlugin::vision_cb, this);
+      // sensor-data transport: low latency beats batching at 90 Hz
+      vision_sub = sp_nh.subscribe(
+        "pose", 10, &VisionPoseEstimatePlugin::vision_cb, this,
+        ros::TransportHints().tcpNoDelay());
       vision_cov_sub = sp_nh.subscribe(
         "pose_cov", 10, &VisionPoseEstimatePlugin::vision_cov_cb,
-        this);
+        this, ros::TransportHints().tcpNoDelay());
     }
   }
 
@@ -89,6 +93,11 @@ private:
   /**
    * @brief Send vision estimate transform to FCU position controller
    */
+  // covariance fast path state (see send_vision_estimate())
+  bool cov_cache_valid = false;
+  geometry_msgs::PoseWithCovariance::_covariance_type last_cov_in {};
+  ftf::Covariance6d cov_ned_cache {};
+
   void send_vision_estimate(
     const ros::Time & stamp, const Eigen::Affine3d & tr,
     const geometry_msgs::PoseWithCovariance::_covariance_type & cov)
@@ -108,11 +117,17 @@ private:
       ftf::transform_orientation_enu_ned(
         ftf::transform_orientation_baselink_aircraft(Eigen::Quaterniond(tr.rotation()))));
 
-    auto cov_ned = ftf::transform_frame_enu_ned(cov);
-    ftf::EigenMapConstCovariance6d cov_map(cov_ned.data());
+    // VIO covariance is typically fixed (often zero): transform it
+    // only when the input actually changed since the last message
+    if (!cov_cache_valid ||
+      std::memcmp(cov.data(), last_cov_in.data(), sizeof(double) * cov.size()) != 0)
+    {
+      last_cov_in = cov;
+      cov_ned_cache = ftf::transform_frame_enu_ned(cov);
+      cov_cache_valid = true;
+    }
 
-    auto urt_view = Eigen::Matrix<double, 6, 6>(cov_map.triangularView<Eigen::Upper>());
-    ROS_DEBUG_STREAM_NAMED("vision_pose", "Vision: Covariance URT: " << std::endl << urt_view);
+    ftf::EigenMapConstCovariance6d cov_map(cov_ned_cache.data());
 
     mavlink::common::msg::VISION_POSITION_ESTIMATE vp{};
 
@@ -14,6 +14,7 @@
  * https://github.com/mavlink/mavros/tree/master/LICENSE.md
  */
 
+#include <limits>
 #include <mavros/mavros_plugin.h>
 #include <mavros_msgs/WheelOdomStamped.h>
 
@@ -206,6 +207,15 @@ private:
   ros::Time time_prev;                          //!< timestamp of previous measurement
   std::vector<double> measurement_prev;         //!< previous measurement
 
+  // precomputed differential-drive geometry (see update_odometry_diffdrive)
+  bool geom_valid = false;
+  double geom_y0 = 0.0, geom_y1 = 0.0, geom_a = 0.0, geom_dy_inv = 0.0;
+
+  // heading trig cache
+  static constexpr double YAW_TRIG_EPS = 1e-4;  //!< [rad]
+  double yaw_trig_ref = std::numeric_limits<double>::quiet_NaN();
+  double yaw_cos = 1.0, yaw_sin = 0.0;
+
   bool yaw_initialized;                         //!< initial yaw initialized (from IMU)
 
   /// @brief Robot origin 2D-state (SI units)
@@ -326,12 +336,21 @@ private:
    * @param distance	distance traveled by each wheel since last odometry update
    * @param dt		time elapse since last odometry update (s)
    */
-  void update_odometry_diffdrive(std::vector<double> distance, double dt)
+  void update_odometry_diffdrive(const std::vector<double> & distance, double dt)
   {
-    double y0 = wheel_offset[0](1);
-    double y1 = wheel_offset[1](1);
-    double a = -wheel_offset[0](0);
-    double dy_inv = 1.0 / (y1 - y0);
+    // wheel geometry is fixed: derive it once
+    if (!geom_valid) {
+      geom_y0 = wheel_offset[0](1);
+      geom_y1 = wheel_offset[1](1);
+      geom_a = -wheel_offset[0](0);
+      geom_dy_inv = 1.0 / (geom_y1 - geom_y0);
+      geom_valid = true;
+    }
+
+    const double y0 = geom_y0;
+    const double y1 = geom_y1;
+    const double a = geom_a;
+    const double dy_inv = geom_dy_inv;
     double dt_inv = 1.0 / dt;
 
     // Rotation angle
@@ -375,9 +394,15 @@ private:
     // Local pose update
     Eigen::Vector3d dpose = M * v;
 
-    // Rotation by yaw
-    double cy = std::cos(rpose(2));
-    double sy = std::sin(rpose(2));
+    // Rotation by yaw; trig recomputed only when the heading moved
+    // measurably (the threshold is far below encoder noise)
+    if (!(std::fabs(rpose(2) - yaw_trig_ref) < YAW_TRIG_EPS)) {
+      yaw_trig_ref = rpose(2);
+      yaw_cos = std::cos(yaw_trig_ref);
+      yaw_sin = std::sin(yaw_trig_ref);
+    }
+    double cy = yaw_cos;
+    double sy = yaw_sin;
     Eigen::Matrix3d R;
     R << cy, -sy, 0,
       sy, cy, 0,
@@ -455,7 +480,7 @@ private:
    * @param distance	distance traveled by each wheel since last odometry update
    * @param dt		time elapse since last odometry update (s)
    */
-  void update_odometry(std::vector<double> distance, double dt)
+  void update_odometry(const std::vector<double> & distance, double dt)
   {
     // Currently, only 2-wheels configuration implemented
     int nwheels = std::min(2, (int)distance.size());
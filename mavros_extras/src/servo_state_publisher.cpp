@@ -103,6 +103,41 @@ public:
 
     return position;
   }
+
+  // compiled scaling: the piecewise normalization slopes and the
+  // output mapping (reversal folded into the scale) are constants,
+  // so the per-message path is a compare plus a fused multiply-add
+  float norm_pos_inv = 0.0f;
+  float norm_neg_inv = 0.0f;
+  float out_scale = 0.0f;
+  float out_offset = 0.0f;
+
+  void compile()
+  {
+    norm_pos_inv = 1.0f / static_cast<float>(rc_max - rc_trim - rc_dz);
+    norm_neg_inv = 1.0f / static_cast<float>(rc_trim - rc_min - rc_dz);
+    out_scale = (joint_upper - joint_lower) / 2.0f * (rc_rev ? -1.0f : 1.0f);
+    out_offset = (joint_upper + joint_lower) / 2.0f;
+  }
+
+  inline float calculate_position_compiled(uint16_t pwm) const
+  {
+    pwm = std::max(pwm, rc_min);
+    pwm = std::min(pwm, rc_max);
+
+    float channel = 0.0f;
+    if (pwm > rc_trim + rc_dz) {
+      channel = (pwm - rc_trim - rc_dz) * norm_pos_inv;
+    } else if (pwm < rc_trim - rc_dz) {
+      channel = (pwm - rc_trim + rc_dz) * norm_neg_inv;
+    }
+
+    if (!std::isfinite(channel)) {
+      channel = 0.0f;
+    }
+
+    return channel * out_scale + out_offset;
+  }
 };
 
 class ServoStatePublisher
@@ -161,9 +196,18 @@ public:
       servos.emplace_back(
         pair.first, lower, upper, rc_channel, rc_min, rc_max, rc_trim, rc_dz,
         rc_rev);
+      servos.back().compile();
       ROS_INFO("SSP: joint '%s' (RC%d) loaded", pair.first.c_str(), rc_channel);
     }
 
+    // preallocated output: the name vector never changes, positions
+    // are updated in place per message
+    joint_states_msg.name.reserve(servos.size());
+    for (auto & desc : servos) {
+      joint_states_msg.name.push_back(desc.joint_name);
+    }
+    joint_states_msg.position.assign(servos.size(), 0.0);
+
     rc_out_sub = nh.subscribe("rc_out", 10, &ServoStatePublisher::rc_out_cb, this);
     joint_states_pub = nh.advertise<sensor_msgs::JointState>("joint_states", 10);
   }
@@ -184,7 +228,8 @@ private:
   ros::Subscriber rc_out_sub;
   ros::Publisher joint_states_pub;
 
-  std::list<ServoDescription> servos;
+  std::vector<ServoDescription> servos;
+  sensor_msgs::JointState joint_states_msg;
 
   void rc_out_cb(const mavros_msgs::RCOut::ConstPtr & msg)
   {
@@ -192,10 +237,14 @@ private:
       return;                           // nothing to do
 
     }
-    auto states = boost::make_shared<sensor_msgs::JointState>();
-    states->header.stamp = msg->header.stamp;
 
-    for (auto & desc : servos) {
+    // fused multiply-add loop into the preallocated message; unset
+    // channels keep their previous position
+    joint_states_msg.header.stamp = msg->header.stamp;
+
+    for (size_t i = 0; i < servos.size(); i++) {
+      auto & desc = servos[i];
+
       if (!(desc.rc_channel != 0 && desc.rc_channel <= msg->channels.size())) {
         continue;                               // prevent crash on servos not in that message
 
@@ -205,11 +254,10 @@ private:
         continue;                               // exclude unset channels
 
       }
-      states->name.emplace_back(desc.joint_name);
-      states->position.emplace_back(desc.calculate_position(pwm));
+      joint_states_msg.position[i] = desc.calculate_position_compiled(pwm);
     }
 
-    joint_states_pub.publish(states);
+    joint_states_pub.publish(joint_states_msg);
   }
 };
 
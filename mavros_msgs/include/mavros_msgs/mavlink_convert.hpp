@@ -17,6 +17,7 @@
 
 #include <mavconn/mavlink_dialect.hpp>
 #include <mavros_msgs/msg/mavlink.hpp>
+#include <mavros_msgs/msg/mavlink_fixed.hpp>
 
 #include <algorithm>
 
@@ -27,6 +28,7 @@ namespace mavlink
 
 using ::mavlink::mavlink_message_t;
 using mavros_msgs::msg::Mavlink;
+using mavros_msgs::msg::MavlinkFixed;
 
 // [[[cog:
 // FIELD_NAMES = [
@@ -129,6 +131,90 @@ inline bool convert(
   return true;
 }
 
+/**
+ * @brief Convert mavros_msgs/MavlinkFixed message to mavlink_message_t
+ *
+ * Fixed-capacity sibling of the Mavlink converters; see
+ * MavlinkFixed.msg for why the arrays are fixed size.
+ */
+inline bool convert(const MavlinkFixed & rmsg, mavlink_message_t & mmsg)
+{
+  if (rmsg.payload_count > rmsg.payload64.size()) {
+    return false;
+  }
+
+  if (rmsg.signature_count != 0 && rmsg.signature_count != sizeof(mmsg.signature)) {
+    return false;
+  }
+
+  // [[[cog:
+  // for f in FIELD_NAMES:
+  //     cog.outl(f"mmsg.{f} = rmsg.{f};")
+  // ]]]
+  mmsg.magic = rmsg.magic;
+  mmsg.len = rmsg.len;
+  mmsg.incompat_flags = rmsg.incompat_flags;
+  mmsg.compat_flags = rmsg.compat_flags;
+  mmsg.seq = rmsg.seq;
+  mmsg.sysid = rmsg.sysid;
+  mmsg.compid = rmsg.compid;
+  mmsg.msgid = rmsg.msgid;
+  mmsg.checksum = rmsg.checksum;
+  // [[[end]]] (checksum: 0b66f0fc1cd46db0f18a2429c56a6b8c)
+  std::copy(
+    rmsg.payload64.begin(), rmsg.payload64.begin() + rmsg.payload_count,
+    mmsg.payload64);
+  std::copy(
+    rmsg.signature.begin(), rmsg.signature.begin() + rmsg.signature_count,
+    mmsg.signature);
+
+  return true;
+}
+
+/**
+ * @brief Convert mavlink_message_t to mavros_msgs/MavlinkFixed
+ */
+inline bool convert(
+  const mavlink_message_t & mmsg, MavlinkFixed & rmsg,
+  uint8_t framing_status = 0)
+{
+  const size_t payload_count = (mmsg.len + 7) / 8;
+  if (payload_count > rmsg.payload64.size()) {
+    return false;
+  }
+
+  rmsg.framing_status = framing_status;
+
+  // [[[cog:
+  // for f in FIELD_NAMES:
+  //     cog.outl(f"rmsg.{f} = mmsg.{f};")
+  // ]]]
+  rmsg.magic = mmsg.magic;
+  rmsg.len = mmsg.len;
+  rmsg.incompat_flags = mmsg.incompat_flags;
+  rmsg.compat_flags = mmsg.compat_flags;
+  rmsg.seq = mmsg.seq;
+  rmsg.sysid = mmsg.sysid;
+  rmsg.compid = mmsg.compid;
+  rmsg.msgid = mmsg.msgid;
+  rmsg.checksum = mmsg.checksum;
+  // [[[end]]] (checksum: a688c736cd1f17497ef27aabe7e9bb9f)
+
+  rmsg.payload_count = payload_count;
+  std::copy(mmsg.payload64, mmsg.payload64 + payload_count, rmsg.payload64.begin());
+
+  if (mmsg.incompat_flags & MAVLINK_IFLAG_SIGNED) {
+    rmsg.signature_count = sizeof(mmsg.signature);
+    std::copy(
+      mmsg.signature, mmsg.signature + sizeof(mmsg.signature),
+      rmsg.signature.begin());
+  } else {
+    rmsg.signature_count = 0;
+  }
+
+  return true;
+}
+
 }  // namespace mavlink
 }  // namespace mavros_msgs
 
@@ -0,0 +1,215 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright 2021 Vladimir Ermakov.
+#
+# This file is part of the mavros package and subject to the license terms
+# in the top-level LICENSE file of the mavros repository.
+# https://github.com/mavlink/mavros/tree/master/LICENSE.md
+"""
+End-to-end SITL latency regression harness.
+
+Runs (or attaches to) PX4 SITL + mavros, injects timestamped
+messages on the FCU side of the link with pymavlink and measures
+wire-to-ROS-topic latency distributions per plugin, plus the
+setpoint echo round trip. Emits a machine-readable JSON report with
+percentiles, so dispatch-path latency regressions are caught on the
+bench instead of via flight log forensics.
+
+Measured flows:
+ - HIGHRES_IMU injection        -> /mavros/imu/data_raw
+ - LOCAL_POSITION_NED injection -> /mavros/local_position/pose
+ - setpoint_position/local      -> POSITION_TARGET_LOCAL_NED echo
+
+Usage:
+  sitl_latency_test.py --fcu-url udp:127.0.0.1:14540 \\
+      --samples 500 --report report.json [--launch-cmd "..."]
+"""
+
+import argparse
+import json
+import shlex
+import subprocess
+import sys
+import time
+
+try:
+    from pymavlink import mavutil
+except ImportError:
+    print("error: pymavlink is required", file=sys.stderr)
+    sys.exit(2)
+
+try:
+    import rclpy
+    from rclpy.qos import qos_profile_sensor_data
+    from sensor_msgs.msg import Imu
+    from geometry_msgs.msg import PoseStamped
+except ImportError:
+    print("error: rclpy + message packages are required", file=sys.stderr)
+    sys.exit(2)
+
+
+def percentiles(samples, points=(50, 90, 99)):
+    """Percentile summary of a latency sample list [s]."""
+    if not samples:
+        return {}
+
+    data = sorted(samples)
+    out = {
+        'count': len(data),
+        'min_us': round(data[0] * 1e6, 1),
+        'max_us': round(data[-1] * 1e6, 1),
+        'mean_us': round(sum(data) / len(data) * 1e6, 1),
+    }
+    for p in points:
+        idx = min(len(data) - 1, int(len(data) * p / 100))
+        out[f'p{p}_us'] = round(data[idx] * 1e6, 1)
+
+    return out
+
+
+class LatencyProbe:
+    """Injects one message type and records topic arrival latency."""
+
+    def __init__(self, node, mav, samples):
+        self.node = node
+        self.mav = mav
+        self.samples = samples
+        self.results = {}
+
+    def measure_topic(self, name, topic, msg_type, inject_fn, rate_hz=50.0):
+        """Inject with inject_fn and time arrival on topic."""
+        latencies = []
+        inject_stamp = [None]
+
+        def topic_cb(_msg):
+            if inject_stamp[0] is not None:
+                latencies.append(time.monotonic() - inject_stamp[0])
+                inject_stamp[0] = None
+
+        sub = self.node.create_subscription(
+            msg_type, topic, topic_cb, qos_profile_sensor_data)
+
+        period = 1.0 / rate_hz
+        for _i in range(self.samples):
+            inject_stamp[0] = time.monotonic()
+            inject_fn()
+
+            deadline = time.monotonic() + period
+            while time.monotonic() < deadline:
+                rclpy.spin_once(self.node, timeout_sec=0.002)
+                if inject_stamp[0] is None:
+                    break
+
+        self.node.destroy_subscription(sub)
+        self.results[name] = percentiles(latencies)
+        return self.results[name]
+
+    def measure_imu(self):
+        usec = [0]
+
+        def inject():
+            usec[0] += 20000
+            self.mav.mav.highres_imu_send(
+                usec[0], 0.0, 0.0, -9.81, 0.0, 0.0, 0.0,
+                0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0xFFFF)
+
+        return self.measure_topic(
+            'highres_imu_to_imu_raw', '/mavros/imu/data_raw', Imu, inject)
+
+    def measure_local_position(self):
+        ms = [0]
+
+        def inject():
+            ms[0] += 20
+            self.mav.mav.local_position_ned_send(
+                ms[0], 1.0, 2.0, -3.0, 0.0, 0.0, 0.0)
+
+        return self.measure_topic(
+            'local_position_to_pose', '/mavros/local_position/pose',
+            PoseStamped, inject)
+
+    def measure_setpoint_echo(self):
+        """ROS setpoint in, POSITION_TARGET_LOCAL_NED out the wire."""
+        latencies = []
+        pub = self.node.create_publisher(
+            PoseStamped, '/mavros/setpoint_position/local', 10)
+
+        for _i in range(self.samples):
+            sp = PoseStamped()
+            sp.pose.position.x = 1.0
+            t0 = time.monotonic()
+            pub.publish(sp)
+
+            deadline = time.monotonic() + 0.2
+            while time.monotonic() < deadline:
+                msg = self.mav.recv_match(
+                    type='POSITION_TARGET_LOCAL_NED', blocking=False)
+                if msg is not None:
+                    latencies.append(time.monotonic() - t0)
+                    break
+                rclpy.spin_once(self.node, timeout_sec=0.002)
+
+        self.node.destroy_publisher(pub)
+        self.results['setpoint_echo_rtt'] = percentiles(latencies)
+        return self.results['setpoint_echo_rtt']
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        '--fcu-url', default='udp:127.0.0.1:14540',
+        help='pymavlink connection to the FCU side of the link')
+    parser.add_argument('--samples', type=int, default=500)
+    parser.add_argument('--report', default='latency_report.json')
+    parser.add_argument(
+        '--launch-cmd', default=None,
+        help='optional command starting SITL + mavros; '
+             'when omitted the harness attaches to a running stack')
+    args = parser.parse_args()
+
+    proc = None
+    if args.launch_cmd:
+        print(f"launching: {args.launch_cmd}")
+        proc = subprocess.Popen(shlex.split(args.launch_cmd))
+        time.sleep(15.0)    # boot + plugin init
+
+    print(f"connecting to {args.fcu_url}")
+    mav = mavutil.mavlink_connection(args.fcu_url)
+    mav.wait_heartbeat(timeout=30)
+
+    rclpy.init()
+    node = rclpy.create_node('sitl_latency_test')
+
+    probe = LatencyProbe(node, mav, args.samples)
+    print("measuring HIGHRES_IMU -> imu/data_raw ...")
+    print(" ", probe.measure_imu())
+    print("measuring LOCAL_POSITION_NED -> local_position/pose ...")
+    print(" ", probe.measure_local_position())
+    print("measuring setpoint echo round trip ...")
+    print(" ", probe.measure_setpoint_echo())
+
+    report = {
+        'fcu_url': args.fcu_url,
+        'samples': args.samples,
+        'stamp': time.time(),
+        'flows': probe.results,
+    }
+
+    with open(args.report, 'w') as f:
+        json.dump(report, f, indent=2)
+    print(f"report written to {args.report}")
+
+    node.destroy_node()
+    rclpy.shutdown()
+
+    if proc is not None:
+        proc.terminate()
+        proc.wait(timeout=10)
+
+    # regression gate: nonzero when any flow produced no samples
+    return 0 if all(probe.results.values()) else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())